@@ -0,0 +1,58 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __BENCH_H
+#define __BENCH_H
+
+// timing helpers shared by the benchmarks.
+
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct bench_stats_t {
+    double min, median, p99; // in milliseconds
+} bench_stats_t;
+
+// monotonic time in milliseconds
+static double bench_now(void){
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec*1e3 + time.tv_nsec*1e-6;
+}
+
+static int bench_compare(const void *a, const void *b){
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// sorts samples.
+static bench_stats_t bench_stats(double *samples, int count){
+    qsort(samples, count, sizeof(*samples), bench_compare);
+    int p99 = (count*99 + 99) / 100 - 1;
+    return (bench_stats_t){
+        .min = samples[0],
+        .median = count % 2? samples[count/2] : (samples[count/2 - 1] + samples[count/2]) / 2,
+        .p99 = samples[p99 < count? p99 : count - 1],
+    };
+}
+
+#endif // __BENCH_H
@@ -0,0 +1,243 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+// microbenchmarks of the canvas operations on square canvases of increasing size.
+// usage: bench/canvas [--json] [--runs N] [--max-size N]
+// prints one line of csv (or one json object) per operation and size, with the min, median and p99 time in milliseconds.
+// a case stops sampling early once it took more than TIME_BUDGET_MS, so the largest sizes may report fewer runs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/raylib.h"
+
+#include "canvas.h"
+
+#include "bench.h"
+
+#define DEFAULT_RUNS 10
+#define TIME_BUDGET_MS 5000.0
+#define MAX_STREAM_PIXELS 100000
+#define MAX_SIZE 8192
+
+typedef struct context_t {
+    canvas_t *canvas;
+    int size;
+    Vector2 *pixels; // pixel stream for the set/blend cases
+    int count;
+    const char *path; // output file of the save cases
+} context_t;
+
+// setup and teardown are not timed.
+typedef struct case_t {
+    const char *name;
+    void (*setup)(context_t *ctx);
+    void (*run)(context_t *ctx);
+    void (*teardown)(context_t *ctx);
+    const char *extension; // save cases only
+} case_t;
+
+static const int SIZES[] = {8, 64, 512, 4096, 8192};
+
+// -- setup
+
+static void setupBlank(context_t *ctx){
+    Image image = GenImageColor(ctx->size, ctx->size, WHITE);
+    ctx->canvas = canvas_newHeadless(image);
+    UnloadImage(image);
+}
+
+// deterministic scattered pixels, so consecutive writes rarely share a tile.
+static void setupStream(context_t *ctx){
+    setupBlank(ctx);
+    size_t area = (size_t)ctx->size*ctx->size;
+    ctx->count = area < MAX_STREAM_PIXELS? (int)area : MAX_STREAM_PIXELS;
+    ctx->pixels = malloc(ctx->count*sizeof(*ctx->pixels));
+    unsigned int state = 1;
+    for (int i = 0; i < ctx->count; i++){
+        state = state*1664525u + 1013904223u;
+        ctx->pixels[i] = (Vector2){(state >> 8) % ctx->size, (state >> 20 ^ state) % ctx->size};
+    }
+}
+
+// vertical corridors, connected alternately at the top and the bottom. The fill has to visit every pixel along the longest path.
+static void setupMaze(context_t *ctx){
+    Image image = GenImageColor(ctx->size, ctx->size, WHITE);
+    for (int x = 3, n = 0; x < ctx->size; x += 4, n++){
+        ImageDrawRectangle(&image, x, n % 2? 1 : 0, 1, ctx->size - 1, BLACK);
+    }
+    ctx->canvas = canvas_newHeadless(image);
+    UnloadImage(image);
+}
+
+// a long diagonal stroke, recorded as a single action.
+static void setupStroke(context_t *ctx){
+    setupBlank(ctx);
+    canvas_nextPixelStroke(ctx->canvas);
+    int length = ctx->size < MAX_STREAM_PIXELS / 8? ctx->size : MAX_STREAM_PIXELS / 8;
+    for (int row = 0; row < 8; row++){
+        for (int i = 0; i < length; i++){
+            canvas_setPixel(ctx->canvas, (Vector2){i, (i + row) % ctx->size}, RED);
+        }
+    }
+}
+
+static void setupUndone(context_t *ctx){
+    setupStroke(ctx);
+    canvas_undo(ctx->canvas);
+}
+
+// -- runs
+
+static void runSetPixel(context_t *ctx){
+    canvas_nextPixelStroke(ctx->canvas);
+    for (int i = 0; i < ctx->count; i++) canvas_setPixel(ctx->canvas, ctx->pixels[i], RED);
+}
+
+static void runBlendPixel(context_t *ctx){
+    canvas_nextPixelStroke(ctx->canvas);
+    for (int i = 0; i < ctx->count; i++) canvas_blendPixel(ctx->canvas, ctx->pixels[i], (Color){255, 0, 0, 128});
+}
+
+static void runFlood(context_t *ctx){
+    canvas_colorFlood(ctx->canvas, (Vector2){0, 0}, RED, 0);
+}
+
+static void runResize(context_t *ctx){
+    int size = ctx->size*3/4;
+    canvas_resize(ctx->canvas, (Vector2){size, size}, BLANK);
+}
+
+static void runHalfResolution(context_t *ctx){
+    canvas_changeResolution(ctx->canvas, 0.5f);
+}
+
+static void runDoubleResolution(context_t *ctx){
+    canvas_changeResolution(ctx->canvas, 2.0f);
+}
+
+static void runUndo(context_t *ctx){
+    canvas_undo(ctx->canvas);
+}
+
+static void runRedo(context_t *ctx){
+    canvas_redo(ctx->canvas);
+}
+
+static void runSave(context_t *ctx){
+    if (!canvas_saveAsImage(ctx->canvas, ctx->path, PNG_EFFORT_FAST)) exit(1);
+}
+
+// -- teardown
+
+static void teardown(context_t *ctx){
+    canvas_free(ctx->canvas);
+    free(ctx->pixels);
+    ctx->pixels = NULL;
+    ctx->count = 0;
+}
+
+static void teardownSave(context_t *ctx){
+    remove(ctx->path);
+    teardown(ctx);
+}
+
+static const case_t CASES[] = {
+    {"setPixel", setupStream, runSetPixel, teardown, NULL},
+    {"blendPixel", setupStream, runBlendPixel, teardown, NULL},
+    {"colorFlood", setupMaze, runFlood, teardown, NULL},
+    {"resize", setupBlank, runResize, teardown, NULL},
+    {"changeResolution0.5", setupBlank, runHalfResolution, teardown, NULL},
+    {"changeResolution2", setupBlank, runDoubleResolution, teardown, NULL},
+    {"undoStroke", setupStroke, runUndo, teardown, NULL},
+    {"redoStroke", setupUndone, runRedo, teardown, NULL},
+    {"savePng", setupBlank, runSave, teardownSave, ".png"},
+    {"saveQoi", setupBlank, runSave, teardownSave, ".qoi"},
+    {"saveRaw", setupBlank, runSave, teardownSave, ".raw"},
+};
+
+// returns the number of runs that fit into the time budget, at least one.
+static int measure(const case_t *bench, context_t *ctx, double *samples, int runs){
+    double start = bench_now();
+    int run = 0;
+    while (run < runs && (run == 0 || bench_now() - start < TIME_BUDGET_MS)){
+        bench->setup(ctx);
+        double begin = bench_now();
+        bench->run(ctx);
+        samples[run++] = bench_now() - begin;
+        bench->teardown(ctx);
+    }
+    return run;
+}
+
+static void usage(const char *program){
+    printf("usage: %s [--json] [--runs N] [--max-size N]\n", program);
+}
+
+int main(int argc, char **argv){
+    bool json = false;
+    int runs = DEFAULT_RUNS;
+    int max_size = MAX_SIZE;
+    for (int i = 1; i < argc; i++){
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) runs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) max_size = atoi(argv[++i]);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (runs <= 0 || max_size <= 0){
+        usage(argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    // the saved files are placed next to the binary, which keeps them out of the way of git.
+    char path[4096];
+    double *samples = malloc(runs*sizeof(*samples));
+    bool first = true;
+    if (json) printf("[\n");
+    else printf("benchmark,size,runs,min_ms,median_ms,p99_ms\n");
+    for (size_t s = 0; s < sizeof(SIZES)/sizeof(*SIZES) && SIZES[s] <= max_size; s++){
+        for (size_t c = 0; c < sizeof(CASES)/sizeof(*CASES); c++){
+            const case_t *bench = &CASES[c];
+            if (bench->run == runDoubleResolution && SIZES[s]*2 > MAX_SIZE) continue;
+            snprintf(path, sizeof(path), "%s-output%s", argv[0], bench->extension != NULL? bench->extension : "");
+            context_t ctx = {.size = SIZES[s], .path = path};
+            int done = measure(bench, &ctx, samples, runs);
+            bench_stats_t stats = bench_stats(samples, done);
+            if (json){
+                printf("%s  {\"benchmark\": \"%s\", \"size\": %d, \"runs\": %d, \"min_ms\": %.4f, \"median_ms\": %.4f, \"p99_ms\": %.4f}",
+                    first? "" : ",\n", bench->name, SIZES[s], done, stats.min, stats.median, stats.p99);
+            } else {
+                printf("%s,%d,%d,%.4f,%.4f,%.4f\n", bench->name, SIZES[s], done, stats.min, stats.median, stats.p99);
+            }
+            fflush(stdout);
+            first = false;
+        }
+    }
+    if (json) printf("\n]\n");
+    free(samples);
+    return 0;
+}
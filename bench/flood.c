@@ -0,0 +1,127 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+// scaling of the parallel flood fill with the number of threads.
+// usage: bench/flood [width height [runs [max_threads]]], max_threads defaults to the number of cores.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/raylib.h"
+
+#include "fill.h"
+#include "threadpool.h"
+
+#include "bench.h"
+
+#define DEFAULT_RUNS 5
+
+typedef struct pattern_t {
+    const char *name;
+    Image image;
+} pattern_t;
+
+// about a third of the pixels block the fill, the open area is still connected, but very ragged.
+static Image genNoise(int width, int height){
+    Image image = GenImageColor(width, height, WHITE);
+    Color *pixels = image.data;
+    srand(1);
+    for (size_t i = 0; i < (size_t)width*height; i++){
+        if (rand() % 3 == 0) pixels[i] = BLACK;
+    }
+    pixels[0] = WHITE;
+    return image;
+}
+
+// vertical corridors, connected alternately at the top and the bottom.
+// the worst case for the scanline fill, which pushes a seed for every corridor row it passes.
+static Image genSerpentine(int width, int height){
+    Image image = GenImageColor(width, height, WHITE);
+    for (int x = 3, n = 0; x < width; x += 4, n++){
+        ImageDrawRectangle(&image, x, n % 2? 1 : 0, 1, height - 1, BLACK);
+    }
+    return image;
+}
+
+// returns the time of every run and checks that each result equals expected.
+static bool measure(Image source, Image expected, threadpool_t *pool, double *samples, int runs){
+    size_t size = (size_t)source.width*source.height*sizeof(Color);
+    Image work = GenImageColor(source.width, source.height, BLANK);
+    bool equal = true;
+    for (int run = 0; run < runs; run++){
+        memcpy(work.data, source.data, size);
+        double start = bench_now();
+        imageColorFloodParallel(&work, 0, 0, RED, 0, pool);
+        samples[run] = bench_now() - start;
+        equal = equal && memcmp(work.data, expected.data, size) == 0;
+    }
+    UnloadImage(work);
+    return equal;
+}
+
+int main(int argc, char **argv){
+    int width = argc > 2? atoi(argv[1]) : 8192;
+    int height = argc > 2? atoi(argv[2]) : 6144;
+    int runs = argc > 3? atoi(argv[3]) : DEFAULT_RUNS;
+    int cores = argc > 4? atoi(argv[4]) : 0;
+    if (width <= 0 || height <= 0 || runs <= 0 || cores < 0){
+        printf("usage: %s [width height [runs [max_threads]]]\n", argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+    if (cores == 0){
+        threadpool_t *probe = threadpool_new(0);
+        cores = threadpool_size(probe);
+        threadpool_free(probe);
+    }
+
+    pattern_t patterns[] = {
+        {"solid", GenImageColor(width, height, WHITE)},
+        {"noise", genNoise(width, height)},
+        {"serpentine", genSerpentine(width, height)},
+    };
+    double *samples = malloc(runs*sizeof(*samples));
+    bool success = true;
+    printf("flood fill %dx%d, %d runs, up to %d threads\n", width, height, runs, cores);
+    printf("%-10s %8s %10s %10s %10s %8s\n", "pattern", "threads", "min ms", "median ms", "p99 ms", "speedup");
+    for (size_t p = 0; p < sizeof(patterns)/sizeof(*patterns); p++){
+        Image expected = ImageCopy(patterns[p].image);
+        imageColorFlood(&expected, 0, 0, RED, 0);
+        double serial = 0;
+        for (int threads = 1; ; threads = threads*2 < cores? threads*2 : cores){
+            threadpool_t *pool = threadpool_new(threads);
+            bool equal = measure(patterns[p].image, expected, pool, samples, runs);
+            threadpool_free(pool);
+            bench_stats_t stats = bench_stats(samples, runs);
+            if (threads == 1) serial = stats.median;
+            printf("%-10s %8d %10.2f %10.2f %10.2f %7.2fx%s\n", patterns[p].name, threads, stats.min, stats.median, stats.p99,
+                serial / stats.median, equal? "" : "  MISMATCH");
+            success = success && equal;
+            if (threads == cores) break;
+        }
+        UnloadImage(expected);
+        UnloadImage(patterns[p].image);
+    }
+    free(samples);
+    return success? 0 : 1;
+}
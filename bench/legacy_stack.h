@@ -0,0 +1,97 @@
+
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+
+// copy of the registry based external/stack.h, before size and capacity moved in front of the data.
+// only kept as a baseline for bench/stack.c.
+
+#ifndef __LEGACY_STACK_H
+#define __LEGACY_STACK_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+struct __legacy_stack_info{
+    void *stack_ptr;
+    size_t size;
+    size_t capacity;
+};
+
+static struct __legacy_stack_info *__legacy_g_si = NULL;
+static size_t __legacy_g_sc = 0;
+
+static struct __legacy_stack_info *__legacy_get_si(void *stack){
+    for (size_t i = 0; i < __legacy_g_sc; i++){
+        if (__legacy_g_si[i].stack_ptr == stack) return &__legacy_g_si[i];
+    }
+    // if the stack ptr is unknown, it's probably from uninitialized memory.
+    if (stack != NULL){
+        perror("[STACK] WARNING: given stack was not initialized!\n");
+    }
+    return NULL;
+}
+
+#define __legacy_init_stack(stack) do{                                                                                  \
+    __legacy_g_si = realloc(__legacy_g_si, (++__legacy_g_sc) * sizeof(*__legacy_g_si));                                 \
+    __legacy_g_si[__legacy_g_sc-1].stack_ptr = stack;                                                                   \
+    __legacy_g_si[__legacy_g_sc-1].size = 0;                                                                            \
+    __legacy_g_si[__legacy_g_sc-1].capacity = 0;                                                                        \
+}while(0)
+
+#define legacy_stack_free(stack) do{                                                                                    \
+    struct __legacy_stack_info *__si = __legacy_get_si(stack);                                                          \
+    if (__si != NULL){                                                                                                  \
+        if (__si < __legacy_g_si + __legacy_g_sc - 1) memmove(__si, __si + 1, (__legacy_g_sc - (__si - __legacy_g_si) - 1)*sizeof(*__si)); \
+        __legacy_g_si = realloc(__legacy_g_si, (--__legacy_g_sc) * sizeof(*__legacy_g_si));                             \
+        free(stack);                                                                                                    \
+        stack = NULL;                                                                                                   \
+    }                                                                                                                   \
+}while(0)
+
+#define legacy_stack_reserve_capacity(stack, new_capacity) do{                                                          \
+    if (stack == NULL) __legacy_init_stack(stack);                                                                      \
+    struct __legacy_stack_info *__si = __legacy_get_si(stack);                                                          \
+    __legacy_stack_reserve_capacity(__si, stack, new_capacity);                                                         \
+}while(0)
+
+#define __legacy_stack_reserve_capacity(__si, stack, new_capacity) do{                                                  \
+    __si->capacity = __si->size < new_capacity? new_capacity : __si->size;                                              \
+    stack = realloc(stack, __si->capacity * sizeof(*stack));                                                            \
+    __si->stack_ptr = stack;                                                                                            \
+}while(0)
+
+#define legacy_stack_push(stack, ...)  do{                                                                              \
+    if (stack == NULL) __legacy_init_stack(stack);                                                                      \
+    struct __legacy_stack_info *__si = __legacy_get_si(stack);                                                          \
+    if (__si->size == __si->capacity) {                                                                                 \
+        __legacy_stack_reserve_capacity(__si, stack, (__si->capacity + 1) * 2);                                         \
+    }                                                                                                                   \
+    stack[__si->size++] = __VA_ARGS__;                                                                                  \
+}while(0)
+
+#define legacy_stack_pop(stack)  stack[__legacy_get_si(stack)->size > 0? --__legacy_get_si(stack)->size : 0]
+
+#define legacy_stack_size(stack) (__legacy_get_si(stack) == NULL? (size_t)0 : __legacy_get_si(stack)->size)
+
+#endif //__LEGACY_STACK_H
@@ -0,0 +1,163 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+// compares the parallel png encoder with raylib's ExportImageToMemory, which is what ExportImage uses for pngs.
+// usage: bench/png [--json] [--runs N] [--max-size N] [--threads N]
+// prints one line of csv (or one json object) per image, size and encoder, with the min, median and p99 time in milliseconds
+// and the size of the encoded file in bytes.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/raylib.h"
+
+#include "png.h"
+
+#include "bench.h"
+
+#define DEFAULT_RUNS 5
+#define TIME_BUDGET_MS 5000.0
+#define MAX_SIZE 4096
+
+typedef struct image_t {
+    const char *name;
+    Image (*generate)(int size);
+} image_t;
+
+static const int SIZES[] = {512, 2048, 4096};
+
+// -- images
+
+// flat colors with hard edges, like most pixel art.
+static Image generateDrawing(int size){
+    Image image = GenImageColor(size, size, WHITE);
+    for (int i = 0; i < 200; i++){
+        int w = size/8 + (i*37) % (size/4), h = size/8 + (i*53) % (size/4);
+        ImageDrawRectangle(&image, (i*97) % (size - w), (i*61) % (size - h), w, h, (Color){i*5, i*11, i*3, 255});
+    }
+    return image;
+}
+
+static Image generateGradient(int size){
+    return GenImageGradientLinear(size, size, 45, RED, BLUE);
+}
+
+// worst case, there is little to compress.
+static Image generateNoise(int size){
+    Image image = GenImageColor(size, size, BLANK);
+    unsigned int state = 1;
+    Color *pixels = image.data;
+    for (int i = 0; i < size*size; i++){
+        state = state*1664525u + 1013904223u;
+        pixels[i] = (Color){state >> 24, state >> 16, state >> 8, 255};
+    }
+    return image;
+}
+
+static const image_t IMAGES[] = {
+    {"drawing", generateDrawing},
+    {"gradient", generateGradient},
+    {"noise", generateNoise},
+};
+
+// -- encoders
+
+typedef enum encoder_t {ENCODER_RAYLIB, ENCODER_FAST, ENCODER_MAX, ENCODER_COUNT} encoder_t;
+
+static const char *ENCODER_NAMES[] = {"ExportImage", "fast", "max"};
+
+static unsigned char *encode(encoder_t encoder, Image image, int threads, size_t *size){
+    if (encoder == ENCODER_RAYLIB){
+        int data_size = 0;
+        unsigned char *data = ExportImageToMemory(image, ".png", &data_size);
+        *size = data_size;
+        return data;
+    }
+    return png_encode(image, encoder == ENCODER_MAX? PNG_EFFORT_MAX : PNG_EFFORT_FAST, threads, size);
+}
+
+// returns the number of runs that fit into the time budget, at least one.
+static int measure(encoder_t encoder, Image image, int threads, double *samples, int runs, size_t *size){
+    double start = bench_now();
+    int run = 0;
+    while (run < runs && (run == 0 || bench_now() - start < TIME_BUDGET_MS)){
+        double begin = bench_now();
+        unsigned char *data = encode(encoder, image, threads, size);
+        samples[run++] = bench_now() - begin;
+        if (data == NULL) exit(1);
+        free(data);
+    }
+    return run;
+}
+
+static void usage(const char *program){
+    printf("usage: %s [--json] [--runs N] [--max-size N] [--threads N]\n", program);
+}
+
+int main(int argc, char **argv){
+    bool json = false;
+    int runs = DEFAULT_RUNS;
+    int max_size = MAX_SIZE;
+    int threads = 0;
+    for (int i = 1; i < argc; i++){
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) runs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) max_size = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threads = atoi(argv[++i]);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (runs <= 0 || max_size <= 0){
+        usage(argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    double *samples = malloc(runs*sizeof(*samples));
+    bool first = true;
+    if (json) printf("[\n");
+    else printf("image,size,encoder,runs,min_ms,median_ms,p99_ms,bytes\n");
+    for (size_t s = 0; s < sizeof(SIZES)/sizeof(*SIZES) && SIZES[s] <= max_size; s++){
+        for (size_t i = 0; i < sizeof(IMAGES)/sizeof(*IMAGES); i++){
+            Image image = IMAGES[i].generate(SIZES[s]);
+            for (encoder_t encoder = 0; encoder < ENCODER_COUNT; encoder++){
+                size_t size = 0;
+                int done = measure(encoder, image, threads, samples, runs, &size);
+                bench_stats_t stats = bench_stats(samples, done);
+                if (json){
+                    printf("%s  {\"image\": \"%s\", \"size\": %d, \"encoder\": \"%s\", \"runs\": %d, \"min_ms\": %.4f, \"median_ms\": %.4f, \"p99_ms\": %.4f, \"bytes\": %zu}",
+                        first? "" : ",\n", IMAGES[i].name, SIZES[s], ENCODER_NAMES[encoder], done, stats.min, stats.median, stats.p99, size);
+                } else {
+                    printf("%s,%d,%s,%d,%.4f,%.4f,%.4f,%zu\n", IMAGES[i].name, SIZES[s], ENCODER_NAMES[encoder], done, stats.min, stats.median, stats.p99, size);
+                }
+                fflush(stdout);
+                first = false;
+            }
+            UnloadImage(image);
+        }
+    }
+    if (json) printf("\n]\n");
+    free(samples);
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+// compares the qoi codec in src/qoi.c with raylib's, which is what ExportImage and LoadImage use for qoi files.
+// usage: bench/qoi [--json] [--runs N] [--max-size N]
+// prints one line of csv (or one json object) per image, size, codec and direction, with the min, median and p99 time
+// in milliseconds and the throughput of the median in MB of pixels per second.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/raylib.h"
+#include "external/raylib/src/external/qoi.h" // the implementation is compiled into rtextures.c
+
+#include "qoi.h"
+
+#include "bench.h"
+
+#define DEFAULT_RUNS 10
+#define TIME_BUDGET_MS 5000.0
+#define MAX_SIZE 8192
+
+typedef struct image_t {
+    const char *name;
+    Image (*generate)(int size);
+} image_t;
+
+static const int SIZES[] = {512, 2048, 8192};
+
+// -- images
+
+// sprite atlas: small sprites with flat colors on a transparent background, which qoi stores mostly as runs.
+static Image generateAtlas(int size){
+    Image image = GenImageColor(size, size, BLANK);
+    int sprite = 64;
+    for (int y = 0; y < size; y += sprite){
+        for (int x = 0; x < size; x += sprite){
+            int i = x/sprite + y/sprite*7;
+            ImageDrawRectangle(&image, x + 8, y + 8, sprite - 16, sprite - 16, (Color){i*5, i*11, i*3, 255});
+            ImageDrawCircle(&image, x + sprite/2, y + sprite/2, sprite/6, (Color){255 - i*7, i*13, 40, 255});
+        }
+    }
+    return image;
+}
+
+static Image generateGradient(int size){
+    return GenImageGradientLinear(size, size, 45, RED, BLUE);
+}
+
+// worst case, most pixels are stored as QOI_OP_RGB.
+static Image generateNoise(int size){
+    Image image = GenImageColor(size, size, BLANK);
+    unsigned int state = 1;
+    Color *pixels = image.data;
+    for (int i = 0; i < size*size; i++){
+        state = state*1664525u + 1013904223u;
+        pixels[i] = (Color){state >> 24, state >> 16, state >> 8, 255};
+    }
+    return image;
+}
+
+static const image_t IMAGES[] = {
+    {"atlas", generateAtlas},
+    {"gradient", generateGradient},
+    {"noise", generateNoise},
+};
+
+// -- cases
+
+typedef enum codec_t {CODEC_RAYLIB, CODEC_IMFAP, CODEC_COUNT} codec_t;
+static const char *CODEC_NAMES[] = {"raylib", "imfap"};
+
+typedef enum direction_t {DIRECTION_ENCODE, DIRECTION_DECODE, DIRECTION_COUNT} direction_t;
+static const char *DIRECTION_NAMES[] = {"encode", "decode"};
+
+// file holds the encoded image for decoding, pixels the output of decoding.
+static void run(codec_t codec, direction_t direction, Image image, const unsigned char *file, size_t file_size, Color *pixels){
+    if (direction == DIRECTION_ENCODE){
+        size_t size = 0;
+        unsigned char *data = NULL;
+        if (codec == CODEC_RAYLIB){
+            // what ExportImage does for qoi files. ExportImageToMemory only supports png.
+            qoi_desc desc = {.width=image.width, .height=image.height, .channels=4, .colorspace=QOI_SRGB};
+            int data_size = 0;
+            data = qoi_encode(image.data, &desc, &data_size);
+            size = data_size;
+        } else {
+            data = qoi_encodePixels(image.data, image.width, image.height, &size);
+        }
+        if (data == NULL || size == 0) exit(1);
+        free(data);
+    } else if (codec == CODEC_RAYLIB){
+        Image decoded = LoadImageFromMemory(".qoi", file, file_size);
+        if (!IsImageReady(decoded)) exit(1);
+        UnloadImage(decoded);
+    } else {
+        if (!qoi_decodePixels(file, file_size, pixels, image.width, image.height)) exit(1);
+    }
+}
+
+// returns the number of runs that fit into the time budget, at least one.
+static int measure(codec_t codec, direction_t direction, Image image, const unsigned char *file, size_t file_size, Color *pixels, double *samples, int runs){
+    double start = bench_now();
+    int done = 0;
+    while (done < runs && (done == 0 || bench_now() - start < TIME_BUDGET_MS)){
+        double begin = bench_now();
+        run(codec, direction, image, file, file_size, pixels);
+        samples[done++] = bench_now() - begin;
+    }
+    return done;
+}
+
+static void usage(const char *program){
+    printf("usage: %s [--json] [--runs N] [--max-size N]\n", program);
+}
+
+int main(int argc, char **argv){
+    bool json = false;
+    int runs = DEFAULT_RUNS;
+    int max_size = MAX_SIZE;
+    for (int i = 1; i < argc; i++){
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) runs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) max_size = atoi(argv[++i]);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (runs <= 0 || max_size <= 0){
+        usage(argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    double *samples = malloc(runs*sizeof(*samples));
+    bool first = true;
+    if (json) printf("[\n");
+    else printf("image,size,codec,direction,runs,min_ms,median_ms,p99_ms,mb_per_s\n");
+    for (size_t s = 0; s < sizeof(SIZES)/sizeof(*SIZES) && SIZES[s] <= max_size; s++){
+        for (size_t i = 0; i < sizeof(IMAGES)/sizeof(*IMAGES); i++){
+            Image image = IMAGES[i].generate(SIZES[s]);
+            size_t file_size = 0;
+            unsigned char *file = qoi_encodePixels(image.data, image.width, image.height, &file_size);
+            Color *pixels = malloc((size_t)image.width*image.height*sizeof(*pixels));
+            if (file == NULL || pixels == NULL) return 1;
+            double megabytes = (double)image.width*image.height*sizeof(*pixels) / 1e6;
+            for (direction_t direction = 0; direction < DIRECTION_COUNT; direction++){
+                for (codec_t codec = 0; codec < CODEC_COUNT; codec++){
+                    int done = measure(codec, direction, image, file, file_size, pixels, samples, runs);
+                    bench_stats_t stats = bench_stats(samples, done);
+                    double throughput = megabytes / (stats.median / 1e3);
+                    if (json){
+                        printf("%s  {\"image\": \"%s\", \"size\": %d, \"codec\": \"%s\", \"direction\": \"%s\", \"runs\": %d, \"min_ms\": %.4f, \"median_ms\": %.4f, \"p99_ms\": %.4f, \"mb_per_s\": %.1f}",
+                            first? "" : ",\n", IMAGES[i].name, SIZES[s], CODEC_NAMES[codec], DIRECTION_NAMES[direction], done, stats.min, stats.median, stats.p99, throughput);
+                    } else {
+                        printf("%s,%d,%s,%s,%d,%.4f,%.4f,%.4f,%.1f\n", IMAGES[i].name, SIZES[s], CODEC_NAMES[codec], DIRECTION_NAMES[direction], done, stats.min, stats.median, stats.p99, throughput);
+                    }
+                    fflush(stdout);
+                    first = false;
+                }
+            }
+            free(pixels);
+            free(file);
+            UnloadImage(image);
+        }
+    }
+    if (json) printf("\n]\n");
+    free(samples);
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+// cost of the stack macros in a pixel by pixel flood fill (the fill algorithm used before the scanline fill),
+// comparing the header based external/stack.h with the previous registry based version.
+// usage: bench/stack [size [runs]]
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/raylib.h"
+
+#include "external/stack.h"
+#include "legacy_stack.h"
+
+#include "bench.h"
+
+#define DEFAULT_RUNS 5
+// the registry is searched linearly, so its cost also depends on the other stacks that are alive.
+#define OTHER_STACKS 16
+
+// fill from the top left corner, pushing every pixel separately.
+#define DEFINE_PIXEL_FLOOD(name, push, pop, size, release)                                                      \
+static void name(Image *image, Color color){                                                                    \
+    uint32_t *pixels = image->data;                                                                             \
+    size_t width = image->width, count = (size_t)image->width*image->height;                                    \
+    uint32_t target = pixels[0], flood;                                                                         \
+    memcpy(&flood, &color, sizeof(flood));                                                                      \
+    bool *visited = calloc(count, sizeof(*visited));                                                            \
+    size_t *stack = NULL;                                                                                       \
+    push(stack, 0);                                                                                             \
+    visited[0] = true;                                                                                          \
+    while (size(stack) > 0){                                                                                    \
+        size_t idx = pop(stack);                                                                                \
+        pixels[idx] = flood;                                                                                    \
+        size_t neighbours[4];                                                                                   \
+        int n = 0;                                                                                              \
+        if (idx % width > 0) neighbours[n++] = idx - 1;                                                         \
+        if (idx % width + 1 < width) neighbours[n++] = idx + 1;                                                 \
+        if (idx >= width) neighbours[n++] = idx - width;                                                        \
+        if (idx + width < count) neighbours[n++] = idx + width;                                                 \
+        for (int i = 0; i < n; i++){                                                                            \
+            if (!visited[neighbours[i]] && pixels[neighbours[i]] == target){                                    \
+                visited[neighbours[i]] = true;                                                                  \
+                push(stack, neighbours[i]);                                                                     \
+            }                                                                                                   \
+        }                                                                                                       \
+    }                                                                                                           \
+    release(stack);                                                                                             \
+    free(visited);                                                                                              \
+}
+
+DEFINE_PIXEL_FLOOD(floodHeader, stack_push, stack_pop, stack_size, stack_free)
+DEFINE_PIXEL_FLOOD(floodLegacy, legacy_stack_push, legacy_stack_pop, legacy_stack_size, legacy_stack_free)
+
+typedef void (*flood_t)(Image *image, Color color);
+
+static bench_stats_t measure(flood_t flood, Image source, Image *result, double *samples, int runs){
+    for (int run = 0; run < runs; run++){
+        Image work = ImageCopy(source);
+        double start = bench_now();
+        flood(&work, RED);
+        samples[run] = bench_now() - start;
+        if (run == 0) *result = work;
+        else UnloadImage(work);
+    }
+    return bench_stats(samples, runs);
+}
+
+static void report(const char *name, bench_stats_t stats, double baseline){
+    printf("%-24s %10.2f %10.2f %10.2f %7.2fx\n", name, stats.min, stats.median, stats.p99, baseline / stats.median);
+}
+
+int main(int argc, char **argv){
+    int size = argc > 1? atoi(argv[1]) : 4096;
+    int runs = argc > 2? atoi(argv[2]) : DEFAULT_RUNS;
+    if (size <= 0 || runs <= 0){
+        printf("usage: %s [size [runs]]\n", argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+    Image source = GenImageColor(size, size, WHITE);
+    double *samples = malloc(runs*sizeof(*samples));
+    Image expected, result;
+
+    printf("pixel flood fill %dx%d, %d runs\n", size, size, runs);
+    printf("%-24s %10s %10s %10s %8s\n", "stack", "min ms", "median ms", "p99 ms", "speedup");
+    bench_stats_t legacy = measure(floodLegacy, source, &expected, samples, runs);
+    report("registry", legacy, legacy.median);
+
+    int *others[OTHER_STACKS] = {0};
+    for (int i = 0; i < OTHER_STACKS; i++) legacy_stack_push(others[i], i);
+    bench_stats_t crowded = measure(floodLegacy, source, &result, samples, runs);
+    UnloadImage(result);
+    for (int i = 0; i < OTHER_STACKS; i++) legacy_stack_free(others[i]);
+    char name[32];
+    snprintf(name, sizeof(name), "registry, %d live", OTHER_STACKS);
+    report(name, crowded, legacy.median);
+
+    bench_stats_t header = measure(floodHeader, source, &result, samples, runs);
+    report("header", header, legacy.median);
+    bool equal = memcmp(result.data, expected.data, (size_t)size*size*sizeof(Color)) == 0;
+    if (!equal) printf("MISMATCH between the results\n");
+
+    UnloadImage(result);
+    UnloadImage(expected);
+    UnloadImage(source);
+    free(samples);
+    return equal? 0 : 1;
+}
@@ -0,0 +1,250 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/raylib.h"
+
+#include "batch.h"
+#include "canvas.h"
+#include "qoi.h"
+
+#define BATCH_MAX_LINE 1024
+
+typedef struct batch_t {
+    canvas_t *canvas;
+    batch_config_t config;
+    const char *script_name;
+    int line;
+    png_effort_t png_effort;
+} batch_t;
+
+static void batch_error(const batch_t *batch, const char *message, const char *detail){
+    fprintf(stderr, "%s:%d: error: %s%s%s\n", batch->script_name, batch->line, message, detail? ": " : "", detail? detail : "");
+}
+
+// RRGGBB or RRGGBBAA
+static bool parseColor(const char *text, Color *color){
+    size_t length = strlen(text);
+    if (length != 6 && length != 8) return false;
+    for (size_t i = 0; i < length; i++){
+        if (!isxdigit((unsigned char)text[i])) return false;
+    }
+    unsigned long value = strtoul(text, NULL, 16);
+    if (length == 6) value = value << 8 | 0xFF;
+    *color = (Color){value >> 24, value >> 16 & 0xFF, value >> 8 & 0xFF, value & 0xFF};
+    return true;
+}
+
+// split args into at most max_words whitespace separated words. Returns the number of words, or -1 if there are more.
+static int splitWords(char *args, char **words, int max_words){
+    int count = 0;
+    for (char *word = strtok(args, " \t"); word != NULL; word = strtok(NULL, " \t")){
+        if (count == max_words) return -1;
+        words[count++] = word;
+    }
+    return count;
+}
+
+static bool parseInt(const char *text, int *value){
+    char *end;
+    long result = strtol(text, &end, 10);
+    if (*text == 0 || *end != 0 || result < -(1L << 30) || result > (1L << 30)) return false;
+    *value = result;
+    return true;
+}
+
+static bool batch_setCanvas(batch_t *batch, canvas_t *canvas){
+    // the old canvas goes before the journal is opened, closing its journal removes the file at the same path.
+    if (batch->canvas != NULL) canvas_free(batch->canvas);
+    batch->canvas = canvas;
+    canvas_setHistoryBudget(batch->canvas, batch->config.history_budget);
+    if (batch->config.journal_path != NULL && !canvas_enableHistoryJournal(batch->canvas, batch->config.journal_path)){
+        batch_error(batch, "failed to create history journal", batch->config.journal_path);
+        canvas_free(batch->canvas);
+        batch->canvas = NULL;
+        return false;
+    }
+    return true;
+}
+
+// replace the canvas with a new one showing image.
+static bool batch_setImage(batch_t *batch, Image image){
+    canvas_t *canvas = canvas_newHeadless(image);
+    UnloadImage(image);
+    return batch_setCanvas(batch, canvas);
+}
+
+static bool batch_load(batch_t *batch, const char *path){
+    // raw files are mapped like in the window, changes stay out of the file until it is saved.
+    if (IsFileExtension(path, ".raw")){
+        canvas_t *canvas = canvas_newRawHeadless(path, true);
+        if (canvas == NULL){
+            batch_error(batch, "failed to load image", path);
+            return false;
+        }
+        return batch_setCanvas(batch, canvas);
+    }
+    // qoi is decoded while reading, without holding the whole file in memory.
+    Image image = IsFileExtension(path, ".qoi")? qoi_loadFile(path) : LoadImage(path);
+    if (!IsImageReady(image)){
+        batch_error(batch, "failed to load image", path);
+        UnloadImage(image);
+        return false;
+    }
+    return batch_setImage(batch, image);
+}
+
+// everything after the command, with surrounding whitespace removed. Used for file names, which may contain spaces.
+static char *trim(char *text){
+    while (isspace((unsigned char)*text)) text++;
+    char *end = text + strlen(text);
+    while (end > text && isspace((unsigned char)end[-1])) end--;
+    *end = 0;
+    return text;
+}
+
+static bool batch_command(batch_t *batch, char *line){
+    char *comment = strchr(line, '#');
+    if (comment != NULL) *comment = 0;
+    line = trim(line);
+    if (*line == 0) return true;
+
+    char *args = line + strcspn(line, " \t");
+    if (*args != 0) *args++ = 0;
+    const char *command = line;
+    args = trim(args);
+
+    if (strcmp(command, "load") == 0 || strcmp(command, "save") == 0){
+        if (*args == 0){
+            batch_error(batch, "missing file name", command);
+            return false;
+        }
+        if (command[0] == 'l') return batch_load(batch, args);
+        if (batch->canvas == NULL){
+            batch_error(batch, "no image to save", NULL);
+            return false;
+        }
+        if (!canvas_saveAsImage(batch->canvas, args, batch->png_effort)){
+            batch_error(batch, "failed to save image", args);
+            return false;
+        }
+        return true;
+    }
+
+    if (strcmp(command, "pngEffort") == 0){
+        if (strcmp(args, "fast") == 0) batch->png_effort = PNG_EFFORT_FAST;
+        else if (strcmp(args, "max") == 0) batch->png_effort = PNG_EFFORT_MAX;
+        else {
+            batch_error(batch, "invalid arguments for", command);
+            return false;
+        }
+        return true;
+    }
+
+    char *words[4];
+    int count = splitWords(args, words, 4);
+    int x = 0, y = 0, tolerance = 0;
+    Color color = BLANK;
+    bool valid = count >= 0;
+    enum {ARGS_NONE, ARGS_SIZE, ARGS_FACTOR, ARGS_PIXEL, ARGS_FILL} kind = ARGS_NONE;
+    if (strcmp(command, "new") == 0 || strcmp(command, "resize") == 0) kind = ARGS_SIZE;
+    else if (strcmp(command, "changeResolution") == 0) kind = ARGS_FACTOR;
+    else if (strcmp(command, "setPixel") == 0) kind = ARGS_PIXEL;
+    else if (strcmp(command, "fill") == 0 || strcmp(command, "replace") == 0) kind = ARGS_FILL;
+    else if (strcmp(command, "undo") != 0 && strcmp(command, "redo") != 0){
+        batch_error(batch, "unknown command", command);
+        return false;
+    }
+    switch (kind){
+        case ARGS_NONE: valid = valid && count == 0; break;
+        case ARGS_FACTOR: valid = valid && count == 1; break;
+        case ARGS_SIZE:
+            valid = valid && (count == 2 || count == 3) && parseInt(words[0], &x) && parseInt(words[1], &y) && x > 0 && y > 0
+                && (count < 3 || parseColor(words[2], &color));
+            break;
+        case ARGS_PIXEL:
+            valid = valid && count == 3 && parseInt(words[0], &x) && parseInt(words[1], &y) && parseColor(words[2], &color);
+            break;
+        case ARGS_FILL:
+            valid = valid && (count == 3 || count == 4) && parseInt(words[0], &x) && parseInt(words[1], &y) && parseColor(words[2], &color)
+                && (count < 4 || (parseInt(words[3], &tolerance) && tolerance >= 0 && tolerance <= 255));
+            break;
+    }
+    if (!valid){
+        batch_error(batch, "invalid arguments for", command);
+        return false;
+    }
+
+    if (strcmp(command, "new") == 0) return batch_setImage(batch, GenImageColor(x, y, color));
+    if (batch->canvas == NULL){
+        batch_error(batch, "no image loaded before", command);
+        return false;
+    }
+    Vector2 size = canvas_getSize(batch->canvas);
+    if ((kind == ARGS_PIXEL || kind == ARGS_FILL) && (x < 0 || y < 0 || x >= size.x || y >= size.y)){
+        batch_error(batch, "pixel outside of the image for", command);
+        return false;
+    }
+    if (strcmp(command, "resize") == 0) canvas_resize(batch->canvas, (Vector2){x, y}, color);
+    else if (strcmp(command, "setPixel") == 0){
+        canvas_nextPixelStroke(batch->canvas);
+        canvas_setPixel(batch->canvas, (Vector2){x, y}, color);
+    }
+    else if (strcmp(command, "fill") == 0) canvas_colorFlood(batch->canvas, (Vector2){x, y}, color, tolerance);
+    else if (strcmp(command, "replace") == 0) canvas_colorReplace(batch->canvas, (Vector2){x, y}, color, tolerance);
+    else if (strcmp(command, "undo") == 0) canvas_undo(batch->canvas);
+    else if (strcmp(command, "redo") == 0) canvas_redo(batch->canvas);
+    else if (strcmp(command, "changeResolution") == 0){
+        char *end;
+        float factor = strtof(words[0], &end);
+        int width = factor*size.x, height = factor*size.y;
+        if (*end != 0 || width <= 0 || height <= 0){
+            batch_error(batch, "invalid resolution factor", words[0]);
+            return false;
+        }
+        canvas_changeResolution(batch->canvas, factor);
+    }
+    canvas_nextFrame(batch->canvas, (Rectangle){0}, 0); // headless, only clears the modified regions
+    return true;
+}
+
+int batch_run(FILE *script, const char *script_name, batch_config_t config){
+    batch_t batch = {.config = config, .script_name = script_name};
+    bool success = config.image_path == NULL || batch_load(&batch, config.image_path);
+    char line[BATCH_MAX_LINE];
+    while (success && fgets(line, sizeof(line), script) != NULL){
+        batch.line++;
+        if (strchr(line, '\n') == NULL && !feof(script)){
+            batch_error(&batch, "line too long", NULL);
+            success = false;
+            break;
+        }
+        success = batch_command(&batch, line);
+    }
+    if (batch.canvas != NULL) canvas_free(batch.canvas);
+    return success? 0 : 1;
+}
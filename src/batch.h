@@ -0,0 +1,52 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __BATCH_H
+#define __BATCH_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+// Non-interactive mode: runs a script of canvas commands on a headless canvas, without opening a window.
+// one command per line, '#' starts a comment. Colors are hex RRGGBB or RRGGBBAA.
+//   new <width> <height> [color]       replace the canvas with a new image (default color: transparent)
+//   load <file>                        replace the canvas with an image file
+//   save <file>
+//   pngEffort <fast|max>               compression of the following png saves (default: fast)
+//   resize <width> <height> [color]    (default color: transparent)
+//   changeResolution <factor>
+//   setPixel <x> <y> <color>
+//   fill <x> <y> <color> [tolerance]
+//   replace <x> <y> <color> [tolerance]  fill all pixels of the color at (x, y), connected or not
+//   undo
+//   redo
+
+typedef struct batch_config_t {
+    const char *image_path; // optional, loaded before the first command
+    size_t history_budget;
+    const char *journal_path; // optional
+} batch_config_t;
+
+// returns the exit code: 0 if all commands succeeded. Stops at the first failing command.
+int batch_run(FILE *script, const char *script_name, batch_config_t config);
+
+#endif // __BATCH_H
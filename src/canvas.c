@@ -20,77 +20,406 @@
  *  3. This notice may not be removed or altered from any source distribution.
  */
 
-#include <assert.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "external/raylib/src/raylib.h"
 
-#include "external/stack.h"
 #include "external/deque.h"
+#include "external/stack.h"
 
 #include "canvas.h"
+#include "fill.h"
+#include "journal.h"
+#include "rawfile.h"
+#include "threadpool.h"
+#include "trace.h"
+#include "tiles.h"
+#include "util.h"
+
+#ifndef MIN
+#define MIN(a, b) ((a)<(b)? (a) : (b))
+#define MAX(a, b) ((a)>(b)? (a) : (b))
+#endif
 
-static Texture2D loadImageAsTexture(Image *image);
-static bool setTextureToImage(Texture2D *texture, Image *image);
+static void canvas_freeLevels(canvas_t *canvas);
 static void ImageResizeCanvasOwn(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill);
-static void imageColorFlood(Image *image, Vector2 source_pixel, Color new_color);
 
-#define MAX_UNDO_STEPS 10000
 
-typedef struct pixel_t {
-    Vector2 pos;
-    Color color;
-} pixel_t;
+typedef struct stroke_pixel_t {
+    unsigned int idx; // y * width + x
+    Color before;
+    Color after;
+} stroke_pixel_t;
 
-typedef struct delta_t{
-    union {
-        pixel_t pixel;
-        Image image;
-    };
-}delta_t;
+// all pixels painted during one drawing action, in painting order.
+typedef struct stroke_t {
+    int width; // width of the canvas while painting, required to decode idx
+    size_t count;
+    size_t capacity;
+    stroke_pixel_t pixels[];
+} stroke_t;
 
 typedef enum DIFF_TYPE {
     INVALID_DIFF = 0,
-    PIXEL_DIFF,
+    STROKE_DIFF,
     IMAGE_DIFF,
+    REGION_DIFF, // like IMAGE_DIFF, but only covers the tiles of a part of the canvas
 } DIFF_TYPE;
 
 typedef struct diff_t {
     DIFF_TYPE type;
     size_t action_id;
-    delta_t before;
-    delta_t after;
+    union {
+        stroke_t *stroke;
+        struct {
+            tilemap_t before;
+            tilemap_t after;
+        } image;
+    };
 } diff_t;
 
 typedef DEQ(diff_t) diff_deq_t;
 
+// the undo journal was cut back to end, when journal_seq was seq.
+typedef struct journal_truncation_t {
+    unsigned long long seq;
+    size_t end;
+} journal_truncation_t;
+
 typedef struct recorder_t {
     diff_deq_t undo_queue;
     diff_deq_t redo_queue;
+    tile_pool_t *pool;
+    size_t entry_bytes; // memory of all recorded diffs, excluding the tiles in the pool
+    size_t live_bytes; // pool memory of the tiles of the current content, which is not part of the history
+    size_t budget; // oldest entries are dropped once entry_bytes + tile memory of the history exceed the budget.
+    // optional: instead of dropping them, the oldest entries are moved to a file and paged in again on undo.
+    journal_t *journal;
+    size_t journal_entries;
+    // entries paged in on undo end up in the redo queue, the furthest redos are moved to their own file and paged in again on redo.
+    journal_t *redo_journal;
+    size_t redo_journal_entries;
+    unsigned long long journal_seq; // last sequence number given to a tile in the journal
+    // truncations of the undo journal, both seq and end increasing. Only the lowest end since any seq matters.
+    journal_truncation_t *truncations;
 } recorder_t;
 
+// journal layout, growing like a stack:
+// [tile]... [diff record] [footer] [tile]... [diff record] [footer]
+// each record is preceded by the tiles it references, that were not yet in the journal.
+// record parts must be multiples of 8 bytes, so that no alignment padding is inserted between them.
+typedef struct journal_tile_t {
+    unsigned long long seq;
+    int width, height;
+    size_t packed_size;
+    // followed by packed_size bytes of qoi data
+} journal_tile_t;
+
+typedef struct journal_diff_t {
+    DIFF_TYPE type;
+    int stroke_width;
+    size_t action_id;
+    size_t stroke_count;
+    int before_width, before_height, after_width, after_height;
+    int region_x, region_y;
+    // IMAGE_DIFF, REGION_DIFF: followed by the journal offsets of the before and after tiles
+    // STROKE_DIFF: followed by the stroke pixels
+} journal_diff_t;
+
+typedef struct journal_footer_t {
+    size_t tiles_start; // journal end before the tiles of this record were added
+    size_t record_size;
+} journal_footer_t;
+
+// pixel regions modified since the last frame, that still have to be uploaded to the texture.
+// modifications are merged into a few rectangles to avoid one upload per pixel.
+#define MAX_DIRTY_RECTS 32
+// estimated fixed cost of a single texture upload, measured in pixels.
+// two regions are merged, if uploading their union is cheaper than uploading both separately.
+#define UPLOAD_COST_PIXELS 256
+
+// canvases with at least this many pixels are flood filled by several threads.
+#define PARALLEL_FLOOD_PIXELS (4096*4096)
+
+typedef struct region_t {
+    int x0, y0, x1, y1; // x1 and y1 are exclusive
+} region_t;
+
+typedef struct dirty_t {
+    region_t rects[MAX_DIRTY_RECTS];
+    int count;
+    bool reload_texture; // size of the buffer changed, the textures have to be recreated.
+} dirty_t;
+
+// the canvas is drawn as a grid of textures of this size, because the size of a single texture is limited by the gpu.
+// textures are only created and updated while they are visible.
+#define TEXTURE_TILE_SIZE 1024
+
+typedef struct texture_grid_t {
+    canvas_texture_t *textures; // columns x rows, texture.id is 0 until first visible
+    region_t *pending; // modified area of each texture that was not uploaded, because the texture was not visible
+    canvas_texture_t *visible; // returned by canvas_nextFrame
+    int columns, rows;
+} texture_grid_t;
+
+// the mip levels are updated in squares of this size, measured in pixels of the level.
+#define MIP_BLOCK_SIZE 64
+
+// downsampled copy of the buffer for zooming out. Level k has 1/2^k of the resolution, every pixel is the average of 2x2 pixels of level k-1.
+typedef struct mip_level_t {
+    Image image;
+    bool *stale_blocks; // blocks that have to be recomputed from the level above
+    int block_columns, block_rows;
+} mip_level_t;
+
 typedef enum DIRECTION{
     DIRECTION_REVERSE = 0,
     DIRECTION_FORWARD = 1,
 }DIRECTION;
 
-static void recorder_pop_tail(diff_deq_t *deque){
+static stroke_t *stroke_new(int width, size_t capacity){
+    stroke_t *stroke = malloc(sizeof(*stroke) + capacity*sizeof(*stroke->pixels));
+    stroke->width = width;
+    stroke->count = 0;
+    stroke->capacity = capacity;
+    return stroke;
+}
+
+static void stroke_append(stroke_t **stroke, stroke_pixel_t pixel){
+    if ((*stroke)->count == (*stroke)->capacity){
+        (*stroke)->capacity = ((*stroke)->capacity + 1) * 2;
+        *stroke = realloc(*stroke, sizeof(**stroke) + (*stroke)->capacity*sizeof(*(*stroke)->pixels));
+    }
+    (*stroke)->pixels[(*stroke)->count++] = pixel;
+}
+
+static size_t recorder_entry_size(diff_t diff){
+    size_t size = sizeof(diff);
+    if (diff.type == IMAGE_DIFF || diff.type == REGION_DIFF){
+        size += (tilemap_count(&diff.image.before) + tilemap_count(&diff.image.after)) * sizeof(tile_t*);
+    } else if (diff.type == STROKE_DIFF){
+        size += sizeof(*diff.stroke) + diff.stroke->capacity*sizeof(*diff.stroke->pixels);
+    }
+    return size;
+}
+
+// tiles shared between the history and the current content only count for the content.
+static size_t recorder_size(recorder_t *rec){
+    return rec->entry_bytes + rec->pool->bytes - rec->live_bytes;
+}
+
+static void recorder_pop_tail(recorder_t *rec, diff_deq_t *deque){
     diff_t diff = deq_poll(*deque);
+    rec->entry_bytes -= recorder_entry_size(diff);
     switch(diff.type){
-        case IMAGE_DIFF: {
-            UnloadImage(diff.before.image);
-            UnloadImage(diff.after.image);
+        case IMAGE_DIFF:
+        case REGION_DIFF: {
+            tilemap_free(rec->pool, &diff.image.before);
+            tilemap_free(rec->pool, &diff.image.after);
         } break;
+        case STROKE_DIFF: free(diff.stroke); break;
         // no free required:
-        case INVALID_DIFF:
-        case PIXEL_DIFF: break;
+        case INVALID_DIFF: break;
+    }
+}
+
+static void recorder_journal_truncate(recorder_t *rec, journal_t *journal, size_t end){
+    journal_truncate(journal, end);
+    if (journal != rec->journal) return;
+    while (stack_size(rec->truncations) > 0 && rec->truncations[stack_size(rec->truncations) - 1].end >= end) (void)stack_pop(rec->truncations);
+    stack_push(rec->truncations, (journal_truncation_t){.seq = rec->journal_seq, .end = end});
+}
+
+// the copy of the tile in the undo journal is still there, if the journal was not cut back to its offset since it was written.
+// Once cut, the offset may hold any later data, so its content can't tell.
+static bool recorder_journal_holds(recorder_t *rec, const tile_t *tile){
+    if (tile->journal_seq == 0 || tile->journal_offset >= journal_end(rec->journal)) return false;
+    // first truncation after the tile was written, it has the lowest end of all later ones.
+    size_t low = 0, high = stack_size(rec->truncations);
+    while (low < high){
+        size_t mid = (low + high) / 2;
+        if (rec->truncations[mid].seq < tile->journal_seq) low = mid + 1;
+        else high = mid;
+    }
+    if (low < stack_size(rec->truncations) && rec->truncations[low].end <= tile->journal_offset) return false;
+    const journal_tile_t *stored = journal_read(rec->journal, tile->journal_offset, sizeof(*stored));
+    return stored != NULL && stored->seq == tile->journal_seq;
+}
+
+// returns the offset of the tile in the journal, appending it if necessary.
+// tiles only remember their copy in the undo journal, tiles in the redo journal are not shared between records.
+static bool recorder_journal_tile(recorder_t *rec, journal_t *journal, tile_t *tile, size_t *offset){
+    bool shared = journal == rec->journal;
+    if (shared && recorder_journal_holds(rec, tile)){
+        *offset = tile->journal_offset; // shared with an older record
+        return true;
+    }
+    size_t packed_size;
+    bool owned;
+    const unsigned char *packed = tile_getPacked(tile, &packed_size, &owned);
+    if (packed == NULL) return false;
+    journal_tile_t header = {.seq = ++rec->journal_seq, .width = tile->width, .height = tile->height, .packed_size = packed_size};
+    size_t data_offset;
+    bool success = journal_append(journal, &header, sizeof(header), offset)
+        && journal_append(journal, packed, packed_size, &data_offset);
+    if (owned) free((void*)packed);
+    if (success && shared){
+        tile->journal_offset = *offset;
+        tile->journal_seq = header.seq;
+    }
+    return success;
+}
+
+static bool recorder_journal_write(recorder_t *rec, journal_t *journal, diff_t diff){
+    journal_footer_t footer = {.tiles_start = journal_end(journal)};
+    journal_diff_t header = {.type = diff.type, .action_id = diff.action_id};
+    size_t tile_count = 0;
+    size_t *offsets = NULL;
+    const void *payload = NULL;
+    size_t payload_size = 0;
+    bool success = true;
+    if (diff.type == STROKE_DIFF){
+        header.stroke_width = diff.stroke->width;
+        header.stroke_count = diff.stroke->count;
+        payload = diff.stroke->pixels;
+        payload_size = diff.stroke->count*sizeof(*diff.stroke->pixels);
+    } else if (diff.type == IMAGE_DIFF || diff.type == REGION_DIFF){
+        tilemap_t *maps[2] = {&diff.image.before, &diff.image.after};
+        header.region_x = maps[0]->x;
+        header.region_y = maps[0]->y;
+        header.before_width = maps[0]->width;
+        header.before_height = maps[0]->height;
+        header.after_width = maps[1]->width;
+        header.after_height = maps[1]->height;
+        offsets = malloc((tilemap_count(maps[0]) + tilemap_count(maps[1])) * sizeof(*offsets));
+        for (int m = 0; m < 2 && success; m++){
+            for (size_t i = 0; i < tilemap_count(maps[m]) && success; i++){
+                success = recorder_journal_tile(rec, journal, maps[m]->tiles[i], &offsets[tile_count++]);
+            }
+        }
+        payload = offsets;
+        payload_size = tile_count*sizeof(*offsets);
+    }
+    // the footer is aligned by journal_append, which pads the payload to a multiple of 8 bytes.
+    footer.record_size = sizeof(header) + (payload_size + 7) / 8 * 8;
+    size_t offset;
+    success = success
+        && journal_append(journal, &header, sizeof(header), &offset)
+        && journal_append(journal, payload, payload_size, &offset)
+        && journal_append(journal, &footer, sizeof(footer), &offset);
+    free(offsets);
+    if (!success) recorder_journal_truncate(rec, journal, footer.tiles_start);
+    return success;
+}
+
+static bool recorder_journal_readTiles(recorder_t *rec, journal_t *journal, tilemap_t *map, const size_t *offsets, size_t tiles_start){
+    for (size_t i = 0; i < tilemap_count(map); i++){
+        const journal_tile_t *stored = journal_read(journal, offsets[i], sizeof(*stored));
+        const unsigned char *packed = stored? journal_read(journal, offsets[i] + sizeof(*stored), stored->packed_size) : NULL;
+        if (packed == NULL) return false;
+        tile_t *tile = tile_fromPacked(rec->pool, stored->width, stored->height, packed, stored->packed_size);
+        // tiles of this record are dropped from the journal, only older ones can be shared again.
+        if (journal == rec->journal && offsets[i] < tiles_start){
+            tile->journal_offset = offsets[i];
+            tile->journal_seq = stored->seq;
+        }
+        map->tiles[i] = tile;
+    }
+    return true;
+}
+
+// move the latest entry of the journal back into the (empty) deque. entries is the number of records in the journal.
+static bool recorder_page_in(recorder_t *rec, journal_t *journal, size_t *entries, diff_deq_t *deque){
+    if (journal == NULL || *entries == 0) return false;
+    size_t end = journal_end(journal);
+    const journal_footer_t *footer = journal_read(journal, end - sizeof(*footer), sizeof(*footer));
+    const journal_diff_t *header = footer? journal_read(journal, end - sizeof(*footer) - footer->record_size, footer->record_size) : NULL;
+    if (header == NULL){
+        printf("[HISTORY] ERROR: corrupted history journal\n");
+        *entries = 0;
+        return false;
+    }
+    diff_t diff = {.type = header->type, .action_id = header->action_id};
+    bool success = true;
+    if (header->type == STROKE_DIFF){
+        diff.stroke = stroke_new(header->stroke_width, header->stroke_count);
+        diff.stroke->count = header->stroke_count;
+        memcpy(diff.stroke->pixels, header + 1, header->stroke_count*sizeof(*diff.stroke->pixels));
+    } else if (header->type == IMAGE_DIFF || header->type == REGION_DIFF){
+        const size_t *offsets = (const size_t*)(header + 1);
+        diff.image.before = tilemap_new(header->before_width, header->before_height);
+        diff.image.after = tilemap_new(header->after_width, header->after_height);
+        diff.image.before.x = diff.image.after.x = header->region_x;
+        diff.image.before.y = diff.image.after.y = header->region_y;
+        success = recorder_journal_readTiles(rec, journal, &diff.image.before, offsets, footer->tiles_start)
+            && recorder_journal_readTiles(rec, journal, &diff.image.after, offsets + tilemap_count(&diff.image.before), footer->tiles_start);
+    }
+    recorder_journal_truncate(rec, journal, footer->tiles_start);
+    (*entries)--;
+    if (!success){
+        printf("[HISTORY] ERROR: corrupted history journal\n");
+        for (size_t i = 0; i < tilemap_count(&diff.image.before); i++) tile_unref(rec->pool, diff.image.before.tiles[i]);
+        for (size_t i = 0; i < tilemap_count(&diff.image.after); i++) tile_unref(rec->pool, diff.image.after.tiles[i]);
+        free(diff.image.before.tiles);
+        free(diff.image.after.tiles);
+        *entries = 0;
+        return false;
+    }
+    deq_push(*deque, diff);
+    rec->entry_bytes += recorder_entry_size(diff);
+    return true;
+}
+
+// move the entry at the far end of the deque (the oldest undo or the furthest redo) into the journal.
+static void recorder_spill(recorder_t *rec, journal_t *journal, size_t *entries, diff_deq_t *deque){
+    if (recorder_journal_write(rec, journal, deq_back(*deque))){
+        (*entries)++;
+    } else {
+        printf("[HISTORY] WARNING: unable to write to the history journal, dropping change\n");
+    }
+    recorder_pop_tail(rec, deque);
+}
+
+// drop (or move to the journal) the oldest changes until the history fits into the budget again. The latest change is always kept.
+// Redos only grow beyond the budget when undoing pages entries in from the journal, so they are only moved with a journal.
+// The next redo is always kept.
+static void recorder_enforce_budget(recorder_t *rec){
+    while(recorder_size(rec) > rec->budget && deq_size(rec->undo_queue) > 1){
+        if (rec->journal != NULL) recorder_spill(rec, rec->journal, &rec->journal_entries, &rec->undo_queue);
+        else recorder_pop_tail(rec, &rec->undo_queue);
+    }
+    while(recorder_size(rec) > rec->budget && rec->redo_journal != NULL && deq_size(rec->redo_queue) > 1){
+        recorder_spill(rec, rec->redo_journal, &rec->redo_journal_entries, &rec->redo_queue);
     }
 }
 
 static void recorder_record(recorder_t *rec, diff_t diff){
-    if (deq_size(rec->undo_queue) >= MAX_UNDO_STEPS) recorder_pop_tail(&rec->undo_queue);
     deq_push(rec->undo_queue, diff);
-    while(deq_size(rec->redo_queue) > 0) recorder_pop_tail(&rec->redo_queue);
+    rec->entry_bytes += recorder_entry_size(diff);
+    while(deq_size(rec->redo_queue) > 0) recorder_pop_tail(rec, &rec->redo_queue);
+    if (rec->redo_journal != NULL) journal_truncate(rec->redo_journal, 0);
+    rec->redo_journal_entries = 0;
+    recorder_enforce_budget(rec);
+}
+
+// pixels of the same drawing action are collected in a single stroke.
+static void recorder_record_pixel(recorder_t *rec, size_t action_id, int width, stroke_pixel_t pixel){
+    if (action_id != 0 && deq_size(rec->undo_queue) > 0 && deq_size(rec->redo_queue) == 0 && rec->redo_journal_entries == 0){
+        diff_t *last = &deq_front(rec->undo_queue);
+        if (last->type == STROKE_DIFF && last->action_id == action_id && last->stroke->width == width){
+            size_t old_size = recorder_entry_size(*last);
+            stroke_append(&last->stroke, pixel);
+            rec->entry_bytes += recorder_entry_size(*last) - old_size;
+            recorder_enforce_budget(rec);
+            return;
+        }
+    }
+    stroke_t *stroke = stroke_new(width, 1);
+    stroke_append(&stroke, pixel);
+    recorder_record(rec, (diff_t){.type=STROKE_DIFF, .action_id=action_id, .stroke=stroke});
 }
 
 static diff_t __recorder_wind(diff_deq_t *from, diff_deq_t *to){
@@ -104,41 +433,158 @@ static diff_t __recorder_wind(diff_deq_t *from, diff_deq_t *to){
 }
 
 static diff_t recorder_wind(recorder_t *rec, DIRECTION dir){
-    return dir == DIRECTION_REVERSE? __recorder_wind(&rec->undo_queue, &rec->redo_queue)
+    bool paged_in = false;
+    if (dir == DIRECTION_REVERSE && deq_size(rec->undo_queue) == 0){
+        paged_in = recorder_page_in(rec, rec->journal, &rec->journal_entries, &rec->undo_queue);
+    } else if (dir == DIRECTION_FORWARD && deq_size(rec->redo_queue) == 0){
+        paged_in = recorder_page_in(rec, rec->redo_journal, &rec->redo_journal_entries, &rec->redo_queue);
+    }
+    diff_t diff = dir == DIRECTION_REVERSE? __recorder_wind(&rec->undo_queue, &rec->redo_queue)
         : __recorder_wind(&rec->redo_queue, &rec->undo_queue);
+    // the paged in entry makes room by moving the far end of the other queue to its journal. diff stays in memory.
+    if (paged_in) recorder_enforce_budget(rec);
+    return diff;
 }
 
 static void recorder_free(recorder_t *rec){
-    while(recorder_wind(rec, DIRECTION_FORWARD).type != INVALID_DIFF); // push redos into undo queue
-    while(deq_size(rec->undo_queue) > 0) recorder_pop_tail(&rec->undo_queue);
+    while(deq_size(rec->redo_queue) > 0) recorder_pop_tail(rec, &rec->redo_queue);
+    while(deq_size(rec->undo_queue) > 0) recorder_pop_tail(rec, &rec->undo_queue);
     deq_free(rec->undo_queue);
     deq_free(rec->redo_queue);
+    journal_close(rec->journal);
+    journal_close(rec->redo_journal);
+    stack_free(rec->truncations);
+    rec->journal = NULL;
+    rec->redo_journal = NULL;
+}
+
+static size_t region_cost(region_t r){
+    return (size_t)(r.x1 - r.x0) * (r.y1 - r.y0) + UPLOAD_COST_PIXELS;
+}
+
+static region_t region_union(region_t a, region_t b){
+    return (region_t){MIN(a.x0, b.x0), MIN(a.y0, b.y0), MAX(a.x1, b.x1), MAX(a.y1, b.y1)};
+}
+
+// change of cost when uploading the union of a and b instead of both.
+static long region_merge_cost(region_t a, region_t b){
+    return (long)region_cost(region_union(a, b)) - (long)region_cost(a) - (long)region_cost(b);
+}
+
+static void dirty_add(dirty_t *dirty, region_t r){
+    if (dirty->reload_texture) return; // everything gets uploaded anyways.
+    for(;;){
+        int best = -1;
+        long best_cost = 0;
+        for (int i = 0; i < dirty->count; i++){
+            long cost = region_merge_cost(dirty->rects[i], r);
+            if (best < 0 || cost < best_cost){
+                best = i;
+                best_cost = cost;
+            }
+        }
+        if (best < 0 || (best_cost > 0 && dirty->count < MAX_DIRTY_RECTS)){
+            dirty->rects[dirty->count++] = r;
+            return;
+        }
+        // merge and re-insert, as the grown region might now be worth merging with another one.
+        r = region_union(dirty->rects[best], r);
+        dirty->rects[best] = dirty->rects[--dirty->count];
+    }
+}
+
+static void dirty_clear(dirty_t *dirty){
+    dirty->count = 0;
+    dirty->reload_texture = false;
 }
 
 struct canvas_t{
-    Image buffer;
+    Image buffer; // always PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    tilemap_t tiles; // copy-on-write version of the buffer, shared with the history. NULL until the history needs the tile.
+    bool *stale_tiles; // tiles that were modified in the buffer, but not yet in tiles.
+    tile_pool_t pool;
     Vector2 size;
-    Texture2D texture;
+    texture_grid_t grids[CANVAS_MAX_MIP_LEVEL + 1]; // textures of the buffer and of each mip level
+    mip_level_t mips[CANVAS_MAX_MIP_LEVEL + 1]; // level 0 is the buffer itself and unused
+    int mip_count; // number of allocated levels, including level 0. Levels are allocated on first use.
     recorder_t rec;
-    diff_deq_t draw_queue;
+    dirty_t dirty;
+    Color *upload_buffer; // staging area for regions that are not contiguous in the buffer.
+    size_t upload_buffer_size;
+    canvas_frame_stats_t stats;
     size_t action_counter;
+    threadpool_t *workers; // started on first use
+    bool headless; // no texture, can be used without a window
+    rawfile_t *raw; // mapped file that holds the buffer, NULL if the buffer is allocated
 };
 
 // --- API ---
 
-canvas_t *canvas_new(Image content){
+// takes ownership of buffer, which has to be R8G8B8A8.
+static canvas_t *canvas_createFromBuffer(Image buffer, bool headless){
     canvas_t *new = calloc(1, sizeof(*new));
-    new->buffer = ImageCopy(content);
-    new->texture = loadImageAsTexture(&content);
-    new->size = (Vector2){content.width, content.height};
+    new->buffer = buffer;
+    new->headless = headless;
+    new->dirty.reload_texture = true;
+    new->size = (Vector2){buffer.width, buffer.height};
+    // the buffer holds the content of missing tiles, so opening copies nothing. This matters for large mapped files.
+    new->tiles = tilemap_new(buffer.width, buffer.height);
+    new->stale_tiles = calloc(tilemap_count(&new->tiles), sizeof(*new->stale_tiles));
+    new->rec.pool = &new->pool;
+    new->rec.budget = DEFAULT_HISTORY_BUDGET;
+    return new;
+}
+
+static canvas_t *canvas_create(Image content, bool headless){
+    Image buffer = ImageCopy(content);
+    ImageFormat(&buffer, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    return canvas_createFromBuffer(buffer, headless);
+}
+
+canvas_t *canvas_new(Image content){
+    return canvas_create(content, false);
+}
+
+canvas_t *canvas_newHeadless(Image content){
+    return canvas_create(content, true);
+}
+
+static canvas_t *canvas_createRaw(const char *path, bool copy_on_write, bool headless){
+    uint64_t start = trace_begin();
+    rawfile_t *raw = rawfile_open(path, copy_on_write);
+    if (raw == NULL) return NULL;
+    canvas_t *new = canvas_createFromBuffer(rawfile_getImage(raw), headless);
+    new->raw = raw;
+    trace_end(__func__, start);
     return new;
 }
 
+canvas_t *canvas_newRaw(const char *path, bool copy_on_write){
+    return canvas_createRaw(path, copy_on_write, false);
+}
+
+canvas_t *canvas_newRawHeadless(const char *path, bool copy_on_write){
+    return canvas_createRaw(path, copy_on_write, true);
+}
+
+static void canvas_freeBuffer(canvas_t *canvas){
+    if (canvas->raw != NULL){
+        rawfile_close(canvas->raw);
+        canvas->raw = NULL;
+    } else {
+        UnloadImage(canvas->buffer);
+    }
+    canvas->buffer = (Image){0};
+}
+
 void canvas_free(canvas_t *canvas){
-    UnloadTexture(canvas->texture);
-    UnloadImage(canvas->buffer);
-    deq_free(canvas->draw_queue);
+    canvas_freeLevels(canvas);
+    canvas_freeBuffer(canvas);
+    free(canvas->upload_buffer);
     recorder_free(&canvas->rec);
+    tilemap_free(&canvas->pool, &canvas->tiles);
+    free(canvas->stale_tiles);
+    threadpool_free(canvas->workers);
     free(canvas);
 }
 
@@ -147,44 +593,151 @@ void canvas_free(canvas_t *canvas){
 
 // -- modifying function
 
-static void __canvas_queue_diff(canvas_t *canvas, diff_t diff, DIRECTION dir){
-    if (diff.type == INVALID_DIFF) return;
+// queue the modified pixels for upload, and for the next save of a mapped file.
+static inline void canvas_markModified(canvas_t *canvas, region_t r){
+    dirty_add(&canvas->dirty, r);
+    if (canvas->raw != NULL) rawfile_markModified(canvas->raw, r.x0, r.y0, r.x1, r.y1);
+}
+
+// bring tiles up to date with pixels modified in the buffer. Missing tiles stay missing, the buffer is their content.
+static void canvas_syncTiles(canvas_t *canvas){
+    for (size_t i = 0; i < tilemap_count(&canvas->tiles); i++){
+        if (canvas->stale_tiles[i] && canvas->tiles.tiles[i] == NULL){
+            canvas->stale_tiles[i] = false;
+        } else if (canvas->stale_tiles[i]){
+            canvas->rec.live_bytes -= tile_getMemory(canvas->tiles.tiles[i]);
+            tilemap_updateTile(&canvas->pool, &canvas->tiles, i, canvas->buffer);
+            canvas->rec.live_bytes += tile_getMemory(canvas->tiles.tiles[i]);
+            canvas->stale_tiles[i] = false;
+        }
+    }
+}
+
+// copy the missing tiles from the buffer, before the history takes a snapshot of the content.
+static void canvas_createTiles(canvas_t *canvas){
+    for (size_t i = 0; i < tilemap_count(&canvas->tiles); i++){
+        if (canvas->tiles.tiles[i] == NULL){
+            tilemap_updateTile(&canvas->pool, &canvas->tiles, i, canvas->buffer);
+            canvas->rec.live_bytes += tile_getMemory(canvas->tiles.tiles[i]);
+            canvas->stale_tiles[i] = false;
+        }
+    }
+}
+
+// set buffer to the content of the tiles. Only tiles that differ from the current state are copied.
+// a whole new image is never written into a mapped file, the canvas lets go of the file instead.
+static void canvas_applyTiles(canvas_t *canvas, const tilemap_t *tiles){
+    bool size_changed = !tilemap_sameSize(&canvas->tiles, tiles);
+    bool new_buffer = size_changed || canvas->raw != NULL;
+    if (new_buffer){
+        canvas_freeBuffer(canvas);
+        canvas->buffer = GenImageColor(tiles->width, tiles->height, BLANK);
+        canvas->dirty.reload_texture = true;
+    }
+    if (size_changed){
+        free(canvas->stale_tiles);
+        canvas->stale_tiles = calloc(tilemap_count(tiles), sizeof(*canvas->stale_tiles));
+    }
+    for (size_t i = 0; i < tilemap_count(tiles); i++){
+        if (new_buffer || canvas->stale_tiles[i] || canvas->tiles.tiles[i] != tiles->tiles[i]){
+            tilemap_drawTile(&canvas->pool, tiles, i, &canvas->buffer);
+            Rectangle rect = tilemap_tileRect(tiles, i);
+            canvas_markModified(canvas, (region_t){rect.x, rect.y, rect.x + rect.width, rect.y + rect.height});
+            canvas->stale_tiles[i] = false;
+        }
+    }
+    // tiles that are no longer displayed are only needed for the history.
+    for (size_t i = 0; i < tilemap_count(&canvas->tiles); i++){
+        tile_t *old = canvas->tiles.tiles[i];
+        bool is_kept = tilemap_tileAt(tiles, i % canvas->tiles.columns, i / canvas->tiles.columns) == old;
+        if (old != NULL && !is_kept && old->refs > 1) tile_compress(&canvas->pool, old);
+    }
+    tilemap_free(&canvas->pool, &canvas->tiles);
+    canvas->tiles = tilemap_copy(tiles);
+    canvas->rec.live_bytes = tilemap_memory(&canvas->tiles);
+    canvas->size.x = canvas->buffer.width;
+    canvas->size.y = canvas->buffer.height;
+}
+
+// set the part of the buffer covered by region to its tiles. The rest of the canvas is left untouched.
+static void canvas_applyRegion(canvas_t *canvas, const tilemap_t *region){
+    int first_column = region->x / TILE_SIZE, first_row = region->y / TILE_SIZE;
+    for (size_t i = 0; i < tilemap_count(region); i++){
+        size_t idx = (size_t)(first_row + i / region->columns)*canvas->tiles.columns + first_column + i % region->columns;
+        tile_t *old = canvas->tiles.tiles[idx];
+        tile_t *new = region->tiles[i];
+        if (old != NULL) canvas->rec.live_bytes -= tile_getMemory(old);
+        if (canvas->stale_tiles[idx] || old != new){
+            tilemap_drawTile(&canvas->pool, region, i, &canvas->buffer);
+            Rectangle rect = tilemap_tileRect(region, i);
+            canvas_markModified(canvas, (region_t){rect.x, rect.y, rect.x + rect.width, rect.y + rect.height});
+            canvas->stale_tiles[idx] = false;
+        }
+        if (old != new){
+            canvas->tiles.tiles[idx] = tile_ref(new);
+            // tiles that are no longer displayed are only needed for the history.
+            if (old != NULL && old->refs > 1) tile_compress(&canvas->pool, old);
+            tile_unref(&canvas->pool, old);
+        }
+        canvas->rec.live_bytes += tile_getMemory(new);
+    }
+}
 
-    if (dir == DIRECTION_REVERSE){
-        delta_t temp = diff.before;
-        diff.before = diff.after;
-        diff.after = temp;
+static inline void canvas_drawPixel(canvas_t *canvas, int x, int y, Color color){
+    ((Color*)canvas->buffer.data)[(size_t)y*canvas->buffer.width + x] = color;
+    canvas_markModified(canvas, (region_t){x, y, x+1, y+1});
+    canvas->stale_tiles[(y / TILE_SIZE)*canvas->tiles.columns + x / TILE_SIZE] = true;
+}
+
+// replay a whole stroke. Reverse direction restores the pixels in the opposite painting order.
+static void canvas_applyStroke(canvas_t *canvas, const stroke_t *stroke, DIRECTION dir){
+    for (size_t n = 0; n < stroke->count; n++){
+        const stroke_pixel_t *pixel = &stroke->pixels[dir == DIRECTION_FORWARD? n : stroke->count - 1 - n];
+        canvas_drawPixel(canvas, pixel->idx % stroke->width, pixel->idx / stroke->width, dir == DIRECTION_FORWARD? pixel->after : pixel->before);
     }
-    deq_push(canvas->draw_queue, diff);
+}
 
-    // modify buffer
-    delta_t delta = diff.after;
+// return true if the size of the canvas changed
+static bool canvas_applyDiff(canvas_t *canvas, diff_t diff, DIRECTION dir){
     switch (diff.type){
-        case PIXEL_DIFF:{
-            Color color = delta.pixel.color;
-            ImageDrawPixel(&canvas->buffer, delta.pixel.pos.x, delta.pixel.pos.y, color);
-        } break;
-        case IMAGE_DIFF:{
-            canvas->buffer = ImageCopy(delta.image); // TODO: properly free the initial buffer on exit / when it is no longer in the undo queue.
-            canvas->size.x = canvas->buffer.width;
-            canvas->size.y = canvas->buffer.height;
-        } break;
-        case INVALID_DIFF: /*what the hell man (unreachable)*/ break;
+        case STROKE_DIFF: canvas_applyStroke(canvas, diff.stroke, dir); break;
+        case IMAGE_DIFF: {
+            canvas_applyTiles(canvas, dir == DIRECTION_FORWARD? &diff.image.after : &diff.image.before);
+            return !tilemap_sameSize(&diff.image.before, &diff.image.after);
+        }
+        case REGION_DIFF: canvas_applyRegion(canvas, dir == DIRECTION_FORWARD? &diff.image.after : &diff.image.before); break;
+        case INVALID_DIFF: break;
     }
+    return false;
 }
 
 void canvas_setPixel(canvas_t *canvas, Vector2 pixel, Color color){
-    Color old_color = GetImageColor(canvas->buffer, pixel.x, pixel.y);
-    diff_t diff = {.type=PIXEL_DIFF, .before.pixel={pixel, old_color}, .after.pixel={pixel, color}, .action_id=canvas->action_counter};
-    recorder_record(&canvas->rec, diff);
-    __canvas_queue_diff(canvas, diff, DIRECTION_FORWARD);
+    if (pixel.x < 0 || pixel.y < 0 || pixel.x >= canvas->buffer.width || pixel.y >= canvas->buffer.height) return;
+    int x = pixel.x, y = pixel.y;
+    unsigned int idx = (unsigned int)y*canvas->buffer.width + x;
+    stroke_pixel_t change = {.idx=idx, .before=((Color*)canvas->buffer.data)[idx], .after=color};
+    recorder_record_pixel(&canvas->rec, canvas->action_counter, canvas->buffer.width, change);
+    canvas_drawPixel(canvas, x, y, color);
 }
 
 void canvas_setToImage(canvas_t *canvas, Image image){
-    // FIXME: using canvas->buffer might have unwanted implications on free.
-    diff_t diff = {.type=IMAGE_DIFF, .before.image=canvas->buffer, .after.image=ImageCopy(image), .action_id=0}; // TODO: make images part of action_counter
+    uint64_t start = trace_begin();
+    Image formatted = image;
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8){
+        formatted = ImageCopy(image);
+        ImageFormat(&formatted, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+    canvas_syncTiles(canvas);
+    canvas_createTiles(canvas);
+    // only tiles that differ from the current content take up new memory.
+    tilemap_t after = tilemap_fromImage(&canvas->pool, formatted, &canvas->tiles);
+    if (formatted.data != image.data) UnloadImage(formatted);
+
+    diff_t diff = {.type=IMAGE_DIFF, .image.before=tilemap_copy(&canvas->tiles), .image.after=after, .action_id=0}; // TODO: make images part of action_counter
+    // applied first, so that the budget is enforced with the new content no longer counted as history.
+    canvas_applyDiff(canvas, diff, DIRECTION_FORWARD);
     recorder_record(&canvas->rec, diff);
-    __canvas_queue_diff(canvas, diff, DIRECTION_FORWARD);
+    trace_end(__func__, start);
 }
 
 // start of a drawing action that groups the pixels of following canvas calls.
@@ -193,27 +746,26 @@ void canvas_nextPixelStroke(canvas_t *canvas){
     if (canvas->action_counter == 0) canvas->action_counter += 1;
 }
 
+// decompress the tiles that dir leads to, before anything of the canvas is changed.
+static bool canvas_loadDiff(canvas_t *canvas, diff_t diff, DIRECTION dir){
+    if (diff.type != IMAGE_DIFF && diff.type != REGION_DIFF) return true;
+    return tilemap_decompress(&canvas->pool, dir == DIRECTION_FORWARD? &diff.image.after : &diff.image.before);
+}
+
+// every recorded diff is a complete action (a whole stroke or an image change).
 // return true if the size of the canvas changed
 static bool canvas_retrace(canvas_t *canvas, DIRECTION dir){
-    bool size_changed = false;
     diff_t diff = recorder_wind(&canvas->rec, dir);
-    size_t action_id = diff.action_id;
-    do {
-        switch(diff.type){
-            case INVALID_DIFF: printf("reached the end of recorded changes\n");break; // TODO: present in UI
-            case PIXEL_DIFF: __canvas_queue_diff(canvas, diff, dir); break;
-            case IMAGE_DIFF: {
-                __canvas_queue_diff(canvas, diff, dir);
-                size_changed |= diff.before.image.width != diff.after.image.width || diff.before.image.height != diff.after.image.height;
-            } break;
-        }
-        diff = recorder_wind(&canvas->rec, dir);
-        if (diff.type != INVALID_DIFF && (action_id == 0 || diff.action_id != action_id)){
-            recorder_wind(&canvas->rec, !dir);
-            break;
-        }
-    } while(action_id != 0 && action_id == diff.action_id && diff.type != INVALID_DIFF);
-    return size_changed;
+    if (diff.type == INVALID_DIFF){
+        printf("reached the end of recorded changes\n"); // TODO: present in UI
+        return false;
+    }
+    if (!canvas_loadDiff(canvas, diff, dir)){
+        printf("[HISTORY] ERROR: unable to restore a change, its tiles are damaged or memory is exhausted\n");
+        recorder_wind(&canvas->rec, dir == DIRECTION_FORWARD? DIRECTION_REVERSE : DIRECTION_FORWARD); // the change stays where it was
+        return false;
+    }
+    return canvas_applyDiff(canvas, diff, dir);
 }
 
 // -- query functions
@@ -226,32 +778,263 @@ inline Color canvas_getPixel(canvas_t *canvas, Vector2 pixel){
     return GetImageColor(canvas->buffer, pixel.x, pixel.y);
 }
 
-// this function has the side effect of evaluating and applying any queued modifications to the texture.
-Texture2D canvas_nextFrame(canvas_t *canvas){
-    while(deq_size(canvas->draw_queue) > 0){
-        diff_t diff = deq_poll(canvas->draw_queue);
-        switch(diff.type){
-            case IMAGE_DIFF: {
-                Image image = diff.after.image;
-                if (IsImageReady(image)){
-                    setTextureToImage(&canvas->texture, &image);
-                    canvas->size.x = image.width;
-                    canvas->size.y = image.height;
-                }
-            } break;
-            case PIXEL_DIFF: {
-                pixel_t pixel = diff.after.pixel;
-                Rectangle rect = {pixel.pos.x, pixel.pos.y, 1, 1};
-                UpdateTextureRec(canvas->texture, rect, &pixel.color);
-            } break;
-            case INVALID_DIFF: break;
+// upload the part of source covered by region to the texture, with a single call.
+static void canvas_uploadRegion(canvas_t *canvas, const Image *source, const canvas_texture_t *texture, region_t r){
+    int width = r.x1 - r.x0, height = r.y1 - r.y0;
+    if (width <= 0 || height <= 0) return;
+    Color *pixels = (Color*)source->data;
+    Color *data = pixels + (size_t)r.y0*source->width + r.x0;
+    // full rows are contiguous in the buffer and can be uploaded without staging.
+    if (width != source->width){
+        size_t needed = (size_t)width*height;
+        if (canvas->upload_buffer_size < needed){
+            canvas->upload_buffer = realloc(canvas->upload_buffer, needed*sizeof(*canvas->upload_buffer));
+            canvas->upload_buffer_size = needed;
+        }
+        for (int y = 0; y < height; y++){
+            memcpy(canvas->upload_buffer + (size_t)y*width, data + (size_t)y*source->width, width*sizeof(Color));
+        }
+        data = canvas->upload_buffer;
+    }
+    UpdateTextureRec(texture->texture, (Rectangle){r.x0 - texture->rect.x, r.y0 - texture->rect.y, width, height}, data);
+    canvas->stats.uploads++;
+    canvas->stats.upload_bytes += (size_t)width*height*sizeof(Color);
+}
+
+static bool region_isEmpty(region_t r){
+    return r.x0 >= r.x1 || r.y0 >= r.y1;
+}
+
+static region_t region_intersect(region_t a, region_t b){
+    return (region_t){MAX(a.x0, b.x0), MAX(a.y0, b.y0), MIN(a.x1, b.x1), MIN(a.y1, b.y1)};
+}
+
+static region_t region_fromRect(Rectangle rect){
+    return (region_t){rect.x, rect.y, rect.x + rect.width, rect.y + rect.height};
+}
+
+// the region covering r at a level with 1/2^level of the resolution.
+static region_t region_atLevel(region_t r, int level){
+    return (region_t){r.x0 >> level, r.y0 >> level, ((r.x1 - 1) >> level) + 1, ((r.y1 - 1) >> level) + 1};
+}
+
+// -- texture grids
+
+// range of textures covering r, with last_column and last_row inclusive.
+static void grid_range(const texture_grid_t *grid, region_t r, int *first_column, int *first_row, int *last_column, int *last_row){
+    *first_column = MAX(r.x0, 0) / TEXTURE_TILE_SIZE;
+    *first_row = MAX(r.y0, 0) / TEXTURE_TILE_SIZE;
+    *last_column = MIN((r.x1 - 1) / TEXTURE_TILE_SIZE, grid->columns - 1);
+    *last_row = MIN((r.y1 - 1) / TEXTURE_TILE_SIZE, grid->rows - 1);
+}
+
+static void grid_free(texture_grid_t *grid){
+    for (int i = 0; i < grid->columns*grid->rows; i++){
+        if (grid->textures[i].texture.id != 0) UnloadTexture(grid->textures[i].texture);
+    }
+    free(grid->textures);
+    free(grid->pending);
+    free(grid->visible);
+    *grid = (texture_grid_t){0};
+}
+
+// new grid of textures for an image of width x height. Everything is pending.
+static void grid_reset(texture_grid_t *grid, int width, int height){
+    grid_free(grid);
+    grid->columns = (width + TEXTURE_TILE_SIZE - 1) / TEXTURE_TILE_SIZE;
+    grid->rows = (height + TEXTURE_TILE_SIZE - 1) / TEXTURE_TILE_SIZE;
+    int count = grid->columns*grid->rows;
+    grid->textures = calloc(count, sizeof(*grid->textures));
+    grid->pending = calloc(count, sizeof(*grid->pending));
+    grid->visible = calloc(count, sizeof(*grid->visible));
+    for (int i = 0; i < count; i++){
+        int x = i % grid->columns * TEXTURE_TILE_SIZE, y = i / grid->columns * TEXTURE_TILE_SIZE;
+        grid->textures[i].rect = (Rectangle){x, y, MIN(TEXTURE_TILE_SIZE, width - x), MIN(TEXTURE_TILE_SIZE, height - y)};
+        grid->pending[i] = region_fromRect(grid->textures[i].rect);
+    }
+}
+
+// modified pixels are uploaded right away if the texture is visible, and kept as pending otherwise.
+static void canvas_gridModified(canvas_t *canvas, texture_grid_t *grid, const Image *source, region_t r, region_t view){
+    int first_column, first_row, last_column, last_row;
+    grid_range(grid, r, &first_column, &first_row, &last_column, &last_row);
+    for (int row = first_row; row <= last_row; row++){
+        for (int column = first_column; column <= last_column; column++){
+            int i = row*grid->columns + column;
+            region_t part = region_intersect(r, region_fromRect(grid->textures[i].rect));
+            bool is_visible = !region_isEmpty(region_intersect(view, region_fromRect(grid->textures[i].rect)));
+            if (is_visible && grid->textures[i].texture.id != 0 && region_isEmpty(grid->pending[i])){
+                canvas_uploadRegion(canvas, source, &grid->textures[i], part);
+            } else {
+                grid->pending[i] = region_isEmpty(grid->pending[i])? part : region_union(grid->pending[i], part);
+            }
+        }
+    }
+}
+
+// upload the pending part of a visible texture, creating the texture if necessary. Returns false if the texture can't be created.
+static bool canvas_gridUpdate(canvas_t *canvas, texture_grid_t *grid, const Image *source, int i, bool smooth){
+    canvas_texture_t *texture = &grid->textures[i];
+    if (texture->texture.id == 0){
+        Image empty = {.data=NULL, .width=texture->rect.width, .height=texture->rect.height, .mipmaps=1, .format=PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        texture->texture = LoadTextureFromImage(empty);
+        if (!IsTextureReady(texture->texture)){
+            texture->texture = (Texture2D){0};
+            return false;
+        }
+        if (smooth) SetTextureFilter(texture->texture, TEXTURE_FILTER_BILINEAR);
+    }
+    canvas_uploadRegion(canvas, source, texture, grid->pending[i]);
+    grid->pending[i] = (region_t){0};
+    return true;
+}
+
+// bring the textures intersecting view up to date and return them.
+static canvas_frame_t canvas_gridFrame(canvas_t *canvas, texture_grid_t *grid, const Image *source, region_t view, bool smooth){
+    canvas_frame_t frame = {.textures=grid->visible, .count=0};
+    if (region_isEmpty(view)) return frame;
+    int first_column, first_row, last_column, last_row;
+    grid_range(grid, view, &first_column, &first_row, &last_column, &last_row);
+    for (int row = first_row; row <= last_row; row++){
+        for (int column = first_column; column <= last_column; column++){
+            int i = row*grid->columns + column;
+            bool is_current = grid->textures[i].texture.id != 0 && region_isEmpty(grid->pending[i]);
+            if (is_current || canvas_gridUpdate(canvas, grid, source, i, smooth)){
+                grid->visible[frame.count++] = grid->textures[i];
+            }
+        }
+    }
+    return frame;
+}
+
+// -- mip levels
+
+static const Image *canvas_levelImage(canvas_t *canvas, int level){
+    return level == 0? &canvas->buffer : &canvas->mips[level].image;
+}
+
+static void mip_markStale(mip_level_t *mip, region_t r){
+    for (int row = r.y0 / MIP_BLOCK_SIZE; row <= (r.y1 - 1) / MIP_BLOCK_SIZE; row++){
+        for (int column = r.x0 / MIP_BLOCK_SIZE; column <= (r.x1 - 1) / MIP_BLOCK_SIZE; column++){
+            mip->stale_blocks[row*mip->block_columns + column] = true;
+        }
+    }
+}
+
+// recompute the pixels of region r of level from the level above it.
+static void canvas_downsample(canvas_t *canvas, int level, region_t r){
+    const Image *src = canvas_levelImage(canvas, level - 1);
+    Image *dst = &canvas->mips[level].image;
+    const Color *in = src->data;
+    Color *out = dst->data;
+    for (int y = r.y0; y < r.y1; y++){
+        const Color *row0 = in + (size_t)(2*y)*src->width;
+        const Color *row1 = 2*y + 1 < src->height? row0 + src->width : row0;
+        for (int x = r.x0; x < r.x1; x++){
+            int x0 = 2*x, x1 = 2*x + 1 < src->width? 2*x + 1 : 2*x;
+            Color a = row0[x0], b = row0[x1], c = row1[x0], d = row1[x1];
+            out[(size_t)y*dst->width + x] = (Color){
+                (a.r + b.r + c.r + d.r + 2) / 4, (a.g + b.g + c.g + d.g + 2) / 4,
+                (a.b + b.b + c.b + d.b + 2) / 4, (a.a + b.a + c.a + d.a + 2) / 4,
+            };
+        }
+    }
+}
+
+// allocate the levels up to level, which are computed completely on their first update.
+static void canvas_allocMips(canvas_t *canvas, int level){
+    for (int k = canvas->mip_count; k <= level; k++){
+        if (k == 0) continue;
+        const Image *above = canvas_levelImage(canvas, k - 1);
+        mip_level_t *mip = &canvas->mips[k];
+        mip->image = GenImageColor((above->width + 1) / 2, (above->height + 1) / 2, BLANK);
+        mip->block_columns = (mip->image.width + MIP_BLOCK_SIZE - 1) / MIP_BLOCK_SIZE;
+        mip->block_rows = (mip->image.height + MIP_BLOCK_SIZE - 1) / MIP_BLOCK_SIZE;
+        mip->stale_blocks = malloc((size_t)mip->block_columns*mip->block_rows*sizeof(*mip->stale_blocks));
+        memset(mip->stale_blocks, true, (size_t)mip->block_columns*mip->block_rows*sizeof(*mip->stale_blocks));
+        grid_reset(&canvas->grids[k], mip->image.width, mip->image.height);
+    }
+    canvas->mip_count = MAX(canvas->mip_count, level + 1);
+}
+
+// recompute the stale blocks of levels 1 to level, in order, so every level reads an up to date level above it.
+static void canvas_updateMips(canvas_t *canvas, int level){
+    for (int k = 1; k <= level; k++){
+        mip_level_t *mip = &canvas->mips[k];
+        for (int i = 0; i < mip->block_columns*mip->block_rows; i++){
+            if (!mip->stale_blocks[i]) continue;
+            int x = i % mip->block_columns * MIP_BLOCK_SIZE, y = i / mip->block_columns * MIP_BLOCK_SIZE;
+            region_t block = {x, y, MIN(x + MIP_BLOCK_SIZE, mip->image.width), MIN(y + MIP_BLOCK_SIZE, mip->image.height)};
+            canvas_downsample(canvas, k, block);
+            mip->stale_blocks[i] = false;
+            canvas_gridModified(canvas, &canvas->grids[k], &mip->image, block, (region_t){0});
+        }
+    }
+}
+
+static void canvas_freeLevels(canvas_t *canvas){
+    for (int k = 0; k <= CANVAS_MAX_MIP_LEVEL; k++){
+        grid_free(&canvas->grids[k]);
+        if (k > 0 && k < canvas->mip_count){
+            UnloadImage(canvas->mips[k].image);
+            free(canvas->mips[k].stale_blocks);
         }
+        canvas->mips[k] = (mip_level_t){0};
     }
-    return canvas->texture;
+    canvas->mip_count = 0;
 }
 
-bool canvas_saveAsImage(canvas_t *canvas, const char *path){
-    if (!ExportImage(canvas->buffer, path)){
+// this function has the side effect of evaluating and applying any queued modifications to the textures.
+// modifications of textures outside of visible are kept until they become visible.
+canvas_frame_t canvas_nextFrame(canvas_t *canvas, Rectangle visible, int level){
+    canvas->stats = (canvas_frame_stats_t){0};
+    if (canvas->headless){
+        dirty_clear(&canvas->dirty);
+        return (canvas_frame_t){0};
+    }
+    if (canvas->dirty.reload_texture){
+        canvas_freeLevels(canvas);
+        grid_reset(&canvas->grids[0], canvas->buffer.width, canvas->buffer.height);
+        canvas->mip_count = 1;
+    }
+    // no level smaller than a single pixel
+    level = MAX(0, MIN(level, CANVAS_MAX_MIP_LEVEL));
+    while (level > 0 && (canvas->buffer.width >> level) == 0 && (canvas->buffer.height >> level) == 0) level--;
+    canvas_allocMips(canvas, level);
+
+    region_t view = region_intersect(region_fromRect(visible), (region_t){0, 0, canvas->buffer.width, canvas->buffer.height});
+    for (int n = 0; n < canvas->dirty.count; n++){
+        region_t r = canvas->dirty.rects[n];
+        canvas_gridModified(canvas, &canvas->grids[0], &canvas->buffer, r, level == 0? view : (region_t){0});
+        for (int k = 1; k < canvas->mip_count; k++) mip_markStale(&canvas->mips[k], region_atLevel(r, k));
+    }
+    dirty_clear(&canvas->dirty);
+
+    if (level > 0 && !region_isEmpty(view)) canvas_updateMips(canvas, level);
+    const Image *image = canvas_levelImage(canvas, level);
+    region_t level_view = region_isEmpty(view)? view : region_intersect(region_atLevel(view, level), (region_t){0, 0, image->width, image->height});
+    return canvas_gridFrame(canvas, &canvas->grids[level], image, level_view, level > 0);
+}
+
+// texture uploads of the last call to canvas_nextFrame
+inline canvas_frame_stats_t canvas_getFrameStats(canvas_t *canvas){
+    return canvas->stats;
+}
+
+inline bool canvas_isMappedTo(canvas_t *canvas, const char *path){
+    return canvas->raw != NULL && strcmp(rawfile_getPath(canvas->raw), path) == 0;
+}
+
+bool canvas_saveAsImage(canvas_t *canvas, const char *path, png_effort_t effort){
+    uint64_t start = trace_begin();
+    bool success;
+    if (canvas_isMappedTo(canvas, path)){
+        success = rawfile_save(canvas->raw); // only the changed rows
+    } else {
+        success = exportImageSafely(canvas->buffer, path, effort);
+    }
+    trace_end(__func__, start);
+    if (!success){
         perror("Error while saving image!\n");
         return false;
     }
@@ -262,18 +1045,54 @@ inline Vector2 canvas_getSize(canvas_t *canvas){
     return canvas->size;
 }
 
+// memory used by the undo history in bytes. Tiles of the current content are not included, even if the history shares them.
+inline size_t canvas_getHistorySize(canvas_t *canvas){
+    return recorder_size(&canvas->rec);
+}
+
+// bytes of the history that were moved to the journal
+size_t canvas_getJournalSize(canvas_t *canvas){
+    size_t size = canvas->rec.journal != NULL? journal_end(canvas->rec.journal) : 0;
+    return size + (canvas->rec.redo_journal != NULL? journal_end(canvas->rec.redo_journal) : 0);
+}
+
+bool canvas_enableHistoryJournal(canvas_t *canvas, const char *path){
+    if (canvas->rec.journal != NULL) return true;
+    char *redo_path = malloc(strlen(path) + sizeof(".redo"));
+    if (redo_path == NULL) return false;
+    sprintf(redo_path, "%s.redo", path);
+    canvas->rec.journal = journal_open(path);
+    canvas->rec.redo_journal = canvas->rec.journal != NULL? journal_open(redo_path) : NULL;
+    free(redo_path);
+    if (canvas->rec.redo_journal == NULL){
+        journal_close(canvas->rec.journal);
+        canvas->rec.journal = NULL;
+        return false;
+    }
+    return true;
+}
+
+void canvas_setHistoryBudget(canvas_t *canvas, size_t bytes){
+    canvas->rec.budget = bytes;
+    recorder_enforce_budget(&canvas->rec);
+}
+
 // functions indirectly interacting with canvas struct
 
 // return true if the size of the canvas changed
 bool canvas_undo(canvas_t *canvas){
-    printf("undo\n");
-    return canvas_retrace(canvas, DIRECTION_REVERSE);
+    uint64_t start = trace_begin();
+    bool resized = canvas_retrace(canvas, DIRECTION_REVERSE);
+    trace_end(__func__, start);
+    return resized;
 }
 
 // return true if the size of the canvas changed
 bool canvas_redo(canvas_t *canvas){
-    printf("redo\n");
-    return canvas_retrace(canvas, DIRECTION_FORWARD);
+    uint64_t start = trace_begin();
+    bool resized = canvas_retrace(canvas, DIRECTION_FORWARD);
+    trace_end(__func__, start);
+    return resized;
 }
 
 void canvas_blendPixel(canvas_t *canvas, Vector2 pixel, Color color){
@@ -286,52 +1105,71 @@ void canvas_blendPixel(canvas_t *canvas, Vector2 pixel, Color color){
 }
 
 void canvas_resize(canvas_t *canvas, Vector2 new_size, Color fill){
+    uint64_t start = trace_begin();
     Image image = canvas_getContent(canvas);
     ImageResizeCanvasOwn(&image, new_size.x, new_size.y, 0, 0, fill);
     canvas_setToImage(canvas, image);
     UnloadImage(image);
+    trace_end(__func__, start);
 }
 
 // factor > 1 increases resolution, factor < 1 decreases resolution.
 void canvas_changeResolution(canvas_t *canvas, float factor){
+    uint64_t start = trace_begin();
     Image image = canvas_getContent(canvas);
     ImageResizeNN(&image, factor*image.width, factor*image.height); // seems to just use top left corner when down-scaling 0.5x to determine color??
     canvas_setToImage(canvas, image);
     UnloadImage(image);
+    trace_end(__func__, start);
 }
 
-void canvas_colorFlood(canvas_t *canvas, Vector2 source, Color flood){
-    Image image = canvas_getContent(canvas);
-    imageColorFlood(&image, source, flood);
-    canvas_setToImage(canvas, image);
-    UnloadImage(image);
-}
+// record a fill that was done in place on the buffer, with filled as the bounding box of the changes.
+// only the tiles around the filled area are recorded. The tiles have to be in sync with the buffer before the fill, and exist.
+// The area is only known after the fill, so fills create all missing tiles up front.
+static void canvas_recordFill(canvas_t *canvas, Rectangle filled){
+    if (filled.width == 0) return;
+    int x0 = filled.x, y0 = filled.y, x1 = filled.x + filled.width, y1 = filled.y + filled.height;
+    int column = x0 / TILE_SIZE, row = y0 / TILE_SIZE;
+    int columns = (x1 - 1) / TILE_SIZE - column + 1, rows = (y1 - 1) / TILE_SIZE - row + 1;
 
-
-// -- utility functions --
-
-// changes image and texture to PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
-static Texture2D loadImageAsTexture(Image *image){
-    ImageFormat(image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
-    Texture2D buffer = LoadTextureFromImage(*image);
-    assert(buffer.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
-    return buffer;
+    diff_t diff = {.type=REGION_DIFF, .image.before=tilemap_region(&canvas->tiles, column, row, columns, rows), .action_id=0};
+    for (int r = row; r < row + rows; r++){
+        for (int c = column; c < column + columns; c++){
+            canvas->stale_tiles[(size_t)r*canvas->tiles.columns + c] = true;
+        }
+    }
+    canvas_syncTiles(canvas);
+    diff.image.after = tilemap_region(&canvas->tiles, column, row, columns, rows);
+    recorder_record(&canvas->rec, diff);
+    canvas_markModified(canvas, (region_t){x0, y0, x1, y1});
 }
 
-// replaces the existing texture and unloads it. Returns true on success.
-static bool setTextureToImage(Texture2D *texture, Image *image){
-    Texture2D new_buffer = loadImageAsTexture(image);
-    if (!IsTextureReady(new_buffer)){
-        UnloadTexture(new_buffer);
-        // TODO: fail operation
-        return false;
-    } else {
-        UnloadTexture(*texture);
-        *texture = new_buffer;
-        return true;
+void canvas_colorFlood(canvas_t *canvas, Vector2 source, Color flood, int tolerance){
+    uint64_t start = trace_begin();
+    canvas_syncTiles(canvas);
+    canvas_createTiles(canvas);
+    threadpool_t *workers = NULL;
+    if ((size_t)canvas->buffer.width*canvas->buffer.height >= PARALLEL_FLOOD_PIXELS){
+        if (canvas->workers == NULL) canvas->workers = threadpool_new(0);
+        workers = canvas->workers;
     }
+    canvas_recordFill(canvas, imageColorFloodParallel(&canvas->buffer, source.x, source.y, flood, tolerance, workers));
+    trace_end(__func__, start);
+}
+
+void canvas_colorReplace(canvas_t *canvas, Vector2 source, Color color, int tolerance){
+    if (source.x < 0 || source.y < 0 || source.x >= canvas->buffer.width || source.y >= canvas->buffer.height) return;
+    uint64_t start = trace_begin();
+    canvas_syncTiles(canvas);
+    canvas_createTiles(canvas);
+    Color target = canvas_getPixel(canvas, source);
+    canvas_recordFill(canvas, imageColorReplace(&canvas->buffer, target, color, tolerance));
+    trace_end(__func__, start);
 }
 
+
+// -- utility functions --
+
 // fill color for resize is not implemented yet in raylib, so do it here.
 static void ImageResizeCanvasOwn(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill){  // Resize canvas and fill with color
     int oldWidth = image->width;
@@ -355,69 +1193,3 @@ static void ImageResizeCanvasOwn(Image *image, int newWidth, int newHeight, int
         }
     }
 }
-
-static void imageColorFlood(Image *image, Vector2 source_pixel, Color new_color){
-    Color old_color = GetImageColor(*image, source_pixel.x, source_pixel.y);
-
-    Color *pixels = (Color*)image->data;
-    size_t pixel_count = image->height * image->width;
-    size_t *stack = NULL;
-    stack_reserve_capacity(stack, pixel_count);
-    bool *visited = malloc(pixel_count * sizeof(*visited));
-    if (visited == NULL){
-        perror("unable to allocate sufficient memory\n");
-        stack_free(stack);
-        free(visited);
-        return;
-    }
-
-    memset(visited, 0, pixel_count * sizeof(*visited));
-
-    size_t source_pixel_idx = (int)source_pixel.x + (int)source_pixel.y * image->width;
-    stack_push(stack, source_pixel_idx);
-
-    while(stack_size(stack) > 0){
-        size_t pixel_idx = stack_pop(stack);
-        pixels[pixel_idx] = new_color;
-
-        if (pixel_idx >= 1 && pixel_idx % image->width > 0){ // is not wrapping left to the previous row.
-            size_t west = pixel_idx - 1;
-            if (memcmp(&pixels[west], &old_color, sizeof(old_color)) == 0){
-                if (!visited[west]){
-                    stack_push(stack, west);
-                    visited[west] = true;
-                }
-            }
-        }
-        if (pixel_idx < pixel_count - 1 && (pixel_idx % image->width) + 1 < (size_t)image->width){ // is not wrapping right to the next row.
-            size_t east = pixel_idx + 1;
-            if (memcmp(&pixels[east], &old_color, sizeof(old_color)) == 0){
-                if (!visited[east]){
-                    stack_push(stack, east);
-                    visited[east] = true;
-                }
-            }
-        }
-        if (pixel_idx < pixel_count - image->width){
-            size_t south = pixel_idx + image->width;
-            if (memcmp(&pixels[south], &old_color, sizeof(old_color)) == 0){
-                if (!visited[south]){
-                    stack_push(stack, south);
-                    visited[south] = true;
-                }
-            }
-        }
-        if (pixel_idx >= (size_t)image->width){
-            size_t north = pixel_idx - image->width;
-            if (memcmp(&pixels[north], &old_color, sizeof(old_color)) == 0){
-                if (!visited[north]){
-                    stack_push(stack, north);
-                    visited[north] = true;
-                }
-            }
-        }
-    }
-
-    stack_free(stack);
-    free(visited);
-}
@@ -23,16 +23,57 @@
 #ifndef __CANVAS_H
 #define __CANVAS_H
 
+#include <stdbool.h>
+#include <stddef.h>
+
 #include "external/raylib/src/raylib.h"
 
+#include "png.h"
+
+// default memory limit of the undo history
+#ifndef DEFAULT_HISTORY_BUDGET
+#define DEFAULT_HISTORY_BUDGET ((size_t)512 << 20)
+#endif //DEFAULT_HISTORY_BUDGET
+
 // all fields are readonly
 typedef struct canvas_t canvas_t;
 
+typedef struct canvas_frame_stats_t {
+    size_t uploads;      // calls to UpdateTextureRec / texture reloads
+    size_t upload_bytes; // pixel data sent to the gpu
+} canvas_frame_stats_t;
+
 canvas_t *canvas_new(Image content);
+// canvas without a texture, that only keeps the pixels and the history. Requires no window or GL context.
+canvas_t *canvas_newHeadless(Image content);
+// canvas that edits a memory mapped .raw file (see rawfile.h) in place, instead of a copy of its pixels.
+// copy_on_write keeps the changes out of the file until it is saved, otherwise they are written to it as they happen.
+// the file is released once the whole image is replaced (load, resize, undo to before the file), later saves write a new file.
+// returns NULL if the file can not be mapped.
+canvas_t *canvas_newRaw(const char *path, bool copy_on_write);
+// mapped .raw file for a canvas without a texture, see canvas_newRaw and canvas_newHeadless.
+canvas_t *canvas_newRawHeadless(const char *path, bool copy_on_write);
 void canvas_free(canvas_t *canvas);
 
-// do not modify or unload the returned texture. it is still owned by the canvas!
-Texture2D canvas_nextFrame(canvas_t *canvas);
+// part of the canvas on the gpu. The canvas is split into several textures, because the size of a single texture is limited.
+typedef struct canvas_texture_t {
+    Texture2D texture;
+    Rectangle rect; // covered pixels of the canvas
+} canvas_texture_t;
+
+typedef struct canvas_frame_t {
+    const canvas_texture_t *textures; // owned by the canvas, valid until the next call to canvas_nextFrame
+    int count;
+} canvas_frame_t;
+
+// zoomed out views use a downsampled copy of the canvas. Level k has 1/2^k of the resolution.
+#define CANVAS_MAX_MIP_LEVEL 8
+
+// uploads the modified pixels of the textures of the mip level, that intersect visible (in canvas pixels), and returns these textures.
+// the rect of the returned textures is measured in pixels of the level.
+// do not modify or unload the returned textures. headless canvases return no textures.
+canvas_frame_t canvas_nextFrame(canvas_t *canvas, Rectangle visible, int level);
+canvas_frame_stats_t canvas_getFrameStats(canvas_t *canvas);
 
 void canvas_setToImage(canvas_t *canvas, Image image);
 void canvas_setPixel(canvas_t *canvas, Vector2 pixel, Color color);
@@ -43,6 +84,15 @@ Color canvas_getPixel(canvas_t *canvas, Vector2 pixel);
 
 void canvas_nextPixelStroke(canvas_t *canvas);
 
+// memory used by the undo history in bytes, without the current content
+size_t canvas_getHistorySize(canvas_t *canvas);
+// the oldest changes are dropped (or moved to the journal) once the history exceeds the budget.
+void canvas_setHistoryBudget(canvas_t *canvas, size_t bytes);
+// keep changes that exceed the budget in a memory mapped file at path, instead of dropping them.
+// redos that are paged out while undoing go to a second file at path + ".redo". Both files are deleted with the canvas.
+bool canvas_enableHistoryJournal(canvas_t *canvas, const char *path);
+size_t canvas_getJournalSize(canvas_t *canvas);
+
 // return true if the size of the canvas changed
 bool canvas_undo(canvas_t *canvas);
 bool canvas_redo(canvas_t *canvas);
@@ -52,8 +102,14 @@ void canvas_resize(canvas_t *canvas, Vector2 new_size, Color fill);
 void canvas_changeResolution(canvas_t *canvas, float factor);
 
 void canvas_blendPixel(canvas_t *canvas, Vector2 pixel, Color color);
-void canvas_colorFlood(canvas_t *canvas, Vector2 source, Color flood);
+// fill the area connected to source, whose pixels differ from the color at source by at most tolerance in every channel (0 - 255).
+void canvas_colorFlood(canvas_t *canvas, Vector2 source, Color flood, int tolerance);
+// like canvas_colorFlood, but for all matching pixels of the canvas, connected or not.
+void canvas_colorReplace(canvas_t *canvas, Vector2 source, Color color, int tolerance);
 
-bool canvas_saveAsImage(canvas_t *canvas, const char *path);
+// true if the buffer is still the mapped .raw file at path. Saving it only writes the changed rows then, which is quick.
+bool canvas_isMappedTo(canvas_t *canvas, const char *path);
+// pngs are compressed with effort, qoi files are encoded straight from the canvas buffer while writing.
+bool canvas_saveAsImage(canvas_t *canvas, const char *path, png_effort_t effort);
 
 #endif // __CANVAS_H
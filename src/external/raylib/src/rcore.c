@@ -360,36 +360,7 @@ MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
-// Automation events type
-typedef enum AutomationEventType {
-    EVENT_NONE = 0,
-    // Input events
-    INPUT_KEY_UP,                   // param[0]: key
-    INPUT_KEY_DOWN,                 // param[0]: key
-    INPUT_KEY_PRESSED,              // param[0]: key
-    INPUT_KEY_RELEASED,             // param[0]: key
-    INPUT_MOUSE_BUTTON_UP,          // param[0]: button
-    INPUT_MOUSE_BUTTON_DOWN,        // param[0]: button
-    INPUT_MOUSE_POSITION,           // param[0]: x, param[1]: y
-    INPUT_MOUSE_WHEEL_MOTION,       // param[0]: x delta, param[1]: y delta
-    INPUT_GAMEPAD_CONNECT,          // param[0]: gamepad
-    INPUT_GAMEPAD_DISCONNECT,       // param[0]: gamepad
-    INPUT_GAMEPAD_BUTTON_UP,        // param[0]: button
-    INPUT_GAMEPAD_BUTTON_DOWN,      // param[0]: button
-    INPUT_GAMEPAD_AXIS_MOTION,      // param[0]: axis, param[1]: delta
-    INPUT_TOUCH_UP,                 // param[0]: id
-    INPUT_TOUCH_DOWN,               // param[0]: id
-    INPUT_TOUCH_POSITION,           // param[0]: x, param[1]: y
-    INPUT_GESTURE,                  // param[0]: gesture
-    // Window events
-    WINDOW_CLOSE,                   // no params
-    WINDOW_MAXIMIZE,                // no params
-    WINDOW_MINIMIZE,                // no params
-    WINDOW_RESIZE,                  // param[0]: width, param[1]: height
-    // Custom events
-    ACTION_TAKE_SCREENSHOT,         // no params
-    ACTION_SETTARGETFPS             // param[0]: fps
-} AutomationEventType;
+// NOTE: AutomationEventType is defined in raylib.h (imfap)
 
 // Event type to config events flags
 // TODO: Not used at the moment
@@ -2603,10 +2574,11 @@ void PlayAutomationEvent(AutomationEvent event)
                 CORE.Input.Mouse.currentPosition.x = (float)event.params[0];
                 CORE.Input.Mouse.currentPosition.y = (float)event.params[1];
             } break;
-            case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta
+            case INPUT_MOUSE_WHEEL_MOTION:  // param[0]: x delta, param[1]: y delta, param[2]: fixed-point scale of the deltas, 0 for whole steps (imfap)
             {
-                CORE.Input.Mouse.currentWheelMove.x = (float)event.params[0]; break;
-                CORE.Input.Mouse.currentWheelMove.y = (float)event.params[1]; break;
+                float scale = (event.params[2] > 0)? (float)event.params[2] : 1.0f;
+                CORE.Input.Mouse.currentWheelMove.x = (float)event.params[0]/scale;
+                CORE.Input.Mouse.currentWheelMove.y = (float)event.params[1]/scale;
             } break;
             case INPUT_TOUCH_UP: CORE.Input.Touch.currentTouchState[event.params[0]] = false; break;            // param[0]: id
             case INPUT_TOUCH_DOWN: CORE.Input.Touch.currentTouchState[event.params[0]] = true; break;           // param[0]: id
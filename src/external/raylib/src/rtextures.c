@@ -4797,7 +4797,7 @@ int GetPixelDataSize(int width, int height, int format)
         default: break;
     }
 
-    dataSize = width*height*bpp/8;  // Total data size in bytes
+    dataSize = (int)((long long)width*height*bpp/8);  // Total data size in bytes, 64 bit product to not overflow for 8192x8192 RGBA (imfap)
 
     // Most compressed formats works on 4x4 blocks,
     // if texture is smaller, minimum dataSize is 8 or 16
@@ -29,66 +29,53 @@
 #include <string.h>
 #include <stdio.h>
 
+// size and capacity are stored in front of the first element, so that a stack is just a pointer to its elements:
+// [__stack_info][item 0][item 1]...
+// element types must not need a stricter alignment than the header.
 struct __stack_info{
-    void *stack_ptr;
     size_t size;
     size_t capacity;
 };
 
-static struct __stack_info *__g_si = NULL;
-static size_t __g_sc = 0;
+#define __stack_header(stack) ((struct __stack_info*)(void*)(stack) - 1)
 
-static struct __stack_info *__get_si(void *stack){
-    for (size_t i = 0; i < __g_sc; i++){
-        if (__g_si[i].stack_ptr == stack) return &__g_si[i];
+// returns the new data pointer. Capacity never drops below the current size.
+static void *__stack_resize(void *stack, size_t item_size, size_t new_capacity){
+    struct __stack_info *si = stack != NULL? __stack_header(stack) : NULL;
+    size_t size = si != NULL? si->size : 0;
+    if (new_capacity < size) new_capacity = size;
+    si = realloc(si, sizeof(*si) + new_capacity * item_size);
+    if (si == NULL){
+        perror("[STACK] ERROR: out of memory!\n");
+        abort();
     }
-    // if the stack ptr is unknown, it's probably from uninitialized memory.
-    if (stack != NULL){
-        perror("[STACK] WARNING: given stack was not initialized!\n");
-    }
-    return NULL;
+    si->size = size;
+    si->capacity = new_capacity;
+    return si + 1;
 }
 
-#define __init_stack(stack) do{                                                                                 \
-    __g_si = realloc(__g_si, (++__g_sc) * sizeof(*__g_si));                                                     \
-    __g_si[__g_sc-1].stack_ptr = stack;                                                                         \
-    __g_si[__g_sc-1].size = 0;                                                                                  \
-    __g_si[__g_sc-1].capacity = 0;                                                                              \
-}while(0)
-
 #define stack_free(stack) do{                                                                                   \
-    struct __stack_info *__si = __get_si(stack);                                                                \
-    if (__si != NULL){                                                                                          \
-        if (__si < __g_si + __g_sc - 1) memmove(__si, __si + 1, (__g_sc - (__si - __g_si) - 1)*sizeof(*__si));  \
-        __g_si = realloc(__g_si, (--__g_sc) * sizeof(*__g_si));                                                 \
-        free(stack);                                                                                            \
-        stack = NULL;                                                                                           \
+    if ((stack) != NULL){                                                                                       \
+        free(__stack_header(stack));                                                                              \
+        (stack) = NULL;                                                                                         \
     }                                                                                                           \
 }while(0)
 
 #define stack_reserve_capacity(stack, new_capacity) do{                                                         \
-    if (stack == NULL) __init_stack(stack);                                                                     \
-    struct __stack_info *__si = __get_si(stack);                                                                \
-    __stack_reserve_capacity(__si, stack, new_capacity);                                                        \
-}while(0)
-
-#define __stack_reserve_capacity(__si, stack, new_capacity) do{                                                 \
-    __si->capacity = __si->size < new_capacity? new_capacity : __si->size;                                      \
-    stack = realloc(stack, __si->capacity * sizeof(*stack));                                                    \
-    __si->stack_ptr = stack;                                                                                    \
+    (stack) = __stack_resize((stack), sizeof(*(stack)), (new_capacity));                                        \
 }while(0)
 
 #define stack_push(stack, ...)  do{                                                                             \
-    if (stack == NULL) __init_stack(stack);                                                                     \
-    struct __stack_info *__si = __get_si(stack);                                                                \
-    if (__si->size == __si->capacity) {                                                                         \
-        __stack_reserve_capacity(__si, stack, (__si->capacity + 1) * 2);                                        \
+    if ((stack) == NULL || __stack_header(stack)->size == __stack_header(stack)->capacity) {                        \
+        (stack) = __stack_resize((stack), sizeof(*(stack)), (stack_capacity(stack) + 1) * 2);                   \
     }                                                                                                           \
-    stack[__si->size++] = __VA_ARGS__;                                                                          \
+    (stack)[__stack_header(stack)->size++] = __VA_ARGS__;                                                         \
 }while(0)
 
-#define stack_pop(stack)  stack[__get_si(stack)->size > 0? --__get_si(stack)->size : 0]
+#define stack_pop(stack)  (stack)[__stack_header(stack)->size > 0? --__stack_header(stack)->size : 0]
+
+#define stack_size(stack) ((stack) == NULL? (size_t)0 : __stack_header(stack)->size)
 
-#define stack_size(stack) (__get_si(stack) == NULL? (size_t)0 : __get_si(stack)->size)
+#define stack_capacity(stack) ((stack) == NULL? (size_t)0 : __stack_header(stack)->capacity)
 
 #endif //__STACK_H
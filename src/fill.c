@@ -0,0 +1,474 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/stack.h"
+
+#include "fill.h"
+#include "trace.h"
+
+// vectorized kernels for the global replace, picked at runtime depending on the cpu.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define FILL_HAS_X86_KERNELS
+    #include <immintrin.h>
+#endif
+
+#ifndef MIN
+#define MIN(a, b) ((a)<(b)? (a) : (b))
+#define MAX(a, b) ((a)>(b)? (a) : (b))
+#endif
+
+// one bit per pixel, to mark the spans that were already filled.
+// every row starts with a new word, so that bands working on different rows never write the same word.
+typedef uint64_t bitset_word_t;
+#define BITSET_WORD_BITS 64
+
+static inline bool bitset_test(const bitset_word_t *row, int x){
+    return (row[x / BITSET_WORD_BITS] >> (x % BITSET_WORD_BITS)) & 1;
+}
+
+// set the bits [from, to)
+static void bitset_setRange(bitset_word_t *row, int from, int to){
+    while (from < to && from % BITSET_WORD_BITS != 0){
+        row[from / BITSET_WORD_BITS] |= (bitset_word_t)1 << (from % BITSET_WORD_BITS);
+        from++;
+    }
+    while (from + BITSET_WORD_BITS <= to){
+        row[from / BITSET_WORD_BITS] = ~(bitset_word_t)0;
+        from += BITSET_WORD_BITS;
+    }
+    while (from < to){
+        row[from / BITSET_WORD_BITS] |= (bitset_word_t)1 << (from % BITSET_WORD_BITS);
+        from++;
+    }
+}
+
+typedef struct seed_t {
+    int x, y;
+} seed_t;
+
+// pixels are compared as a whole, instead of channel by channel.
+static inline uint32_t colorBits(Color color){
+    uint32_t bits;
+    memcpy(&bits, &color, sizeof(bits));
+    return bits;
+}
+
+static inline int channelDistance(uint32_t a, uint32_t b, int shift){
+    return abs((int)((a >> shift) & 0xFF) - (int)((b >> shift) & 0xFF));
+}
+
+// no channel (including alpha) differs by more than tolerance.
+static inline bool colorMatches(uint32_t pixel, uint32_t target, int tolerance){
+    if (pixel == target) return true;
+    if (tolerance == 0) return false;
+    return channelDistance(pixel, target, 0) <= tolerance && channelDistance(pixel, target, 8) <= tolerance
+        && channelDistance(pixel, target, 16) <= tolerance && channelDistance(pixel, target, 24) <= tolerance;
+}
+
+// -- scanline fill --
+
+typedef struct flood_t {
+    uint32_t *pixels;
+    int width, height;
+    uint32_t target; // color of the area to fill
+    int tolerance;
+    uint32_t flood;
+    bitset_word_t *visited; // filled pixels
+    size_t row_words;
+    seed_t *seeds;
+    int min_x, min_y, max_x, max_y; // bounding box of the filled pixels, empty while min_x > max_x
+} flood_t;
+
+// push the start of every fillable run in row y between x0 and x1 (inclusive).
+static void flood_continue(flood_t *f, int x0, int x1, int y){
+    const uint32_t *line = f->pixels + (size_t)y*f->width;
+    const bitset_word_t *visited = f->visited + (size_t)y*f->row_words;
+    bool in_run = false;
+    for (int x = x0; x <= x1; x++){
+        bool fillable = colorMatches(line[x], f->target, f->tolerance) && !bitset_test(visited, x);
+        if (fillable && !in_run) stack_push(f->seeds, (seed_t){x, y});
+        in_run = fillable;
+    }
+}
+
+// every seed is extended to the whole horizontal span it belongs to, which is filled at once.
+// Only the starts of the neighbouring spans are pushed as new seeds, so this only touches the filled area and its border.
+// returns false once more than budget pixels were filled, calling it again continues with the remaining seeds.
+static bool flood_run(flood_t *f, size_t budget){
+    size_t filled = 0;
+    while (stack_size(f->seeds) > 0){
+        if (filled > budget) return false;
+        seed_t seed = stack_pop(f->seeds);
+        uint32_t *line = f->pixels + (size_t)seed.y*f->width;
+        bitset_word_t *visited = f->visited + (size_t)seed.y*f->row_words;
+        if (bitset_test(visited, seed.x)) continue; // already covered by another span
+        int left = seed.x, right = seed.x;
+        while (left > 0 && colorMatches(line[left - 1], f->target, f->tolerance) && !bitset_test(visited, left - 1)) left--;
+        while (right + 1 < f->width && colorMatches(line[right + 1], f->target, f->tolerance) && !bitset_test(visited, right + 1)) right++;
+        for (int x = left; x <= right; x++) line[x] = f->flood;
+        bitset_setRange(visited, left, right + 1);
+        filled += right - left + 1;
+
+        f->min_x = MIN(f->min_x, left);
+        f->max_x = MAX(f->max_x, right);
+        f->min_y = MIN(f->min_y, seed.y);
+        f->max_y = MAX(f->max_y, seed.y);
+        if (seed.y > 0) flood_continue(f, left, right, seed.y - 1);
+        if (seed.y + 1 < f->height) flood_continue(f, left, right, seed.y + 1);
+    }
+    return true;
+}
+
+// -- labeled fill --
+// Every band labels the connected runs of fillable pixels in its rows at the same time, with a union-find over the runs.
+// The runs that touch across a band border are then joined, and every band fills the runs that are connected to the seed.
+// Pixels that the scanline fill already filled count as fillable, so the labeled fill can finish an area it started.
+
+// fillable pixels [left, right] of one row.
+typedef struct run_t {
+    int left, right;
+} run_t;
+
+// rows [y0, y1) of the image, labeled and filled by one job.
+typedef struct label_band_t {
+    int y0, y1;
+    run_t *runs; // runs of all rows of the band, row by row
+    uint32_t *parents; // union-find parent of every run, as index into runs
+    size_t offset; // index of the first run among the runs of all bands
+    int min_x, min_y, max_x, max_y;
+} label_band_t;
+
+typedef struct label_t {
+    flood_t *f;
+    size_t *row_first; // index of the first run of every row, within its band
+    uint32_t *parents; // union-find parent of every run of all bands
+    uint32_t root; // of the runs that are connected to the seed
+    label_band_t *bands;
+    int band_count;
+} label_t;
+
+// path halving, only used while no other thread accesses the same parents.
+static uint32_t label_find(uint32_t *parents, uint32_t run){
+    while (parents[run] != run){
+        parents[run] = parents[parents[run]];
+        run = parents[run];
+    }
+    return run;
+}
+
+// the smaller index becomes the root, so runs are attached to runs of earlier rows.
+static void label_union(uint32_t *parents, uint32_t a, uint32_t b){
+    a = label_find(parents, a);
+    b = label_find(parents, b);
+    if (a < b) parents[b] = a;
+    else if (b < a) parents[a] = b;
+}
+
+// find without modifying parents, for reading from several threads.
+static uint32_t label_root(const uint32_t *parents, uint32_t run){
+    while (parents[run] != run) run = parents[run];
+    return run;
+}
+
+// unite the runs [a, a_end) of one row with the overlapping runs [b, b_end) of the next.
+// offset_a and offset_b are added to the indices into parents.
+static void label_unionRows(uint32_t *parents, const run_t *runs_a, size_t a, size_t a_end, size_t offset_a,
+    const run_t *runs_b, size_t b, size_t b_end, size_t offset_b){
+    while (a < a_end && b < b_end){
+        if (runs_a[a].left <= runs_b[b].right && runs_b[b].left <= runs_a[a].right) label_union(parents, offset_a + a, offset_b + b);
+        // the run that ends first can't overlap any further run of the other row.
+        if (runs_a[a].right < runs_b[b].right) a++;
+        else b++;
+    }
+}
+
+static size_t label_rowEnd(const label_t *l, const label_band_t *band, int y){
+    return y + 1 < band->y1? l->row_first[y + 1] : stack_size(band->runs);
+}
+
+static inline bool label_fillable(const flood_t *f, const uint32_t *line, const bitset_word_t *visited, int x){
+    return colorMatches(line[x], f->target, f->tolerance) || bitset_test(visited, x);
+}
+
+static void label_band(void *data, int index){
+    label_t *l = data;
+    const flood_t *f = l->f;
+    label_band_t *band = &l->bands[index];
+    uint64_t start = trace_begin();
+    for (int y = band->y0; y < band->y1; y++){
+        const uint32_t *line = f->pixels + (size_t)y*f->width;
+        const bitset_word_t *visited = f->visited + (size_t)y*f->row_words;
+        l->row_first[y] = stack_size(band->runs);
+        for (int x = 0; x < f->width; x++){
+            if (!label_fillable(f, line, visited, x)) continue;
+            int left = x;
+            while (x + 1 < f->width && label_fillable(f, line, visited, x + 1)) x++;
+            stack_push(band->parents, stack_size(band->runs));
+            stack_push(band->runs, (run_t){left, x});
+        }
+        if (y > band->y0){
+            label_unionRows(band->parents, band->runs, l->row_first[y - 1], l->row_first[y], 0, band->runs, l->row_first[y], stack_size(band->runs), 0);
+        }
+    }
+    trace_end("label band", start);
+}
+
+// moves the parents of a band to the parents of all runs.
+static void label_gather(void *data, int index){
+    label_t *l = data;
+    label_band_t *band = &l->bands[index];
+    for (size_t i = 0; i < stack_size(band->runs); i++) l->parents[band->offset + i] = band->offset + band->parents[i];
+    stack_free(band->parents);
+}
+
+static void label_fill(void *data, int index){
+    label_t *l = data;
+    const flood_t *f = l->f;
+    label_band_t *band = &l->bands[index];
+    uint64_t start = trace_begin();
+    for (int y = band->y0; y < band->y1; y++){
+        uint32_t *line = f->pixels + (size_t)y*f->width;
+        for (size_t i = l->row_first[y]; i < label_rowEnd(l, band, y); i++){
+            if (label_root(l->parents, band->offset + i) != l->root) continue;
+            run_t run = band->runs[i];
+            for (int x = run.left; x <= run.right; x++) line[x] = f->flood;
+            band->min_x = MIN(band->min_x, run.left);
+            band->max_x = MAX(band->max_x, run.right);
+            band->min_y = MIN(band->min_y, y);
+            band->max_y = MAX(band->max_y, y);
+        }
+    }
+    trace_end("fill band", start);
+}
+
+static void label_free(label_t *l){
+    for (int i = 0; i < l->band_count; i++){
+        stack_free(l->bands[i].runs);
+        stack_free(l->bands[i].parents);
+    }
+    free(l->bands);
+    free(l->row_first);
+    free(l->parents);
+}
+
+// fill the area around (x, y) with one band per thread of pool. returns false if there was not enough memory,
+// nothing is filled then.
+static bool flood_label(flood_t *f, int x, int y, threadpool_t *pool){
+    label_t l = {
+        .f = f,
+        .band_count = MIN(threadpool_size(pool), f->height),
+    };
+    l.row_first = malloc(f->height*sizeof(*l.row_first));
+    l.bands = calloc(l.band_count, sizeof(*l.bands));
+    if (l.row_first == NULL || l.bands == NULL){
+        label_free(&l);
+        return false;
+    }
+    for (int i = 0; i < l.band_count; i++){
+        label_band_t *band = &l.bands[i];
+        band->y0 = (long)f->height*i / l.band_count;
+        band->y1 = (long)f->height*(i + 1) / l.band_count;
+        band->min_x = band->min_y = INT32_MAX;
+        band->max_x = band->max_y = -1;
+    }
+    threadpool_run(pool, label_band, &l, l.band_count);
+
+    size_t run_count = 0;
+    for (int i = 0; i < l.band_count; i++){
+        l.bands[i].offset = run_count;
+        run_count += stack_size(l.bands[i].runs);
+    }
+    l.parents = run_count <= UINT32_MAX? malloc(run_count*sizeof(*l.parents)) : NULL;
+    if (l.parents == NULL){
+        label_free(&l);
+        return false;
+    }
+    threadpool_run(pool, label_gather, &l, l.band_count);
+
+    // join the last row of every band with the first row of the next, and find the area of the seed.
+    uint64_t start = trace_begin();
+    for (int i = 1; i < l.band_count; i++){
+        label_band_t *above = &l.bands[i - 1], *below = &l.bands[i];
+        int y_above = above->y1 - 1, y_below = below->y0;
+        label_unionRows(l.parents, above->runs, l.row_first[y_above], label_rowEnd(&l, above, y_above), above->offset,
+            below->runs, l.row_first[y_below], label_rowEnd(&l, below, y_below), below->offset);
+    }
+    label_band_t *seed_band = &l.bands[0];
+    for (int i = 0; i < l.band_count; i++) if (y >= l.bands[i].y0) seed_band = &l.bands[i];
+    for (size_t i = l.row_first[y]; i < label_rowEnd(&l, seed_band, y); i++){
+        if (seed_band->runs[i].left <= x && x <= seed_band->runs[i].right) l.root = label_find(l.parents, seed_band->offset + i);
+    }
+    trace_end("merge bands", start);
+    threadpool_run(pool, label_fill, &l, l.band_count);
+
+    for (int i = 0; i < l.band_count; i++){
+        label_band_t *band = &l.bands[i];
+        f->min_x = MIN(f->min_x, band->min_x);
+        f->min_y = MIN(f->min_y, band->min_y);
+        f->max_x = MAX(f->max_x, band->max_x);
+        f->max_y = MAX(f->max_y, band->max_y);
+    }
+    label_free(&l);
+    return true;
+}
+
+// the scanline fill only touches the filled area, which makes it the quickest for small areas.
+// Once the area turns out to be large, the rest is labeled by all threads instead,
+// which looks at every pixel, but spreads the work evenly no matter the shape of the area.
+// Both fill the 4-connected area of matching pixels, so the result equals the serial fill.
+Rectangle imageColorFloodParallel(Image *image, int x, int y, Color color, int tolerance, threadpool_t *pool){
+    Rectangle filled = {0};
+    if (x < 0 || y < 0 || x >= image->width || y >= image->height) return filled;
+    tolerance = MAX(0, MIN(tolerance, 255));
+    flood_t f = {
+        .pixels = (uint32_t*)image->data,
+        .width = image->width,
+        .height = image->height,
+        .flood = colorBits(color),
+        .tolerance = tolerance,
+        .row_words = (image->width + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS,
+        .min_x = INT32_MAX,
+        .min_y = INT32_MAX,
+        .max_x = -1,
+        .max_y = -1,
+    };
+    f.target = f.pixels[(size_t)y*f.width + x];
+    if (f.target == f.flood && tolerance == 0) return filled;
+
+    f.visited = calloc(f.row_words*f.height, sizeof(*f.visited));
+    if (f.visited == NULL){
+        perror("unable to allocate sufficient memory\n");
+        return filled;
+    }
+    int threads = threadpool_size(pool);
+    // labeling a pixel costs about a quarter of filling one with the scanline fill (bench/flood).
+    size_t budget = threads > 1? (size_t)f.width*f.height / (4*threads) : SIZE_MAX;
+    stack_push(f.seeds, (seed_t){x, y});
+    if (!flood_run(&f, budget) && !flood_label(&f, x, y, pool)){
+        perror("unable to allocate memory for the parallel fill, continuing serially\n");
+        // the labeled fill did not change anything, the scanline fill goes on where it stopped.
+        flood_run(&f, SIZE_MAX);
+    }
+    stack_free(f.seeds);
+    free(f.visited);
+    return (Rectangle){f.min_x, f.min_y, f.max_x - f.min_x + 1, f.max_y - f.min_y + 1};
+}
+
+Rectangle imageColorFlood(Image *image, int x, int y, Color color, int tolerance){
+    return imageColorFloodParallel(image, x, y, color, tolerance, NULL);
+}
+
+// -- global replace --
+
+// replace the matching pixels of row in [from, to) and extend the range of changed pixels [first, last].
+static void replaceSpanScalar(uint32_t *row, int from, int to, uint32_t target, uint32_t color, int tolerance, int *first, int *last){
+    for (int x = from; x < to; x++){
+        if (row[x] != color && colorMatches(row[x], target, tolerance)){
+            row[x] = color;
+            if (*first < 0) *first = x;
+            *last = x;
+        }
+    }
+}
+
+typedef void (*replace_row_t)(uint32_t *row, int width, uint32_t target, uint32_t color, int tolerance, int *first, int *last);
+
+static void replaceRowScalar(uint32_t *row, int width, uint32_t target, uint32_t color, int tolerance, int *first, int *last){
+    replaceSpanScalar(row, 0, width, target, color, tolerance, first, last);
+}
+
+#ifdef FILL_HAS_X86_KERNELS
+
+// the per channel distance |p - t| is max(p - t, t - p) with saturating subtraction.
+// a pixel matches if no channel of the distance exceeds the tolerance, and is changed if it differs from color.
+__attribute__((target("sse2")))
+static void replaceRowSSE2(uint32_t *row, int width, uint32_t target, uint32_t color, int tolerance, int *first, int *last){
+    const __m128i t = _mm_set1_epi32(target), c = _mm_set1_epi32(color);
+    const __m128i tol = _mm_set1_epi8((char)tolerance), zero = _mm_setzero_si128();
+    int x = 0;
+    for (; x + 4 <= width; x += 4){
+        __m128i p = _mm_loadu_si128((const __m128i*)(row + x));
+        __m128i distance = _mm_or_si128(_mm_subs_epu8(p, t), _mm_subs_epu8(t, p));
+        __m128i match = _mm_cmpeq_epi32(_mm_subs_epu8(distance, tol), zero);
+        __m128i change = _mm_andnot_si128(_mm_cmpeq_epi32(p, c), match);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(change));
+        if (mask == 0) continue;
+        _mm_storeu_si128((__m128i*)(row + x), _mm_or_si128(_mm_and_si128(change, c), _mm_andnot_si128(change, p)));
+        if (*first < 0) *first = x + __builtin_ctz(mask);
+        *last = x + 31 - __builtin_clz(mask);
+    }
+    replaceSpanScalar(row, x, width, target, color, tolerance, first, last);
+}
+
+__attribute__((target("avx2")))
+static void replaceRowAVX2(uint32_t *row, int width, uint32_t target, uint32_t color, int tolerance, int *first, int *last){
+    const __m256i t = _mm256_set1_epi32(target), c = _mm256_set1_epi32(color);
+    const __m256i tol = _mm256_set1_epi8((char)tolerance), zero = _mm256_setzero_si256();
+    int x = 0;
+    for (; x + 8 <= width; x += 8){
+        __m256i p = _mm256_loadu_si256((const __m256i*)(row + x));
+        __m256i distance = _mm256_or_si256(_mm256_subs_epu8(p, t), _mm256_subs_epu8(t, p));
+        __m256i match = _mm256_cmpeq_epi32(_mm256_subs_epu8(distance, tol), zero);
+        __m256i change = _mm256_andnot_si256(_mm256_cmpeq_epi32(p, c), match);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(change));
+        if (mask == 0) continue;
+        _mm256_storeu_si256((__m256i*)(row + x), _mm256_blendv_epi8(p, c, change));
+        if (*first < 0) *first = x + __builtin_ctz(mask);
+        *last = x + 31 - __builtin_clz(mask);
+    }
+    replaceSpanScalar(row, x, width, target, color, tolerance, first, last);
+}
+
+#endif // FILL_HAS_X86_KERNELS
+
+static replace_row_t replaceKernel(void){
+#ifdef FILL_HAS_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return replaceRowAVX2;
+    if (__builtin_cpu_supports("sse2")) return replaceRowSSE2;
+#endif
+    return replaceRowScalar;
+}
+
+Rectangle imageColorReplace(Image *image, Color target, Color color, int tolerance){
+    tolerance = MAX(0, MIN(tolerance, 255));
+    if (colorBits(target) == colorBits(color) && tolerance == 0) return (Rectangle){0};
+    replace_row_t replaceRow = replaceKernel();
+    uint32_t *pixels = (uint32_t*)image->data;
+    int min_x = INT32_MAX, min_y = -1, max_x = -1, max_y = -1;
+    for (int y = 0; y < image->height; y++){
+        int first = -1, last = -1;
+        replaceRow(pixels + (size_t)y*image->width, image->width, colorBits(target), colorBits(color), tolerance, &first, &last);
+        if (first < 0) continue;
+        if (min_y < 0) min_y = y;
+        max_y = y;
+        min_x = MIN(min_x, first);
+        max_x = MAX(max_x, last);
+    }
+    if (max_y < 0) return (Rectangle){0};
+    return (Rectangle){min_x, min_y, max_x - min_x + 1, max_y - min_y + 1};
+}
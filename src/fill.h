@@ -0,0 +1,42 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __FILL_H
+#define __FILL_H
+
+#include "external/raylib/src/raylib.h"
+
+#include "threadpool.h"
+
+// images must be PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 and are modified in place.
+// pixels match a color, if none of their channels (including alpha) differs by more than tolerance (0 - 255).
+
+// Fill the area connected to (x, y) that matches the color of (x, y).
+// returns the bounding box of the filled pixels, with a width of 0 if nothing changed.
+Rectangle imageColorFlood(Image *image, int x, int y, Color color, int tolerance);
+// same result as imageColorFlood. Large areas are labeled and filled by the threads of pool, one horizontal band each.
+Rectangle imageColorFloodParallel(Image *image, int x, int y, Color color, int tolerance, threadpool_t *pool);
+// Replace every pixel matching target, whether connected or not.
+// returns the bounding box of the changed pixels, with a width of 0 if nothing changed.
+Rectangle imageColorReplace(Image *image, Color target, Color color, int tolerance);
+
+#endif // __FILL_H
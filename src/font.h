@@ -1,613 +1,1156 @@
 #ifndef __FONT_H
 #define __FONT_H
 
-// A .ttf file, compressed with the DEFLATE algorithm.
-const unsigned long COMPRESSED_TTF_FONT_SIZE = 19324;
-const unsigned int COMPRESSED_TTF_FONT[] = {
-    0x7c0bbdd5, 0x3795d55b, 0x9647dffa, 0x4b6c87e4, 0xfc76c3d6, 0x76c51488, 0x2d9138ec, 0x251c7159, 
-    0x4256024e, 0x2e210a48, 0x129250e0, 0x02810272, 0x6da70049, 0xd24a5086, 0x2ea5a657, 0xbe9d336d, 
-    0xc7e9276e, 0xd25a74c0, 0x9308c0e9, 0x169865af, 0x775a5b44, 0x34b70cbe, 0x4ed07e9e, 0x9cfa74a1, 
-    0x2521dcba, 0xbdadfdca, 0x48e73ed7, 0xda740396, 0xc80bf7b9, 0xda3a3a3a, 0xd7bded7b, 0x36b5ef5e, 
-    0x00bf0004, 0x23f5802a, 0x46ee75d9, 0x4c03fff7, 0x82e004de, 0x1d2f9bf5, 0x69bfd91d, 0x013c981c, 
-    0xf47eba20, 0x8f420bf2, 0x9804fdb7, 0xb7f0029c, 0x92268e97, 0xcfc4fb6f, 0xf788097e, 0xe762b803, 
-    0xfef63bcd, 0xaf07fb70, 0x00ef3c05, 0xf73b638c, 0x33451edf, 0x061f5400, 0xf7b75c60, 0x23939bfa, 
-    0xaa036db7, 0xed71015a, 0xf3bd37f5, 0xfe3e9fba, 0xdf013bd4, 0xcebf81f7, 0xc3b5deef, 0x2bed59fc, 
-    0x0f84005f, 0xbbddb2c0, 0xff70ed77, 0x2009719b, 0xdc2c0046, 0xefedf37d, 0x616e52f8, 0x01cf1002, 
-    0x69b89f15, 0x771dcecf, 0x67f4717c, 0x01fbf540, 0x779b92e3, 0xebaf63bc, 0x4029cf42, 0x6f7826ec, 
-    0xaef371d9, 0xf2e9bc9f, 0xffbf8027, 0xf7ba201c, 0xf6edb9ee, 0x40b0bccf, 0x1b7d0f00, 0xdeecf8a8, 
-    0xcded775b, 0xea818b01, 0x403340bb, 0x7a6c6173, 0x1fe7aafa, 0xeb5bff7d, 0xb2aefe57, 0x8dc682a5, 
-    0x5c7656c7, 0x2e47df24, 0x38501f7c, 0xdd736c65, 0x0612a003, 0x77e805dd, 0x5385c3ae, 0x9c063180, 
-    0x4db1bdfb, 0x27f8e4b6, 0xe88ee93a, 0xf41a04c4, 0x005a682f, 0xd50b9e03, 0x4c4c631d, 0x7d880dc0, 
-    0x9b004ae2, 0x5857fdf8, 0xdd2b7a29, 0x54aa2a06, 0x0901775b, 0x6e88e9a0, 0x5975f37b, 0xed106b13, 
-    0xc182a8f8, 0x5ef45875, 0x3aeeb803, 0x4412df45, 0x795f9dfa, 0xe3a60c63, 0xcbfde973, 0xf978318c, 
-    0x77be41de, 0xe7f3ccb4, 0xdfe51d7b, 0x379fca5e, 0xffdfc1be, 0x9e345e31, 0xf06fc338, 0x78e6cbbd, 
-    0xd71d7cd6, 0x72bbf5af, 0xb5cc95df, 0x4e039de8, 0x1ce65b67, 0xb98e996d, 0x2563d7a5, 0xf7c95c6d, 
-    0xffeab9e9, 0xfd76b9e6, 0x8cbcda09, 0xebe572c7, 0xcaff8758, 0x6b9d7ccb, 0x045e7afd, 0x18c6e5eb, 
-    0xf0c6306e, 0x76ebbf34, 0xd07d25dd, 0x18cf7d9a, 0xbfdf1543, 0x7ced71d9, 0xd5efcdce, 0xbe4ee073, 
-    0xaff28f04, 0x39cd1f03, 0xbdebfef6, 0x8abc07ff, 0x8b801f71, 0x1a8aad5f, 0x25c34f8a, 0x21515aaf, 
-    0x8d5f1e88, 0x15a37035, 0xf09ce277, 0x2fd1668a, 0x78a8c446, 0xee21d88b, 0x4f1af714, 0xff194f1a, 
-    0xf5193aea, 0x79d14347, 0x82e8f6d1, 0x2fb46768, 0xb7fa22ba, 0x1a0b05b1, 0xfdc73416, 0x3a30e81d, 
-    0x8efe1d7c, 0x47534750, 0x8ec2c76b, 0x8e818ede, 0x75371d95, 0xb871d5dc, 0x1f1dfde3, 0xb9e8f8ec, 
-    0xf025c473, 0x9a215139, 0x2b58bf44, 0xc4ab88b6, 0xe21de235, 0xe309e35e, 0xb2fbe329, 0x31b460f5, 
-    0xca8d1ada, 0xb35e87d6, 0xeb56cdf5, 0x9dcee713, 0xc7b9f1fb, 0xdcf57dcf, 0xc5fdce97, 0xfb9ff7b9, 
-    0xe7e373b3, 0xcb7b9df6, 0xe10a8bb9, 0xdc17f7b3, 0x1cfa3eaf, 0xee7a9b9e, 0xfd3dcf3b, 0x7b9fb7dc, 
-    0x9ec7b9ea, 0xfeb73dcb, 0x0ff3ff7f, 0x9af0fdb7, 0xe9c9fd7f, 0xeeff4f97, 0xbf4fcff4, 0xd385fa74, 
-    0xdcfd3e3f, 0xff4f67e9, 0x9d6fe9f3, 0x2fe9fafe, 0xe9ecfe9f, 0xc4fe9d4f, 0xbe9f8fe9, 0xfcbf94b7, 
-    0x0f09ffb1, 0x3bfdee20, 0xbebffcba, 0x8f73e066, 0xaef74e69, 0xaeecff3b, 0xef77dbf1, 0x55c04bf9, 
-    0x2b78f6e1, 0x7c6baaab, 0xfef575b5, 0x14304340, 0x3536348e, 0x6d696bcf, 0x8d1f9f6b, 0xec2f882d, 
-    0xd45aece8, 0x77b8b3dd, 0x5f44d2c9, 0x9035327f, 0x7cb8365e, 0xe5664568, 0x6bd5e1aa, 0xe1705ed6, 
-    0xfadd7648, 0xbc5c368b, 0x2e9bd371, 0x65f374b9, 0x7cdf465b, 0x8e5715f9, 0x2deabd6d, 0xfedb6f57, 
-    0xe0766bd6, 0xc0fbefbd, 0x13f47f9f, 0xec7e3d9f, 0x8ffdf7f3, 0x0be07ebf, 0x5fb7f37f, 0x274bf07c, 
-    0x8795fcbe, 0xdce1fefe, 0xf47c9c3f, 0xb7157e7f, 0xc06ebb9a, 0xef6afe3b, 0x46ffb0db, 0xb893ffbc, 
-    0xedfeb80d, 0xee9bca12, 0xef93fdc0, 0x5d0b79de, 0xd7107cdf, 0xbf9efdde, 0x047b23d0, 0xdf2fa8ff, 
-    0x07f0e009, 0xc8e87d0f, 0x723e2787, 0xe28fc7cf, 0xccfe9f63, 0x03ec00a7, 0x903e4070, 0xe6377a03, 
-    0x5f63cd80, 0xad9ee216, 0x3dee7139, 0x3db48c39, 0xd6fb7842, 0x10724bed, 0xf668d1bd, 0xe2139186, 
-    0x1839259a, 0x9e8839bd, 0x5c1c92d8, 0x2775d1bd, 0xb6eb1d5c, 0x46b7c58c, 0x6c8f448f, 0xd7448f30, 
-    0x30ef7745, 0xc874544f, 0xf1632df7, 0x26b6475d, 0x3a3027a2, 0x04f44376, 0x3b163cde, 0x8b6b66b1, 
-    0xeb6bb975, 0x724b15d6, 0x2a76a0a8, 0xb6473b64, 0x6f45d746, 0x946e16e4, 0x9ad91c2d, 0x0724bb38, 
-    0xe8c6ef77, 0xe6e75709, 0x4ec6cbb1, 0x72d235dc, 0xd6c8cd62, 0x9a2c5896, 0xe6d8f13d, 0x8d8f13b1, 
-    0x6eb6c4b4, 0xc783925d, 0xcd1a3482, 0x89a1bc1e, 0xe6f6f661, 0x9259e9e0, 0x656aa543, 0x5dc4ec74, 
-    0x6cd6272d, 0x7d44723d, 0x3c4ec78a, 0xcb48e476, 0xfd56f891, 0x7a502739, 0xc8df0d63, 0xeae03641, 
-    0x5dc4e6c8, 0x7757e59b, 0x742d63c5, 0xc78b1e23, 0xb6c4b6b6, 0xa1c92c8e, 0xe8e377aa, 0x25a47658, 
-    0x44badb16, 0x2562f1ce, 0xff056223, 0x263e1d77, 0x1a5f8a16, 0xc6638d9b, 0xe303f1a4, 0xd7515d3f, 
-    0x5ddbae15, 0xecff5c47, 0x8ac569fa, 0xdf15bd8a, 0x9eeadf77, 0xf67934f4, 0xdef7ee7b, 0x6541fde5, 
-    0xcaf2e565, 0x57b7952d, 0x72f953de, 0x7eabe7d5, 0x7aa07d5e, 0x735426aa, 0x9afecd51, 0xdf06be53, 
-    0xdf4eef88, 0xaf5f7de7, 0xb1bda9ed, 0x4f5d64f6, 0x7eeb7bdd, 0xfd677f5a, 0xe47febe7, 0xf01ff26f, 
-    0x14d03d7f, 0x18dc0e18, 0x5f7033b8, 0x33c0b1e0, 0x2c359f81, 0x61abb86f, 0x2f046832, 0xfc13de09, 
-    0xb435a851, 0xe847742e, 0x876fa193, 0x87f78697, 0x23f8889f, 0x183e4557, 0x5d634ef9, 0xfdc696e3, 
-    0x9a6ebf8d, 0xbd3664d7, 0xf4d729bf, 0x7342a69d, 0xf35f735f, 0xf333cddd, 0x6bbbcf96, 0xbde7f7de, 
-    0x968ef2da, 0xb456b52f, 0xac7ad9de, 0x67d6b1f5, 0x92db5ada, 0x57b44f6d, 0xbf6cafb6, 0xf6befdb7, 
-    0x69bfcf5f, 0x3fcfdffe, 0x7fa23515, 0x6c4efd13, 0x16efec73, 0xd5e0bbdc, 0xaff135f8, 0x785a6c2f, 
-    0xee7fc2cd, 0x6f78ed68, 0x48e74567, 0xefcee1e7, 0x1d740d74, 0x517c7ae8, 0x2f4fa2dd, 0x15eecffa, 
-    0xaa7ac7dd, 0xf3dfde7b, 0x2ed7c5a3, 0xefe2ef7e, 0x5ef6b6f7, 0x12df7bd3, 0x4bdd92ff, 0x7db4b07e, 
-    0xdfa5fee9, 0x1c4a2c49, 0xc6fa1448, 0xff7df2fa, 0xffb9bfd9, 0xbc91a4fe, 0xe4d5f93b, 0xd4f2d499, 
-    0x0f960737, 0x61f81e1c, 0x63fa797a, 0xbb2f9fe9, 0x0f3fd971, 0x181e0df6, 0x86f2fafc, 0xff9647e5, 
-    0xd0d16860, 0x43f287e7, 0x57245667, 0xeee2b35c, 0xf8af0f15, 0x44c8c669, 0x37326b33, 0x72b9be66, 
-    0x56ebcae1, 0xe755627e, 0x18c3fdaa, 0x323c385e, 0xbdf0d37c, 0x8d5edfc3, 0xb7ab23d5, 0xeac77eaf, 
-    0xe9feadcf, 0x466b059a, 0xf35fecd6, 0xb37f35b1, 0x3f35b1e6, 0x5dac6b5a, 0xdacd76b0, 0xae4ed63b, 
-    0xa582f97d, 0xc17ddc17, 0xf9f82f67, 0x0785e685, 0x59189c2e, 0xc8d17238, 0x46072375, 0x31391dee, 
-    0xebf23532, 0x903b3fac, 0x777b3abd, 0x0fecbef6, 0xebaeafb2, 0xeeb6375d, 0x75f9759e, 0x59efaf2f, 
-    0xc7fd7bbf, 0xaa2fe7d6, 0x917928b8, 0x8bb1d179, 0xda10d99e, 0xcf86e370, 0xb8be986d, 0x17ede2f7, 
-    0x1fe2e27f, 0xb8d86c6d, 0x8dd1e369, 0x69b4df3f, 0x4e9b63d3, 0xa6e9fa6d, 0x7fe4df57, 0xfe4bc2d3, 
-    0xd181cb7e, 0x1781237f, 0xcc5cb738, 0xa170a2b8, 0xa873eb12, 0x9d50e44a, 0x9fcaa1c8, 0x0e54c543, 
-    0x301c8915, 0x3fb5439d, 0x0e74cf07, 0x150e74c6, 0x53bc1cfe, 0x1cb12498, 0x1839c5ae, 0x8cd249fe, 
-    0xbf8575e4, 0x88183faf, 0x81623a05, 0xbd14da58, 0xa662bd85, 0xbe4e33e0, 0x6a2b9cfa, 0x5264dabe, 
-    0xf440799f, 0x42e1271a, 0x4a4fe63d, 0x74fe5f41, 0xcfe1072a, 0x390a7aa1, 0xbc1c8918, 0x8efebe89, 
-    0x08152078, 0x3a0be279, 0x52cb03d3, 0x35e888c9, 0xb870b6cd, 0x31795e8d, 0xbabf7673, 0x4d76a36c, 
-    0xe4262331, 0xe548bc58, 0xe3509950, 0x74c5f821, 0x1cfe950e, 0xb83953dc, 0x4c543913, 0xa84aa6d3, 
-    0x9e5f5201, 0x88bf5f44, 0x78ae5207, 0x4c262520, 0x6b526f33, 0xa25385bd, 0xf213cd57, 0x8938c662, 
-    0xb7c7cc16, 0x72268872, 0x7cd42588, 0x8873a6b8, 0x902139ca, 0xfd793cd5, 0xa94cd439, 0x1ca9faf7, 
-    0x021cfe3c, 0xfcb83953, 0x68a70439, 0xf30872ca, 0x6fdf337b, 0xf5dae7e5, 0x1c893df8, 0x421c89fc, 
-    0xf0b44989, 0x27f8b6fc, 0xbc9f0f51, 0x00e7f7ae, 0xaf7a285e, 0x69efa29c, 0x0d77d502, 0xca991efc, 
-    0xa1cfe7c1, 0xe56fbf89, 0x34536dcf, 0x2d3c70e6, 0x7c94e95f, 0x15f2c2a5, 0xf453878e, 0x8b319885, 
-    0x5a4de5fe, 0x4a7fa281, 0x19f73942, 0x2c314789, 0x72044242, 0x9fd9a3e8, 0x9ee02b52, 0x66c2eb5e, 
-    0xadf621b8, 0x38148175, 0x0bad6db1, 0x391796bf, 0x0fcb4cb4, 0x66eeea2d, 0xb5cf50ba, 0x4de7afc8, 
-    0x375a00e7, 0xc2b4ea1a, 0xf569eacd, 0x7d4a76b9, 0xa1f7f00e, 0x119f8529, 0xf7cf9f7e, 0x1c294c17, 
-    0xe829e4ee, 0xa77befe6, 0xcfe79872, 0x21f09fa1, 0x1261f12c, 0xf392e04b, 0x893fc4bb, 0xebcbb446, 
-    0x1624ff46, 0x2f5e4ea0, 0xf305abf0, 0x0a33d14c, 0x7cee4688, 0xeeda7701, 0x953e21cf, 0xa4ec9d43, 
-    0xe423bfaf, 0xd05e59a1, 0x22854e99, 0xe742b4a9, 0x8c9c2a74, 0x9d03e384, 0xd23270f1, 0x09e05e91, 
-    0xf28d2287, 0x333132d3, 0x8e8e6a3e, 0xd1ee999b, 0x65b57d71, 0x7754e17f, 0x4c9bf326, 0xbf267777, 
-    0x9dceff65, 0x99dda3e3, 0xe8e8f8fc, 0xdfee69b8, 0xefc99dd2, 0xdf979fdf, 0x19f26775, 0x712123b9, 
-    0xf45119b6, 0xfbda3962, 0x85d6b1fa, 0x66af51a7, 0xd5f869fa, 0x8068e3c5, 0xdbc1d6d8, 0x8e1bd06c, 
-    0xbb3b07a7, 0xb0b18824, 0xd2b85db7, 0xe43848f1, 0x8ce81aed, 0xc953184b, 0xb5c74165, 0x1e1b1998, 
-    0x33ae331e, 0xc78aad0f, 0xf6c586c7, 0x983687bb, 0x9d8b0cef, 0x2eb546d6, 0xa1353068, 0x85fddeeb, 
-    0xd3cbb543, 0xbfc7469b, 0x9f6fb770, 0x1beb6ee8, 0x77b55708, 0x4cf80867, 0x305f2ce1, 0xa8c6fd5e, 
-    0x15a24e36, 0x4d44908b, 0x175aff5f, 0x026109fe, 0xede8dbd7, 0x57902af2, 0x466d090b, 0x50e12324, 
-    0xec1c68bd, 0x581e965a, 0xf9c0082c, 0x55e5d822, 0xd51a0e80, 0xdd935dd7, 0xb927a2b1, 0xc5647f65, 
-    0xe8f8c88a, 0x9565d0f0, 0xf5f77b7f, 0x1bcd149f, 0xdede33bb, 0xf62d0fbb, 0xf523ba66, 0x31dfaf67, 
-    0x32264d72, 0x19ec9a3e, 0x4724f4ca, 0xde5b2fc7, 0x43c5f356, 0xa2aeffd7, 0xefbe99a2, 0xeef6fc2d, 
-    0xee91f5c5, 0xaf12578c, 0x490a513c, 0x9a9a8277, 0x98317531, 0xa19ed0aa, 0xc3559487, 0x1c44773c, 
-    0x45e0a577, 0x30bc24e3, 0xfd795224, 0x2448d450, 0xdeddfafa, 0xa360c0ae, 0x678e2037, 0x9ec99ccf, 
-    0x22becfee, 0x3d933e1e, 0x7f2a385d, 0x23b9d97f, 0x5efe4262, 0xfd52e7f6, 0x1db7f879, 0x40c1aede, 
-    0x98a360d7, 0x7d3d9338, 0xd0e67b3a, 0x881fd92b, 0xcf674f1b, 0x917adfc8, 0x4e30bf17, 0x1c7a8022, 
-    0x74d91a24, 0xa2408730, 0x785fafa9, 0xb4f1c2bb, 0x6bb06bb7, 0x0a9d31b0, 0xc57a360f, 0xcc27fa2f, 
-    0x7cf7927b, 0xfcc27fb8, 0x6243f250, 0xcfd2ec7c, 0x15cb7e7f, 0xb634de5b, 0xbf1c7ff9, 0xca2d8aec, 
-    0x198a6342, 0xb8350c63, 0x8b821890, 0x20da8219, 0x5570a65e, 0xe52ad144, 0x86a24c7c, 0x838d5929, 
-    0xddc8d57a, 0xa291a9a4, 0x6f266242, 0x5e66f3e6, 0x3cdfd2f4, 0x1b9e0e04, 0x3cf1db12, 0x9079516a, 
-    0x9c936d48, 0xe6b4c1a8, 0xfdb1610d, 0x0a83d9d3, 0x3a7f167b, 0xa25db07b, 0x739ab751, 0xc4262bd1, 
-    0x9339e484, 0x4c5aab4a, 0x8bf5f640, 0x26263a58, 0x5e8bd088, 0x147b3e53, 0x3c2ae2cd, 0x4b5c1a8f, 
-    0x6e4c4bf3, 0xee683d6d, 0x30f003ef, 0x3c002780, 0x0005e003, 0x6ef0032f, 0x0f0b5b5b, 0x4e800880, 
-    0x5801cb32, 0xfa3ee647, 0x6eb5befd, 0x4e3002ec, 0x261f649c, 0x54f3c551, 0xc18457e5, 0x0d576e62, 
-    0x07bb884a, 0x20acf60f, 0x2b2857e0, 0x8c0bb9d8, 0x1aafc48c, 0xe0e71ad0, 0x57f5f44a, 0x64612e89, 
-    0xc55bed0a, 0x78ff8c8f, 0xd712f375, 0xa8a69597, 0x1a3d7cf6, 0x6dab1f31, 0x2e12854e, 0xa6ad38d5, 
-    0x931a69bf, 0xda806368, 0xa1f093fc, 0x14fb5e41, 0x82c58b70, 0xf78074ce, 0x6d275756, 0x4ee136aa, 
-    0xd046488b, 0xc5bfdfce, 0xfe5fb2dc, 0xd07dadb9, 0xde88ceec, 0xd3da4fc2, 0xfb5024a6, 0xfa5e88b7, 
-    0xa6696cbb, 0x4fecc5fb, 0x9a593f0a, 0x093d56d1, 0xd4322d63, 0x53bb8b9d, 0x7fb92338, 0xb5126275, 
-    0x7eb546bc, 0xde6e24da, 0x0739f424, 0xbfafaa63, 0x8153a45b, 0x5c953a78, 0x52054e96, 0x8fe46524, 
-    0xc433bb26, 0x4ccc26a1, 0x8bfbd9f7, 0x9dc26afa, 0x33710893, 0xa9bd4221, 0x08dc6eb5, 0x0dc00e37, 
-    0x7adadf63, 0x78dc25fc, 0x023c6e00, 0x1b829e37, 0x978dc2cf, 0x702bc6e0, 0x82ae05ab, 0xa370cd1b, 
-    0xc10c6e1b, 0x63700d8d, 0xecf0dc2b, 0xa3ce4d53, 0xb0626ca9, 0x0893fc9b, 0x075e52a0, 0xb15c12fc, 
-    0x27203d2c, 0xb4d71c30, 0x04622bca, 0x3780f8b9, 0x67766dd3, 0x9193394c, 0xc6c4b7c2, 0x144238ac, 
-    0xd13ea886, 0x51b7c2a1, 0x3c1e9e34, 0x44e2c39e, 0x1c89bd0e, 0x6f733316, 0x953aebd2, 0x20312f43, 
-    0xe5a64492, 0x4038bd38, 0xd38d46a4, 0xc5e0078b, 0x29e2f023, 0xbc2cf178, 0xbc5e0978, 0xa71eaf02, 
-    0xa2f0cd17, 0xc10c5e1b, 0x62f00d8b, 0x9c72bc2b, 0xe21ca9fe, 0x224dc792, 0x81bc3886, 0x6c1a2186, 
-    0x12243d0e, 0xc593a056, 0x22b449c0, 0xfd5baf28, 0xd6d598b4, 0x8d50c662, 0x50c340da, 0x4860ff5f, 
-    0x159c9162, 0xa6b390b9, 0x0c661227, 0x64fce534, 0xb7f54dba, 0xae4a633b, 0xf2e5f978, 0xbd36af2d, 
-    0x313c36a9, 0xae56ab99, 0x95de8abc, 0xace6a6ec, 0x94b80d0e, 0x2c317160, 0x4972644a, 0x2db40d19, 
-    0xcbc75126, 0xace52757, 0xaace4b0a, 0xaea75893, 0xa87858ab, 0xc74c2c61, 0x901522d2, 0xda575322, 
-    0x8533161b, 0x94e16653, 0x792598d8, 0x0f9a6f29, 0xbd858d88, 0x317f99a6, 0x0d68bf3f, 0x8733b0db, 
-    0xf30e44f6, 0x3bb67f79, 0xef2567f6, 0x26967acf, 0x91e42c43, 0xd7295364, 0x33cdce1b, 0xe51a0889, 
-    0x893fc475, 0xf3f53c79, 0xa5387b1c, 0x18957b26, 0x02c78ce8, 0x2c2c70b1, 0xc1daa649, 0xa70b7a7a, 
-    0x6f614cc4, 0x3cfecb7e, 0x354f1da1, 0x5bfdaf71, 0x865ce700, 0xe65700b1, 0xb0e44f10, 0x4250a130, 
-    0x6490be43, 0x898569db, 0x5b81963e, 0xc34649a7, 0x710ca224, 0x5a9a5254, 0xcc06fa0b, 0xa50dd793, 
-    0x624c2754, 0x95ea4106, 0x150e11d8, 0x5e7c9e13, 0xd3331a92, 0x5ab0979d, 0x74ccc764, 0xd842dfef, 
-    0x84a25792, 0x30abde63, 0x1a9cb4a8, 0x22e37687, 0x9e89604c, 0x0d3dd9e6, 0x58aaafc5, 0x2d6221cb, 
-    0x6078e1bc, 0x831c4d30, 0x372913b8, 0x8bfcc1e2, 0xc87f36a2, 0x3d3ad6d4, 0x8bf4713f, 0x89921c8e, 
-    0xd609521c, 0x8c5ed412, 0x7aa200e2, 0x00f1462f, 0x510478a2, 0x9e28853c, 0x212f1445, 0xd510578a, 
-    0xe52a317b, 0x31446eb7, 0x20362884, 0xc288ad8a, 0x88926fb3, 0xff72a219, 0x249b6669, 0x33a9254c, 
-    0x69d2c391, 0xe296b4c9, 0xc3c52c3e, 0xb0278a58, 0x2960cf14, 0xbc52c05e, 0x699aa58c, 0x4b04452d, 
-    0x58a589d1, 0x8758a586, 0x4b02b8a5, 0x8a5ad335, 0xb1852c71, 0xd47e126f, 0xaceca961, 0xa58b558e, 
-    0x5710bbac, 0x5db5a2e9, 0xa17c9bc8, 0x4461127f, 0x4fd875e4, 0xe2c7a5dc, 0xa0f46e2e, 0x4430d02d, 
-    0xbeabaa0d, 0x3ead92fe, 0x61d92830, 0x4c978a58, 0x9b01e21f, 0x2922843a, 0x7d6d6bd1, 0x2966237a, 
-    0x30bad7d1, 0x4024da4e, 0xe86d33bd, 0xfa7c14ce, 0x479f14aa, 0xac267c6d, 0x5f68b388, 0xda743b4b, 
-    0xa6aab356, 0x92621769, 0xcb8e42f0, 0xb4bf8453, 0x2778ab13, 0xda4b2e32, 0xb9d05f16, 0xf361304a, 
-    0x04da58f2, 0x42c6660d, 0x98bda2e3, 0xf1ac48d7, 0x2187de5c, 0x46ed93e5, 0x88d06a2d, 0xf92483ba, 
-    0x20d71091, 0x34873885, 0x6f36a451, 0x2fd683d7, 0xb79680f1, 0xdbcb60bf, 0x64b19286, 0xb68ecddb, 
-    0x2edab383, 0xab74bb91, 0x3765fc96, 0x624872ef, 0xfb9e9702, 0x7c6b51a9, 0xcb296e17, 0xb5992cb8, 
-    0xa30a344a, 0x9f785b36, 0x785b2db8, 0xec4477a6, 0xe4b2fb17, 0xb7bad3a9, 0x7d7a9198, 0xa81a480b, 
-    0xb6606960, 0x7b901724, 0x2f53e0b3, 0x4e166131, 0x37f7b499, 0x51a5fb9e, 0xf70bfc65, 0xab7ee6eb, 
-    0x18955744, 0x1f0aaa34, 0xc29e8aca, 0x2f6c5654, 0x5e888c4c, 0x713acc91, 0xb8058223, 0x333a526e, 
-    0x0ee58b5d, 0xf201c4ae, 0x5c1daa6c, 0x89500789, 0xa7895047, 0x51678950, 0x89509789, 0x77a95057, 
-    0x519a2570, 0x62546e89, 0x80d89508, 0x25456c4a, 0xc390fb3c, 0x254904bc, 0xd0952c35, 0x788bd71c, 
-    0x1394b07a, 0x394b9cba, 0xf65ef913, 0x82f29d1f, 0x99895ea5, 0xf654cf64, 0x386e4b71, 0x7596effb, 
-    0x0e9e39c4, 0x4559e3f4, 0x278db499, 0x90f434a4, 0x5a43bcd6, 0x15490f43, 0x09294c5c, 0x3bdf92a7, 
-    0xa9dec695, 0x17d09a9e, 0x5f62e99b, 0x39d3b50e, 0xb095fa74, 0xf8078f40, 0x6e7f3373, 0x9b1a0663, 
-    0x4e179f56, 0xb4a48c91, 0x29cae271, 0x783aa412, 0x44fc3b65, 0x06995b83, 0x780574d3, 0xead848ba, 
-    0x354b6161, 0xd91c9094, 0x84db5816, 0xe36a29a2, 0x42069cf1, 0x4bac5491, 0x226d87ea, 0x62491194, 
-    0xb4f7bcd8, 0xa2efc194, 0x364e6cd7, 0xb59b2737, 0x59ef9b28, 0xeccbaab1, 0xd95e28ce, 0x7e5e799d, 
-    0x2adb98eb, 0xd155b0f8, 0xb5c2220c, 0x3990362c, 0x44506c87, 0x8b64bd3b, 0x35449e9a, 0x049f160c, 
-    0xaf888b5b, 0xc658a6fb, 0xc235b2f7, 0xfafa97d6, 0x40f1c307, 0xc40c1530, 0x662235d3, 0x3e0f279a, 
-    0x4a3d1e6a, 0x8ac8920a, 0x503e17b7, 0x9a4f3478, 0xf90f938c, 0x263b4610, 0x65118c95, 0xf8a0d6ca, 
-    0xa00e0350, 0x03716341, 0x1e03401e, 0x429e0341, 0x03459e03, 0x5e03425e, 0xe2c68341, 0x01a33406, 
-    0x10c068dd, 0x0d01b01a, 0xc9068ad8, 0x0df46887, 0x9f5a2072, 0x52b8cf9b, 0x912902c9, 0x0e7f06d1, 
-    0x4252532d, 0x72125af6, 0xb4008b15, 0x32cc75b0, 0x1032f448, 0x0e629d41, 0xc890338a, 0x84748c92, 
-    0x77189495, 0x43310be9, 0xb7b4800c, 0x5ec2f1d1, 0xa9152449, 0xee8a3314, 0x03c7271b, 0x38522ad2, 
-    0x721cdf25, 0x6a5c7cc0, 0x2cf547eb, 0x24753b37, 0x2cfcf612, 0xe74d357f, 0x2f8297e0, 0x5975b448, 
-    0x658fada2, 0x52fa72ad, 0xc93946dc, 0x92fa9cc8, 0xe916d125, 0xa4b11a4a, 0x57845ada, 0xa6485c41, 
-    0x02a66540, 0x46cb1cef, 0x0ab136cb, 0xf5483109, 0x41eab170, 0xf98eaa7c, 0xe5375294, 0x015d8654, 
-    0x52902e02, 0xa0cd14c2, 0x2714a312, 0x7baa4e32, 0xe63a5f92, 0x848306ac, 0x5b62cab9, 0x70aa2d2d, 
-    0xe45128e2, 0x44c8a60a, 0x52992ba9, 0x4294bed3, 0x298ffca7, 0x60695ef4, 0x9a4e309d, 0x2a5f3379, 
-    0x700825a3, 0x244e032f, 0x0838da48, 0x8ca16065, 0x7f5117dd, 0x0f10396a, 0xd2cb74c4, 0x0b379132, 
-    0x45938ca7, 0x6571c76d, 0xc9821631, 0x0b5ad80b, 0xe432775e, 0x9a9d12b5, 0x2ac9cd7b, 0xe0ab6318, 
-    0x2affae6b, 0xe6a74f11, 0x5f3301c0, 0x79a40b16, 0x37fe68b5, 0x284be0e6, 0xdb2da30a, 0xb6cb22be, 
-    0xeda15fc2, 0xe9361e2e, 0x1549e983, 0x9e489c1b, 0x3403c58d, 0x8c40a963, 0x95e26834, 0xb9a5de64, 
-    0xe9b24e33, 0xbbdaf67b, 0xd64bed78, 0x35cac3dd, 0x930d562d, 0x03a4b73d, 0x0b1eae96, 0xcf5359c7, 
-    0xde7c998b, 0xc172e324, 0x9047d457, 0x2c52f364, 0x9ab1fbd7, 0xc900f365, 0x5b520de6, 0xb0c93173, 
-    0x48957ee6, 0x9031b169, 0xcc6ed22a, 0x52b8e8fc, 0x383a8809, 0x2421f4fa, 0x434f8aed, 0x2568c368, 
-    0x5c58b6c4, 0xa911b9c8, 0x67b09570, 0x18a4f0a7, 0xa3a867b2, 0xef2164f0, 0x1e4dcb68, 0xd1ed0a8d, 
-    0xe10eb3f0, 0xab7279e6, 0x3892907d, 0xf50933ea, 0x7514ec4b, 0xea1c8bf8, 0x5cedbf5f, 0x342c4e28, 
-    0x139a1627, 0x3189c90b, 0xb4e6edad, 0x96e0ab19, 0xe62c9a64, 0x6bf4bf5a, 0xe325484f, 0x51426d49, 
-    0xa5296af4, 0xe24af97b, 0xbb86190a, 0x071a4e68, 0xd818ec53, 0x1b83e0f8, 0xe0f35a8d, 0x6fecf341, 
-    0x3e0f938d, 0x354b1ce8, 0xb1d257d1, 0xad5c0e7c, 0x2155c129, 0x8de1c451, 0x8db748f1, 0x123cec92, 
-    0x22be4a86, 0x4d72d218, 0xacd74684, 0x28be68d8, 0xc2fecf7a, 0x48785938, 0x99a62c6c, 0x344f98f5, 
-    0x180b2e73, 0x79bdd41c, 0x342c15b6, 0x94575527, 0xafd6ded3, 0x2515d54d, 0x045d3de5, 0x38823563, 
-    0xc9e31b3a, 0xab91e0b5, 0x51ace0af, 0x0706bb1c, 0x7639a350, 0x0d401e0d, 0x9e0d411e, 0x459e0d42, 
-    0x0d425e0d, 0xe68d415e, 0xd7c324d8, 0x18351ba0, 0xa0360d42, 0x23515b06, 0x6d6e38ad, 0x682770f2, 
-    0xa87b157a, 0x86d93bf4, 0xd317f794, 0x1192c76c, 0x99bd54af, 0x480b9055, 0x2ac453ea, 0x25790cc4, 
-    0x4e92dd48, 0xde29f607, 0xbdc9ce2b, 0x0e6c81dc, 0xba1c899d, 0xd4024a12, 0x4b174142, 0xcbf62185, 
-    0x5d934db5, 0x408112a8, 0x7f9490c3, 0xc4d34cc8, 0xe6691a66, 0x40825e2d, 0x58e5dbc8, 0x6ba2d585, 
-    0x389971b0, 0x436f7eb7, 0x8b895eb5, 0xb452f1e7, 0xbedfad75, 0xbda2f3a4, 0xd71abd86, 0x17a53e64, 
-    0x442327a4, 0xededbad7, 0x6009358e, 0xd0e4f61e, 0x35a1c892, 0x75a4e0a1, 0xf1f12969, 0x46b4a405, 
-    0xc8002844, 0xcd61e57d, 0x1869d958, 0x6acf15a7, 0x905678b6, 0x8a505679, 0x2a08153c, 0xbf1296cc, 
-    0x86526d9a, 0x06d084db, 0xe9913131, 0xf97e7356, 0x47110ee5, 0x39093acd, 0xbba27a79, 0x18bab6d8, 
-    0xe0db2b0f, 0xdeaac612, 0x8925b6b2, 0x8038f555, 0xf5558d7a, 0x78f50078, 0x0a78f504, 0xf51678f5, 
-    0x78f50978, 0xab1af505, 0x7a8cd1ea, 0x431ea374, 0xd406c7a8, 0x25ea2b63, 0x3cd97956, 0xebf11605, 
-    0x2d5333a5, 0xb9a94770, 0xcdb31e6a, 0x2949fe79, 0xf775d254, 0x5295736c, 0x4ee72c84, 0xd001b2dc, 
-    0xd5e312c7, 0x30e83dac, 0xf6677563, 0xb59cd16f, 0x68bfb33b, 0x72e8bcae, 0x66982efa, 0x7b66997b, 
-    0xf4853f2d, 0x8f89c4e5, 0x490feb49, 0x37ef6717, 0xfe62ccc6, 0xfc9d7995, 0x1cc1b68b, 0x3e4d2c3c, 
-    0xd87939ef, 0x0f3128f8, 0x32c562e6, 0x76d9aad3, 0x687dad2d, 0xb69de24a, 0x0304087c, 0x97016df1, 
-    0x446bb512, 0x116e153a, 0x399ca324, 0x6a3d1e63, 0xff2d392a, 0xa233c2e5, 0x3e12c1f7, 0xa7c521f5, 
-    0xa95a04b4, 0x66a55118, 0x119a9544, 0xe4464a55, 0xf4fb5f53, 0x67e69f5d, 0xa0c6c93e, 0x1e980ae3, 
-    0x277294d4, 0xdccdd682, 0x2dc65689, 0xaf8f8339, 0x79743388, 0xa60f5989, 0x9a46e153, 0x924c6234, 
-    0xa0f83d43, 0x6fecf271, 0xb5194389, 0x46359128, 0x944ad78b, 0x361ebea1, 0x4759baf8, 0x93626c13, 
-    0xee3de9d0, 0x9f59de66, 0x4baa3c90, 0x08bb507a, 0xdbc78214, 0x36686628, 0xfd487a1f, 0xe8f4743d, 
-    0x7a1e07a1, 0x2f7e01e8, 0x7187c982, 0x1e69db25, 0xe71352e9, 0xd2eaf3d2, 0xf392e833, 0xef2d3d5a, 
-    0xd5bbeb56, 0x2d7f5e6a, 0x9151a8ef, 0x3960d071, 0xbafcef40, 0x418c4769, 0x3659424d, 0x05015dd3, 
-    0xb96f44b1, 0x5fe60ffe, 0x6a2f317c, 0xf47a3c5f, 0xb05952c5, 0xb3fe44a5, 0xd9ca32ad, 0xb0d25641, 
-    0x427f5960, 0x15ec81c6, 0x1f115f13, 0x0ac7988e, 0x3bd6297b, 0x3233ee7f, 0x148bc35e, 0xf596a1a3, 
-    0x14f90cfd, 0x58b0fb9c, 0xc9c777de, 0x1ad14ee4, 0xe9df6364, 0x1d9e643a, 0xcfc63051, 0xb98c605d, 
-    0x732fec62, 0x31553e59, 0x296d8c68, 0xc8fd6db4, 0x9797d712, 0x67ec3f4a, 0x4bd6dfa4, 0x428e86ba, 
-    0x224cb171, 0xbadb1af5, 0xa96f94e4, 0x127be56f, 0xccd379bd, 0x9c69dcef, 0x88602134, 0xf1908cbb, 
-    0x6f51b83d, 0xaf9498d9, 0xbcbb784e, 0xad08c25d, 0xd7c7a7fb, 0xe4f12a8b, 0x7caef97a, 0xd8c6437b, 
-    0xf194cfb9, 0xe963ba4b, 0x4f302298, 0x99700eb2, 0x5b962431, 0x2e3d407e, 0x141aede1, 0x678e47cb, 
-    0xc723838d, 0x9895bb6c, 0x499a2d41, 0x5097985b, 0xfc704cbc, 0x2dbf3cce, 0x2b4c365d, 0x26f4ad0f, 
-    0x1dd2d984, 0x3a9b0e96, 0xd4a249cb, 0x117ebeaf, 0xc3a5a788, 0x6429cc9d, 0xcbe6959f, 0x16916ae4, 
-    0xc6f0e633, 0x889a44d5, 0x9293252c, 0xbd591c70, 0x982e4751, 0x79a499dd, 0xd4f729d4, 0x46f14c20, 
-    0xf0103211, 0xf4388bee, 0xc3cb8259, 0xcd37ccbb, 0x29904a82, 0x4ace7125, 0xd16859f8, 0xe1ca6d3a, 
-    0x5ab5b025, 0xd5ac5f33, 0x500695e6, 0x09f4e538, 0x13341988, 0x7a33080f, 0x69b74985, 0x9668b5e6, 
-    0xa5bf0a66, 0x870b7533, 0xb0ee3721, 0x761cc6e3, 0xc480db24, 0xdeb6a1a2, 0x46c1ce96, 0xe39c0e7b, 
-    0x581a646f, 0xa2143ecd, 0xecd30d8d, 0x6431f519, 0x8a0322be, 0xca74b213, 0xe65b8815, 0x61150565, 
-    0x4ca1412a, 0x17ef6786, 0xac9edabd, 0xd86c80e7, 0xa25095eb, 0xf30e5218, 0xb81a2f08, 0x5fd906bf, 
-    0xdc6492c4, 0x3054a0fc, 0x96ee58d8, 0xb3c54e01, 0xd26226d4, 0xdbbcc6e4, 0xbd854d31, 0x0126c6d2, 
-    0xf2b432d1, 0xd8ad90d8, 0xf5b1e4b4, 0xbc55e0b4, 0xaa966ae0, 0x3c508764, 0x0610c02c, 0x0b1e5424, 
-    0x43470f2a, 0x46a8a5b9, 0x499c9bfc, 0x53c5c561, 0x21989d04, 0xf6ff4aae, 0xb18d316f, 0x5449b74c, 
-    0x5fb2dcca, 0x3c43b1ca, 0x29c4ad2f, 0x5bca12da, 0xe6dab847, 0x97340df0, 0xb38206f8, 0x6b21037d, 
-    0x8c3c82fe, 0xa5df6920, 0xcc5481be, 0xaf0e6cb9, 0x6b55e880, 0xccdc65b7, 0xd399e22c, 0xfa1c27eb, 
-    0x30156ace, 0x33f07016, 0x26ea43bf, 0xebfd2aee, 0xf00f6c55, 0x5b726c4a, 0x1e2c4e9a, 0xc5343160, 
-    0x3bda41de, 0x69226d26, 0x372bda0a, 0x03b58c90, 0x38957b48, 0x2491455c, 0x822ea555, 0x48d14c60, 
-    0x06d17e8a, 0xe743a96a, 0xdb08e34d, 0x90eecfa5, 0xad5ef51a, 0xb8c90c37, 0x5a5bd240, 0xbad736ed, 
-    0xe9d43df0, 0x28ba2548, 0x24f072f1, 0xbbac822a, 0xccdcfb52, 0xb392fa3b, 0x62cc2627, 0x8a63ab7e, 
-    0x4fcaa5aa, 0x88c49bac, 0xeced3114, 0xbe69a68b, 0xe2ff2478, 0xe321e68b, 0x17b2e164, 0xf1822ff3, 
-    0x5bca4272, 0xe0994999, 0xc5d2f1a4, 0x0ef254d4, 0x69ca9da7, 0x892aa91b, 0xa60e205f, 0x21ec85a6, 
-    0xa0e01cd2, 0x407c7e4b, 0x1ec927ad, 0x250d7235, 0x336af7c3, 0x7e735780, 0xc40794af, 0xf00cd3b4, 
-    0x00f672eb, 0xd672c72f, 0xb4896df8, 0x56d2da61, 0xdb85f474, 0x8adaffa2, 0xee43b123, 0x2453d61d, 
-    0x1564987a, 0x18a1f8d1, 0xdb1674bd, 0x4de20863, 0x62159cb6, 0x6b41a91d, 0x6f445356, 0xa05c4595, 
-    0x42ca9501, 0x40e425a1, 0xb529cc82, 0xc7a14e6c, 0xe183fafb, 0x0a76e941, 0xd4167848, 0x603c708b, 
-    0x2c38deae, 0x49324d59, 0xe181f8f3, 0x4c2aca8d, 0x948ce78c, 0xf73a6d93, 0x940bb647, 0x96bdeaf5, 
-    0xd7dd405d, 0xfe1632b7, 0x7c257c13, 0x52c6f341, 0x658f809b, 0xc8ad80ba, 0xde452dfb, 0x670c95e6, 
-    0x31592d58, 0xc59bcc7f, 0x8d27df56, 0xe3f88b47, 0x25126179, 0xe2bf0970, 0x9f1b1e55, 0xb5ac4248, 
-    0x6f1f4424, 0xa0929f15, 0xb33d12ca, 0xf93dde88, 0x2bb10964, 0xf100abc2, 0xb41e7aec, 0x99a5860c, 
-    0x531897a8, 0xe2631653, 0x1b17c5e7, 0xe63eec57, 0xc0724ba3, 0x6b828b7a, 0x1b921141, 0x01b1d936, 
-    0x98a598e1, 0x3a45874a, 0x895f54e6, 0xd8199f0f, 0x79a061b0, 0xdbc3e1db, 0x6f08af0a, 0x538be2ea, 
-    0x1d0fdbcd, 0x64662eda, 0x51053348, 0xf070175a, 0x3ff120bf, 0x054a3067, 0xbf7af4d3, 0xc569cf45, 
-    0xdc8e90e1, 0x99aa5116, 0xb4b2a1d2, 0x39ce6983, 0x971c2ec0, 0x42198ad0, 0xe997fa4f, 0x28250936, 
-    0x2be6cedc, 0xb7aeff72, 0x7a706ff7, 0x3fd6bd6e, 0xb5b5d8e5, 0xdfad700c, 0x9298875e, 0x2b7e951f, 
-    0x4054c725, 0x91d1484c, 0x8d0a4297, 0x8b955e64, 0x1b61c641, 0xb3346a8e, 0x36c15aee, 0x2a042f42, 
-    0x8aeaee94, 0x55e52cbb, 0x92132f6b, 0x3a246f97, 0x4d68b1b0, 0xbf76ae3f, 0x792ab1d6, 0xe229d527, 
-    0x6789a759, 0x759e269d, 0xd8067892, 0x1ea8d781, 0x36dfd46b, 0xd1ab9d6a, 0x4d8e578a, 0x549de5b3, 
-    0x5ea926e4, 0x418b9618, 0x58707293, 0xd8b1c18f, 0x59b9ce83, 0x89e17c56, 0xe99ae82f, 0xa886334e, 
-    0xe9c3633f, 0xbc3cd36e, 0xbf0b044d, 0xe2f8b818, 0x61bef901, 0x76df7c83, 0xc1a12cd8, 0x57483fc1, 
-    0xe8f47f9d, 0x0f43ecfc, 0xe39df965, 0x884d1511, 0x31b77d90, 0x08cee2a1, 0x521d1a27, 0x2a44bf91, 
-    0xd46e110a, 0x962a2449, 0x112c428e, 0x22254a85, 0x3809056d, 0x8f292165, 0xd0a418b0, 0xc7384c44, 
-    0xd2f52559, 0xb2ebde62, 0x4bd236f4, 0xb4aa5aa5, 0x87858dd2, 0x8dd90cc4, 0x2d9c8cc9, 0xc275243c, 
-    0x3ae13121, 0x63a9368c, 0xa9394bd5, 0x492ddfaf, 0x2d3c6755, 0xeeb4a7e3, 0x14470de3, 0x1d189ad5, 
-    0x5112ab27, 0x4f45da10, 0x73d17f5e, 0xf9ed1832, 0x3337ae8b, 0xddd267dd, 0x99f4eebe, 0xceb01945, 
-    0xd8563b3b, 0xac70fdd0, 0xa1d74ef0, 0x3844b059, 0x18314223, 0x9832c30f, 0x586990d6, 0x2a08386c, 
-    0x11cf9c22, 0x8c188b18, 0xfd798cee, 0xfdabcf45, 0xf7597a2d, 0xf0c8ab09, 0xe1716b6f, 0xab316c9f, 
-    0xe71253ab, 0x1ab694b8, 0x89571f09, 0xeef88c94, 0x4894ee1c, 0x7563bab8, 0x14cdb847, 0x758f0f8f, 
-    0x9385b70e, 0x8eb1e1c9, 0x24e16dd5, 0x90b93ce1, 0xc7ac4e58, 0x68827f8d, 0xd4e59b5a, 0x97d6c16a, 
-    0x91558928, 0x044b0246, 0x449f4a75, 0xbb950dec, 0x88c98c60, 0x3f9df7d9, 0xdbc5c3b7, 0xd74c60d7, 
-    0x8e2e1c79, 0x5b4af4c0, 0x83cb9436, 0x8c8d88ac, 0xdad28d89, 0x2b14b61b, 0xe3af29ed, 0x81b91b06, 
-    0xa0930cb0, 0x05b3299d, 0x69d9b624, 0x2c548102, 0x112558a0, 0xc8b45b39, 0xcec2c74b, 0x4cb3ea9d, 
-    0x57a22006, 0x515d33ca, 0xaf0f90b4, 0xa3734991, 0x4ba4c594, 0x433965de, 0x55d7992b, 0xb619bdca, 
-    0xb2d2a6f6, 0xea3e6c07, 0x00d21369, 0x07dafd23, 0x229c292e, 0xb30cab0b, 0x0bf3e7ca, 0x392fe4d7, 
-    0xaa598c60, 0xb53859af, 0x0643a166, 0xa497416b, 0xa1d23a48, 0x1906525e, 0xe7484ebd, 0x3020a2ed, 
-    0xac27450a, 0x96f46c1b, 0x99881fe6, 0xc7b6b7f5, 0xaeb7ede3, 0xfebeadbf, 0xe5f5c736, 0x97d7a17a, 
-    0x6bd7c37e, 0x7231311d, 0xe3668c5e, 0x06e088bb, 0x4cd51b22, 0x54e2d436, 0x141f5b4b, 0xcf308bf3, 
-    0xc5d29db1, 0xe53aef01, 0xe1a8c3c7, 0x21b26762, 0x21923445, 0xbc5210aa, 0x45632bca, 0x9bb48ec3, 
-    0x41c6c1ae, 0xe1e8f9a3, 0xcf758cbc, 0xcd9a3a1f, 0x47238de7, 0xa4d48039, 0xb31e4a8f, 0x5cb787e9, 
-    0xe75b94ee, 0xe670550e, 0x8a298041, 0xfbf85269, 0x87c507ab, 0x19f75cb5, 0x61d73bf1, 0x4500c3cc, 
-    0x3913a6a1, 0x75c8732c, 0x6c0e5960, 0x983c14ed, 0x50eb4734, 0xb4d75c8c, 0x9fecf58a, 0x149cfe52, 
-    0x8a62d261, 0x214c5cf0, 0x663293c9, 0x8f730ac1, 0xc56585a7, 0xadc5748f, 0x6146be60, 0x5c39fe45, 
-    0x645d03b7, 0xdf1f268a, 0x8cbec8b1, 0x842e3a39, 0x1bdee999, 0x3308f36e, 0xa6247749, 0x7bb50bed, 
-    0xf3329f0a, 0x48b6c487, 0xe32df974, 0x6619d7a3, 0x5c2da677, 0xd4f85d57, 0xf2e8912b, 0x30a5c79b, 
-    0xadae16db, 0x381ebb11, 0xaa56f524, 0x11e92120, 0x286776ed, 0x5562bdbe, 0x13175372, 0x0233af11, 
-    0x6256626b, 0xc253458b, 0x3b347c8e, 0x430bb0b6, 0x8a1a65ac, 0x065d7ec0, 0xf2de4156, 0xd1df5ba8, 
-    0x46df38d9, 0x2dc2a6b3, 0x474e1516, 0x8165e038, 0xb8304d37, 0x0914ece2, 0x14ea59c7, 0xe47f4f33, 
-    0xbc17f5d2, 0xf7bdf779, 0xb232deee, 0x3c8fd2fe, 0x3c3a3f9d, 0xf47c3636, 0x54748128, 0xd3c8ff6c, 
-    0xde4f6e0b, 0xbdf77bbb, 0x3c17dbc9, 0x12d6785d, 0x2adc6537, 0xb8cc47e5, 0x4652a30e, 0xdccdfd0c, 
-    0x02383996, 0x4319aba0, 0x85b5a76a, 0x06f6524a, 0x3c0687dc, 0x813c068c, 0x06833c06, 0xbc0680bc, 
-    0x3c8943ac, 0x0d044068, 0x960344e8, 0xd0eb01a1, 0x28642b80, 0x0deca491, 0x49519718, 0x65545fd2, 
-    0x4cbcba19, 0x677ebc96, 0xe934806a, 0xc8a089a8, 0x1334aebf, 0xf5233108, 0x0014bc88, 0xe44fe3d9, 
-    0x66fdece9, 0x7ec56f3e, 0xf8b1fb9e, 0x8c92f899, 0x45b20c09, 0x69a12ab5, 0x69a4ca92, 0x28ba37ac, 
-    0x5767e615, 0xd5ed7b5f, 0xfcbefe6f, 0x93f9d55b, 0xf6beba17, 0xcad7f935, 0x49759181, 0x7ff28a5a, 
-    0x586516c8, 0xb88eff7e, 0x03261b8a, 0xd7998cd3, 0x07921d71, 0xa29799cf, 0x5e6518a2, 0x36b9c18a, 
-    0x70346527, 0x37d3e258, 0x62972a64, 0xae14f3dd, 0x715d162c, 0x62899549, 0xe038a636, 0x1c26b19b, 
-    0xd7b91db3, 0xceeb786d, 0xe1d1e6f9, 0xfdf395b1, 0xce340b89, 0x07114e14, 0xe089b70f, 0x6688eb86, 
-    0xbc5f0d8c, 0x8905fe64, 0x1f35850e, 0xe553d121, 0x3a3ef0d3, 0x748d3e5f, 0xccbcc98d, 0x687bc909, 
-    0xa4ab3dcf, 0xacc666c5, 0xa8fe8726, 0x91e95a74, 0x6900e1f4, 0xe923ca8b, 0xe1f003c3, 0x14f0f811, 
-    0x3e16787c, 0x5e1f04bc, 0x247b4f81, 0x0f86687d, 0x0861f0dd, 0x08a06c3e, 0x47a4f83c, 0x4027f3d2, 
-    0x8c5330ca, 0xf570a4b0, 0xa4e7feb6, 0x6a9c4516, 0x9170947c, 0x14bd2379, 0x1468a45f, 0xb2d6f43b, 
-    0x1ea18d49, 0xa0b74ea3, 0x675dde1d, 0x429152e7, 0x9d085608, 0x14a517be, 0x548a2c1a, 0xe9f546f3, 
-    0xf55b054c, 0xc91c38e3, 0xf4a54c6e, 0xa327dcc9, 0x4d9cca53, 0x30448768, 0x5c492fb2, 0x1b4eaefb, 
-    0x5424aefc, 0x8ecd8992, 0xc4870d54, 0xdf753e7b, 0xb457af99, 0xb6e19385, 0xd93ba664, 0xe3fe319d, 
-    0xdf05c993, 0x3a26aaa8, 0x766e0344, 0x94c3d3f4, 0x78341bf1, 0x889bfd6a, 0xa06f8ba9, 0x31fb7187, 
-    0xd177ddfd, 0x931e2ea4, 0x7f5f05df, 0x825e48fa, 0x01db50a3, 0x028f4f59, 0x5277a990, 0x71826f91, 
-    0x12fb7b49, 0xf0278515, 0xdc49b198, 0xdfb14aef, 0x14eacb45, 0xd9dc2072, 0xd36359e3, 0x53acf1c8, 
-    0xb5910a2f, 0x4322cc38, 0x806a24b8, 0xa3846768, 0x95b4ea1f, 0x04e39eab, 0x21a6bc42, 0x92188487, 
-    0x1fd7d8eb, 0xcca5d05b, 0xad80a938, 0xe394521d, 0xbd89ab8a, 0x6463854b, 0x51e349e4, 0x89275465, 
-    0xba81c750, 0x0045a8a2, 0x76ae384d, 0xb63b1fde, 0xba8af6c8, 0xcca944a5, 0x8d62b0dc, 0xcc512c22, 
-    0x89aeb3b3, 0x295bd788, 0x274c7541, 0x9a0d94eb, 0x242a5bfe, 0xe2057755, 0x1d40ae81, 0x88c87de5, 
-    0xbd6e2ba3, 0xd319f777, 0x2f977b34, 0xfd83c197, 0xed572381, 0xfbc557be, 0xfe798955, 0x5df5f537, 
-    0x3c2cf522, 0x03c4262f, 0x7c393dff, 0xb03848a2, 0xd6b3ec22, 0x92b816ee, 0x9530db6c, 0x576f66d4, 
-    0x58544f8b, 0x6bb1a27c, 0xf869b690, 0x667dd9d3, 0xdeecc9fe, 0x8e53f306, 0xc58b52fd, 0x4e672baf, 
-    0x8b0598d9, 0x37239c97, 0xd8dcc671, 0x9a4b6e1c, 0x9f326746, 0xf8cb0b6c, 0x93f79b7a, 0xdf82d68e, 
-    0x3697a8a9, 0xa5add0a6, 0xe221da14, 0xa4a94b2a, 0x801c7ed8, 0x3f6c535f, 0x8f1f801e, 0xe0a78fc0, 
-    0xe3f0b3c7, 0x0af1f825, 0xfb629afc, 0xba3f0cd1, 0xfc10c7e1, 0xb63f00d8, 0xec516fc2, 0x11d8a288, 
-    0x1e0887dc, 0x204f0446, 0xc1106782, 0x65e0880b, 0x4552f444, 0x889d7fe4, 0x58221960, 0x40ae0887, 
-    0x04552f44, 0xa5a888e3, 0x9de5f3b2, 0xf8792932, 0x2be1ec5c, 0xe9631851, 0x052cab98, 0x4584e297, 
-    0x70524fc5, 0xfef8e8c9, 0xa2a9bb42, 0x1b5ae489, 0x63f73ea8, 0x2b90e331, 0xe1921cdc, 0x06ba2b94, 
-    0x15fd05eb, 0xfd5ed733, 0xfd5f37e6, 0xff37f94d, 0x7dafce93, 0xf905ebad, 0x1b6fe557, 0x03cd7263, 
-    0x3e216288, 0x13411c5e, 0xe83b5164, 0xa62a3a57, 0x7ba83634, 0x46defc8d, 0x94532cb9, 0xc195139e, 
-    0xa76eea46, 0x733626f6, 0x49734ae6, 0x2e314ed6, 0x72aaf7d1, 0x7aa38440, 0xbead32c2, 0x443ac714, 
-    0x87317097, 0x1a6fab09, 0xe8b4a9c3, 0x7a27a8d5, 0x6e2b7ecf, 0x482e77a4, 0x93479326, 0x98b81d47, 
-    0xbe145f96, 0xbfd24f94, 0x6ff83737, 0x9acbf457, 0x31ca1e83, 0x6df7139e, 0x9d12755d, 0x4c5fb364, 
-    0xb5af6721, 0x73bc2427, 0xa852b2b2, 0x6d62cde7, 0x96b7c025, 0xd6383a72, 0xb14b07b1, 0x6f856b0a, 
-    0x25271292, 0x1c567150, 0xe51253fd, 0x710fb8e3, 0x9e388c3c, 0x20cf1c40, 0xc710178e, 0x42b8f4cb, 
-    0x882238f9, 0x2c7113a3, 0x10eb1c43, 0x6b8815c7, 0x1c638f94, 0xb1136971, 0x88bd3433, 0x3ba725cb, 
-    0x814ad37d, 0xcfad8523, 0xbf00c39f, 0xa764e0af, 0xac395395, 0x66b0e7f0, 0x116b126a, 0xe3051f47, 
-    0x0619624d, 0x4acbac25, 0x48933a72, 0x4964ebc9, 0x0733a77e, 0xd27ae754, 0x9a1873af, 0xcfe521ca, 
-    0x6aa9c321, 0xff34c9ab, 0x1cf899fa, 0x9f9e65b8, 0xe29677b7, 0xdeccdcdb, 0x8b031b35, 0xc80bf5fd, 
-    0x73c2d586, 0x6b97e2d0, 0xd0fb82d6, 0x82d18782, 0x6782d027, 0xd01782d0, 0xa2d19782, 0x1105acd7, 
-    0x2d13a0b4, 0xac168658, 0x40ae0b43, 0x16b35e8b, 0xc885a38c, 0xcc2e3294, 0xbf38a667, 0x75052484, 
-    0x916adc6e, 0xc4ad7b0a, 0x99dddb38, 0x56c39957, 0x90a59066, 0xd8813816, 0xc4720bca, 0xcb0ebac8, 
-    0x2b77c5e0, 0xa1305c6f, 0xc2883492, 0x282af993, 0x7b88b1e3, 0x0a9e64fa, 0x338facad, 0xea392a56, 
-    0x915a66bc, 0xcfd77557, 0x95017ec1, 0x9ea8ab4d, 0x55f3fd21, 0x941e7f96, 0xa9cdcc87, 0x20febeab, 
-    0xaf3258e9, 0x83c44285, 0xbfd8ae8d, 0xeb1ece1c, 0x1c947ce8, 0x8f8727c6, 0x50f85b92, 0x4ca758f6, 
-    0x2ec99171, 0x361b95a6, 0xd7b438e7, 0xb33d283b, 0xe125bf9c, 0x3328e0ac, 0xdf0d5d1a, 0xefe871a5, 
-    0xcb362cfd, 0xf472d471, 0xc38e5799, 0x4b8718ed, 0xe13536a2, 0x616684e2, 0x3a4c818f, 0x444c575e, 
-    0x3a20d59b, 0x1f658e3a, 0x07b10390, 0xfb2c79d1, 0x3d60f322, 0x6a1d8a0e, 0x60a20ca0, 0x829d9942, 
-    0x10fbfe25, 0xd375dbeb, 0xc9594294, 0x35cbcbbb, 0x266e5450, 0x9c82becf, 0x4158f6a0, 0x84af41bd, 
-    0x744799cb, 0xf8f67b66, 0x958cecf1, 0x7efc644d, 0xb1d8f67b, 0x6971616c, 0xce139156, 0xde864966, 
-    0xd9d8ddb0, 0x7223396f, 0x8605af61, 0x3d894b6b, 0x2cc8ecf9, 0x782c2a80, 0x618cb748, 0x4396de21, 
-    0x1cc54247, 0x8a7d93b7, 0x321dcc3d, 0x42c54596, 0x7906bc51, 0x1576c9a0, 0xa716c665, 0xa9966b39, 
-    0x8ed14ed8, 0x45937508, 0x7daf5fa8, 0xcb7668a8, 0xc74c8b18, 0x46cc4b18, 0x1acc7767, 0x0de73da3, 
-    0x5d0c4768, 0xa6fa5f52, 0x21be89d6, 0x25941703, 0x4b8da5c9, 0x7505b4a4, 0x6bc86676, 0xb2c86521, 
-    0x5d1a7922, 0x920d4fb1, 0x53f0680d, 0x70169f84, 0x0380c249, 0xe993d64b, 0xc292fd68, 0x1f5718b7, 
-    0xe0bf0060, 0x49c677dc, 0x6c89a034, 0xf37534e6, 0xf64fa3d8, 0x5132e6c3, 0x3a5355fe, 0x0e7d5a66, 
-    0x2c6b2ef2, 0x66aa318d, 0x14b56def, 0xc84b0c72, 0xd0511ad1, 0xe7af7c61, 0xa92121ea, 0x41cd4ae1, 
-    0xb389ad56, 0x24269b92, 0x26f91994, 0x96288c39, 0x488d3a45, 0x1d199877, 0x91815537, 0x7da9b74c, 
-    0x2c49c6dd, 0x5cfe2744, 0x4a2facc5, 0xb07518a8, 0x46d1538d, 0x9c430945, 0xd4aea09c, 0x5d330cce, 
-    0x2c2b9924, 0xc894a56d, 0xe4ed9fa8, 0x0a64ce2b, 0x24056e30, 0x173854a3, 0x85d33c63, 0xd8a63a09, 
-    0xede8df7f, 0x279f8c1a, 0x271bccb5, 0x79d83531, 0x28387b3c, 0x628a5cf3, 0x9c3ede0e, 0x785f1d1f, 
-    0xecf77b3c, 0xc3bca30c, 0x7e18703f, 0x792ab192, 0x8b4c6401, 0xc6dba9f6, 0x50d40a71, 0xe24a22ab, 
-    0xb38e84ad, 0x5cad854a, 0x425100af, 0x675e7c11, 0xff7c157b, 0x5c7b3872, 0x92997ce5, 0xdffddbac, 
-    0xbfeb27f9, 0xff763bf3, 0xcb1fe7a7, 0x3fcffd5a, 0x11f2759e, 0x48d8823f, 0xde5840bc, 0x5f1d6af6, 
-    0xf51c67e1, 0x68e19dfb, 0x0a063ace, 0x8362c364, 0x3247db2a, 0xab8e0d37, 0x97964bcb, 0x8fc79d83, 
-    0x30d41c75, 0xb57aba3d, 0xf8e3b271, 0xca020ef1, 0x2e1e1b18, 0xdb44f7da, 0xa50b78e2, 0x055b359a, 
-    0xd8b81aa8, 0x1eed1b54, 0x53154a9b, 0x6c4e16af, 0xf361aaa3, 0xff985d59, 0x31dd2c46, 0x6cdece47, 
-    0x9d7a2642, 0x88b37c69, 0xa97fabd9, 0xf89cfb33, 0x57934a35, 0xa81e4d6b, 0x038b0f9c, 0xbbaacaea, 
-    0x3488ed50, 0x0c18d7b4, 0xeb4456b7, 0x40fcb4a6, 0x8ab091b6, 0xeb14233a, 0x279f3e7c, 0x1d129713, 
-    0x064f82cc, 0x72c11558, 0x655af525, 0x9540ab49, 0x7920270c, 0xee315d56, 0x713bfdd9, 0x2946474f, 
-    0x553d544a, 0x2c367f84, 0xa7a2ff12, 0x77cf3014, 0x6063dc48, 0x1d658f3a, 0x18a017b8, 0x1733421b, 
-    0x366b19a3, 0x3b46e8ce, 0x53115544, 0x0f313583, 0xd160ebbf, 0x5984473a, 0xae3b35a7, 0xf97d854e, 
-    0xad551dfc, 0xfcf98084, 0xd5d2ff49, 0x0b754a04, 0x67c15fa1, 0x0c96058c, 0x7dfe0ca3, 0x3e5f5c89, 
-    0xc9497d76, 0xe0fb83d7, 0xe0f0c3c1, 0x0cf07809, 0x1e01783c, 0x321e4cbc, 0x8a92f925, 0x3c2741ee, 
-    0xd60f0658, 0xe82b83c1, 0x3d7c92ae, 0x79478718, 0xb0666570, 0xf9d8cd5a, 0xd59db9d0, 0x2859f6ba, 
-    0x713418ac, 0xd5c936f8, 0x8ed287cf, 0x28f2c454, 0xcb13b2ad, 0xb095b3a0, 0x186a3868, 0xacff90b5, 
-    0x656262d4, 0x1a1f6845, 0x749a487b, 0x7b6da87c, 0x60d77e20, 0xe4673bf1, 0x6a0d884e, 0x5403cd11, 
-    0x8195a0b8, 0x8e9c58a6, 0x6748e2e4, 0x01940b65, 0x1f45269b, 0xbcb820ab, 0xc7b1d799, 0x75c662d5, 
-    0xf0b19a0f, 0x016f4b0d, 0x6cddf667, 0xe3e74dd9, 0x112eaeb9, 0x43bd5edc, 0x43fde8a5, 0x73ac5261, 
-    0x0b087be0, 0xbcb4ee69, 0x3dd0e1d6, 0x1605653a, 0x54a87ba5, 0x295f008f, 0xb6c79974, 0x13671947, 
-    0x546a104c, 0x0ed06a32, 0xd43b5b0d, 0xcca3772f, 0x90647318, 0x3b8886d1, 0xa0606798, 0xb99b0453, 
-    0x68f8ded2, 0xf1ece1ed, 0x8f362b5a, 0xa70aacd2, 0xef4dde64, 0xeca1f8e8, 0x759a23b1, 0x7f9eccd2, 
-    0xf5a1843c, 0x7a6df73a, 0x144bba52, 0x95f10bb5, 0x58f331e2, 0x734d8923, 0xb33b5bf6, 0x50a976c0, 
-    0x3668ad87, 0xd20ead8a, 0x521d2e76, 0x4e78c963, 0xf21ecb1e, 0xde6a2359, 0x47e70f68, 0x9c87b2c7, 
-    0x868b3223, 0x866f2453, 0x764381d1, 0x8eb81f06, 0x9367b283, 0x5695e3e2, 0xfa97e25e, 0x855d682a, 
-    0xe1f38af9, 0xfe72a238, 0x4f165434, 0x5c40779c, 0xacf3794a, 0xaa1ab5d8, 0xce8dc45e, 0x4738ece3, 
-    0x04c52606, 0x3845db78, 0xf2c1bc21, 0x329b9879, 0xf58fc77d, 0xe8f4dcad, 0x32ffd5ea, 0xcd731b2b, 
-    0xf1df70ee, 0xdda17de3, 0xc3c3f36b, 0x5a715f05, 0xd37e9166, 0xbe37a18d, 0x53335e43, 0x29b6f674, 
-    0x465a231b, 0x9b2b99f9, 0xea0758b4, 0x9ade20c2, 0x0e44f2c3, 0xefa3ec43, 0x3975f966, 0x4aa4a697, 
-    0x1cd3fd10, 0x8b4691f9, 0x0974f99c, 0x5e885da9, 0x06f3e5ae, 0x1ad785a4, 0x3b72397d, 0xe967f0c7, 
-    0xd3267345, 0xbd70b80a, 0x39718df8, 0xa5855b5b, 0x454993af, 0x51555b5a, 0xfee37243, 0xbf97dd66, 
-    0xa2ffffac, 0x67ff1ae3, 0x69b3ced4, 0x948d0b8d, 0xa97daf29, 0xd54bec15, 0xdf9a85a1, 0x6ca1a784, 
-    0x706c0d00, 0xc673f06c, 0x434cb950, 0xdb1222ca, 0xc686e99d, 0xb2c723f3, 0x934a4767, 0x7078ff0e, 
-    0x71c1cb04, 0xf8f678fc, 0xae182751, 0x8e46c7d5, 0x01c306cf, 0x1be65507, 0x3c9d73b4, 0x8ce4e79c, 
-    0xd0c8f446, 0x9de5964d, 0x3b328751, 0x9f243cab, 0x3dbed91e, 0xc94cfc7b, 0x56db6c94, 0x79629a06, 
-    0x00f93169, 0xe2edfe75, 0x1c7a1ce9, 0x2ef4f975, 0x6177a05c, 0x4ec2ef27, 0x91181fff, 0x39f60e52, 
-    0xd49e9b77, 0x7cec9bd9, 0x3ec7eceb, 0xbda08995, 0x6769de87, 0x6944c202, 0x30714226, 0xb5a18aad, 
-    0x4eb96aa2, 0x54226705, 0x95bb3471, 0x15d2e4e5, 0x8a5d6999, 0x6a251332, 0xc4af7c70, 0x4762c28a, 
-    0x5451a28a, 0xe7b3e6f7, 0xb4afa18f, 0x07a457a2, 0x500716ab, 0xb5583dab, 0x78b50078, 0x0a78b504, 
-    0xb51678b5, 0x78b50978, 0x83dab505, 0xb575b945, 0x862d46e8, 0xa80d8b50, 0x5ad456c5, 0x0196f5b9, 
-    0x9aad5094, 0x4babd423, 0x8705f2c2, 0x9b54cbe5, 0xca7b0c92, 0xf619d5f3, 0xe7f65b13, 0xcea6938d, 
-    0xad5617b0, 0x5dce5ee5, 0x55ba06f9, 0x82cb5ef9, 0x7da1814e, 0x53d2ca83, 0x53323c2f, 0xc650b562, 
-    0x52b98a20, 0x0484d399, 0x65e6faf3, 0xeffd1bba, 0xbfbb3569, 0xdf1d1d9a, 0xa2d86a1c, 0x8664ceba, 
-    0x7af3dd92, 0xceea2de6, 0xed6e1e54, 0xc677fb3e, 0x5fddd5b6, 0x57351f1d, 0xd53737d6, 0x2579b1ad, 
-    0x6803c5f9, 0x5d6058a3, 0xcde650cb, 0xbd433d72, 0x03bc2303, 0x1298a75b, 0xd77eb334, 0x340ecb2c, 
-    0x8ba386b0, 0xcfdaf0ca, 0xe9f8719d, 0x33d9e391, 0xc6875925, 0x6cb1c8c4, 0xa6cb1fe1, 0x0d7ffe1e, 
-    0x52dc44af, 0x08497f78, 0xbaf09afc, 0x55ae2c11, 0x29482aa4, 0xcc25a49e, 0xdb209626, 0x85a2b5b5, 
-    0x8916b595, 0x8acb2176, 0xcc8c93e6, 0x9be77aa2, 0x66fb4961, 0xbf9131cf, 0xf1db50f2, 0x42e8cd06, 
-    0x4fcb0dea, 0x0cee62cd, 0x470a32d3, 0xc8966ce9, 0xe553854c, 0xf870ac60, 0x2d651a73, 0x55da77b4, 
-    0xfb16691a, 0xa5275299, 0xbc66aa3a, 0xfdc66d87, 0xc9a4cb52, 0xb949a18d, 0x857096c7, 0x122525f0, 
-    0xc1bb0754, 0xab28ca3a, 0x3be51ced, 0xcf773d17, 0xa8e52abd, 0x9444e97a, 0xe17e2306, 0x0f356bfc, 
-    0x5d92489d, 0xa195ad59, 0x9b42aad7, 0x60752b93, 0x839a9922, 0x90bfd956, 0x022a9e27, 0x2fb0ed34, 
-    0x9f401c07, 0xbd326321, 0xa0d2642c, 0xeac2e959, 0x1b31e1fb, 0x81daa3d2, 0x537b1bf5, 0x71791cb8, 
-    0xe591b461, 0xaa61ef59, 0x567b45df, 0x0d6af4f0, 0x95c8e23c, 0x5d77e2a9, 0xe485be25, 0xaf55a737, 
-    0xf9c9f78a, 0xcdc95bb2, 0x174ae7e2, 0x2ebe6921, 0x3aa576cd, 0xddc554b0, 0x5b6ac56b, 0x3cf9af09, 
-    0x0656b94b, 0x14929e58, 0x1cb8b91d, 0x288ed443, 0xd5b38b10, 0x31be7cb7, 0x974f7c99, 0xde8af833, 
-    0xd8cac3d3, 0x363dcceb, 0x0460698b, 0x6a6d64ed, 0x41b9c560, 0x75a20ed3, 0x447b1e11, 0x35a549ce, 
-    0xa7acb527, 0x85b5fad5, 0x2374e153, 0x9b113fd3, 0x0957eb3b, 0x7f536597, 0xf57edd25, 0xe00cd2e9, 
-    0xc1bc3d3f, 0x092bc0f3, 0x89707976, 0xb703976c, 0x21376688, 0x9886f04a, 0x5da4846d, 0x1373698a, 
-    0xa49b13db, 0x656d5bbe, 0xbdb3d5c8, 0x4af99eb6, 0xcd1bbd90, 0x0f3ebd36, 0xe7b04cc4, 0xdb22629a, 
-    0xa62ea065, 0xe2483d87, 0xb690246d, 0xe8aa40b2, 0x4927bd1e, 0xd361ed52, 0xb5094f5c, 0xb41fe36b, 
-    0xd2c65f49, 0x93865f22, 0x9f4ab5f2, 0x2dd33286, 0x6e99af3e, 0xb59671ee, 0xf41d95da, 0xee125991, 
-    0x703345ec, 0x48a8e519, 0x6ac5ab1c, 0x963ce252, 0x556bdf39, 0xb34c6100, 0xb048dab3, 0xe0cab2ab, 
-    0xf60aead5, 0xccac8d72, 0x33fa425e, 0x90acf49c, 0x56784adc, 0xffc7d439, 0xf212fd34, 0x855fb926, 
-    0xaf7e8ead, 0x24c473a4, 0xbf53d68e, 0xea61bc75, 0x254b5338, 0xd6a6320d, 0x52f55033, 0x00b1adbb, 
-    0x609ce7ac, 0xcf56958d, 0x5a8f090a, 0xc7585663, 0x791cbbbd, 0x9dafe4e3, 0xb781949c, 0xf29b0a7f, 
-    0xcd1122b4, 0xb97db653, 0x7912eb81, 0x18c71974, 0x0dec7323, 0x526399d8, 0x711b9802, 0x1b31531d, 
-    0xf925f34f, 0x79f2e1ef, 0xac8692f0, 0x63160b45, 0x9c555cdb, 0xf69cdd68, 0xa7d656b5, 0x7cada63a, 
-    0xe4ac2a15, 0xb44ac2e2, 0xf56b517a, 0xd2e88d54, 0xdb46e60c, 0x2e58d250, 0x547c799b, 0xc0fa9ded, 
-    0xc3f5e1e1, 0x1dbfffea, 0x33366672, 0xdfd9721f, 0xcb68717f, 0xd9cb3b49, 0x4b87c870, 0x81e880fe, 
-    0xe5df79d9, 0xc99c0883, 0xc2c465bd, 0x4ee1d959, 0x9c44133e, 0xc3295df2, 0x1a2d83a5, 0x0d161d0b, 
-    0x9c420512, 0xada6df3d, 0x6ab6311a, 0x19f92210, 0x96c5fca9, 0xc4b3b996, 0x5297561d, 0x19a4983b, 
-    0x365e3f67, 0x094ffc61, 0x60b5f073, 0xb3342db6, 0x33722640, 0xfc45c807, 0xebcb6c91, 0x87b2db6d, 
-    0xff5acb6d, 0xb8cdb0f2, 0xdd8cdb56, 0x655c66d2, 0x159d8cd9, 0x382c8be3, 0xb4ed4373, 0x6a9994e6, 
-    0x0b29d669, 0xf9af53b9, 0xcf85d82f, 0x75e02953, 0x216785da, 0xcbfbd9f3, 0xd3cc5bc1, 0x13607fff, 
-    0xafe47b9e, 0x8b3c26db, 0xdb645268, 0x9f42fb1c, 0xccf14349, 0x5924fffb, 0x23e67ea7, 0x905fccb2, 
-    0x40ed0353, 0x50a559e3, 0x62934562, 0xfac9ed87, 0x5916566a, 0x98f3a5a7, 0x99227467, 0x82b751cb, 
-    0xb52eaea2, 0x9f7839f7, 0xc4d2ed3b, 0x3a139af0, 0xbc315ede, 0x119c04b6, 0xd4ed6526, 0x3b690ad6, 
-    0x23b1a875, 0x9de5d03d, 0x92feab65, 0xceecdabf, 0xeb9745b8, 0xa2aafe87, 0x54d71672, 0x8acdba64, 
-    0x5b599350, 0x8c8ac3fb, 0xa4a59793, 0xdb42f89d, 0xce904c4e, 0x690e2b65, 0x3e3ec799, 0x61fd9745, 
-    0x8aae54ea, 0x9cb49480, 0xde580495, 0xe050559a, 0x292611bf, 0xa4c11585, 0x6139b164, 0xd8ed225a, 
-    0xec76da17, 0x6db9e9e6, 0xab2991d9, 0x65b5562e, 0xe5b6a9dd, 0x62a0b9c1, 0xae08ad09, 0xf7ba5923, 
-    0x5d9affea, 0x17e1c17e, 0x9bed7651, 0xc7a4896d, 0xdb664941, 0xa0ec49b5, 0x9d3266a4, 0xb28f47cd, 
-    0x9eb07496, 0x4b5e71d0, 0x9a13d2b7, 0x956627ce, 0x5b3124ad, 0xe51e2ae0, 0xccabb12c, 0x97075978, 
-    0x6a8f31f8, 0xa03ae89e, 0x94035c15, 0xc700c894, 0x25b25585, 0x9b322281, 0x33548e34, 0x1596ad67, 
-    0xd3596bea, 0x32d67073, 0xa1980e15, 0x301cab3a, 0x3b1694b2, 0x6ad4e3b0, 0x865e48d1, 0x9ce9f2b9, 
-    0x69baee36, 0x61cb9a5d, 0xb2667698, 0x760831d9, 0x157298bd, 0x0338acd5, 0x75c6315d, 0xcd5251c8, 
-    0xb846c165, 0xa8aa94b2, 0x2cea1226, 0x39d3a5c0, 0x495c612c, 0x344812b0, 0xcae3116c, 0x582f4e22, 
-    0xda4083a2, 0x97b50b99, 0x2e5ea170, 0x46fbda1c, 0x599950b9, 0x8a7ccf2f, 0xce366116, 0x013eaacc, 
-    0x542bb8c7, 0xb798d839, 0xa3abb071, 0x70f40e38, 0xc2c2f8f6, 0xcfd8acc7, 0x17c7b3bb, 0xafee1696, 
-    0x153fecb0, 0x2d55f56c, 0xa663cfc5, 0x29aeed95, 0xeb528635, 0x69f08be5, 0x546ef35a, 0x06202160, 
-    0xe28dbcbb, 0xc7d6eab5, 0x8f1ecaef, 0x8cf2a689, 0xd95de4f9, 0xbe0a0be3, 0x3bd88a39, 0x501b6de9, 
-    0x2929766a, 0x756c57a1, 0xc55a0db1, 0x4d5d1736, 0x6eef39cf, 0x29e3de6b, 0x66dad867, 0x779f3f39, 
-    0xe4d1aa46, 0x8be74558, 0xda49bce7, 0xb995b8dd, 0x657b104d, 0x5acb87a3, 0x32f5a81d, 0x1bae21b6, 
-    0xfc946b26, 0x9586ebb1, 0x3e728ee8, 0x60e081aa, 0xa13c1523, 0x37e6e37a, 0x50df85b3, 0xe32523f0, 
-    0xb666f81e, 0x281f1ff0, 0x1f5657bc, 0x11b96bb7, 0xc22822ee, 0xf70a48b2, 0xe1688a61, 0x9f4c5939, 
-    0x2e5b560e, 0xcf0a47a2, 0xe790a07f, 0xff4e6552, 0xadaf1d60, 0xf9484823, 0x1058743c, 0x2874eb79, 
-    0x2eeb5710, 0xf7f2c5e6, 0x1e4a72ae, 0x58a67435, 0x939e93a9, 0x8abe6532, 0x133738ea, 0xd4bcd205, 
-    0x4aeaad3f, 0xd3f33e0a, 0x16c935aa, 0xfdf33f62, 0x2e27e50a, 0x4673bb8e, 0x636b3a23, 0x5640d806, 
-    0x987ba8ed, 0xa6410a2e, 0x91b41d8a, 0x0ed815b4, 0x49f0ce42, 0xb096b255, 0xda7031da, 0xcbcce9b8, 
-    0xced4fa65, 0xeaff6b6f, 0xaf62e93f, 0x76a7975f, 0xba0be2c6, 0xa490c22c, 0x81641972, 0xce009ae6, 
-    0x34de198a, 0x9ce0ed17, 0x8b83a3b6, 0xd192567b, 0x78bbd33d, 0xaa98f0d9, 0x22ce6012, 0x8d168b88, 
-    0xc787e70d, 0x86c7bbba, 0x2d67d28f, 0x4f257e97, 0x48557917, 0x6e29a6c3, 0xec75a52c, 0x750edb8f, 
-    0x2aace4ae, 0x7a6f1561, 0xfc7ce32e, 0x8a0b75ae, 0x6b65fe1c, 0xde56bb39, 0xd9f8e0b5, 0x79d15cf5, 
-    0xe7ff664b, 0x22d82515, 0xe11739cb, 0x45c67cd2, 0xfaa5c92a, 0x34b905d0, 0x739c8c14, 0xfc62e495, 
-    0xda7adb32, 0xe318eec6, 0x6b1c6737, 0x61ce1f0a, 0x672aa120, 0xb309f00c, 0xc12a120b, 0xd96b27ca, 
-    0x238f802d, 0x9295d5c4, 0xb9f01612, 0x6187217c, 0x9f1e56aa, 0x9febbea7, 0x3f83ae82, 0x2df62e89, 
-    0x20d51575, 0x8962a925, 0x954dee75, 0xe32671ae, 0xac34393c, 0x78764eb8, 0xf9da9aae, 0x92b7c2e0, 
-    0x041e4834, 0x03eda66b, 0xc6cfad67, 0x256f85c9, 0x2e90f109, 0x8f794da6, 0xf9a2ebce, 0x0903a377, 
-    0x04cd9ae8, 0x76b2d86d, 0xea88f3d7, 0x2a4acefd, 0x546a364a, 0x1abe760b, 0x763c9f6a, 0xfb7dbb3c, 
-    0xb65ce767, 0x3e3f1d5f, 0x2d1b6db2, 0x6a82acdc, 0x0b19f1c5, 0xfe4a57f1, 0x6951fa50, 0xe289ea81, 
-    0x64b4d54a, 0xfeb8ebf2, 0x8ebfae3a, 0x5e685cab, 0x06d70f4d, 0xe354b28d, 0x52413129, 0xa4e52a94, 
-    0x79cbecc8, 0xda303f89, 0xa22228a3, 0x03a30c9c, 0x3c234a24, 0xd715170a, 0x02ca7673, 0xc40b2d7e, 
-    0x999bb51c, 0x382b3bef, 0x767f762b, 0x5ce4aec4, 0x356af7bc, 0x6d4ab78f, 0x28e69da9, 0x5cccc5b7, 
-    0x7fb2dd57, 0x43c2d54f, 0x68790880, 0xd9c54a8f, 0xadb7a586, 0x47adada7, 0x3016ccaa, 0xdd30f6ae, 
-    0x69f57b6b, 0x1e0e3827, 0x25994950, 0x5031ed45, 0xd7dad569, 0xa23ae08a, 0xc3bb3b5a, 0xed82cd06, 
-    0x0341a85d, 0x53b6b8ba, 0x78b6825d, 0x042cd975, 0x90ed398a, 0xe4158790, 0x5de32bb4, 0xfa0b620a, 
-    0x7dbedebf, 0x77c5e0e4, 0xe2629d9a, 0xec291998, 0x5deb8afb, 0xef67b7db, 0xe7d9d3bc, 0x22615952, 
-    0xd68ca50e, 0x65575e26, 0x56e91533, 0x70acdf54, 0x78f9d49d, 0xa57bc654, 0xe5aecba9, 0x754c3ae6, 
-    0xa5324aa1, 0x3b8e279d, 0xb2f1e20f, 0xb1a3ca5f, 0x5504aad4, 0xed358954, 0xb1cbaea8, 0x8aeef426, 
-    0xd85d5492, 0x557ed97b, 0x45bf358b, 0xd2bfe2d5, 0x24f964d8, 0x1eced4ca, 0xad95ad64, 0xba9e4a74, 
-    0x3e24d8dc, 0x5746fd69, 0xb135d788, 0x5a99071b, 0xbf505130, 0x1318c1b9, 0xa8a2b8af, 0xe2a38b43, 
-    0x79c26d69, 0xf3b58db0, 0x9d9fca52, 0xb550af12, 0x6df8990e, 0x48faa2ba, 0xd3ded901, 0x5c7c4662, 
-    0xddff3bea, 0x6e3e0675, 0xe4711357, 0xf040df9e, 0xcb15ad70, 0xfdab5fa3, 0x422d01f7, 0x9505f504, 
-    0x290e142c, 0x45d9d061, 0xa6b195bf, 0x3ab6f3dd, 0x707d2ec4, 0xbae5ba9d, 0xf25d81b6, 0x2b992386, 
-    0x50ad8658, 0x49a478e7, 0x47cb1228, 0xdde6f226, 0x994f89d9, 0xc4fb5c0d, 0x2afb6318, 0xf5bf56db, 
-    0x3745a95f, 0xf72a4ccb, 0x64d8db94, 0xf28d24f8, 0x5d5148ca, 0x2f5c1eff, 0x3835d82b, 0x2fc3429f, 
-    0x1ecb1ece, 0x8e3d85d4, 0x378f7151, 0xa8347e76, 0xcf9ccdf4, 0x56ee9aaa, 0x29c29f4d, 0x7d4a4c63, 
-    0xd0db3fe7, 0xaa1b67cd, 0x2763cb5f, 0xf286d1d4, 0xf109f1fc, 0x515fe33e, 0xdb89e745, 0xf0e5cdd3, 
-    0xaf302564, 0x42d5b69a, 0xbb556fbc, 0x8e361999, 0x1e77b70e, 0x99a5cf7e, 0x4f7c0861, 0xc67ae1ec, 
-    0x2b9e9541, 0xea5517eb, 0x4aa217fd, 0x27a67205, 0x56ebc332, 0xe0c69bb5, 0xf5e199a5, 0xbb5a80d4, 
-    0x207773aa, 0xefc97c8f, 0x7412f9d5, 0x7dfeafc8, 0xc2fcfd5e, 0xebc3324b, 0xab5fc957, 0x2eff40da, 
-    0x65220f61, 0x5b251957, 0x5db39b8b, 0xac938475, 0x09c55296, 0xe50915be, 0x5647b2c1, 0xfe31ac2f, 
-    0xdde31cbb, 0x6f5d2325, 0x6e06190d, 0x73ac7b16, 0xa7c552d5, 0x5b2ce840, 0xb6a9e76d, 0xa350eb4f, 
-    0x159a2daa, 0x333f3daf, 0xd2f9806a, 0x738f7a69, 0x2f9a0cbe, 0xebe6a131, 0xe2edf575, 0x03055e5c, 
-    0xf4ca67d9, 0xb7d4513d, 0xb1efc735, 0xcff49b26, 0xff5efb3c, 0xabb56738, 0xacf2ea2a, 0x405909f6, 
-    0x9ffeca96, 0x58e6d592, 0x05fd55df, 0x7f7ca7b1, 0x0629aae5, 0x5f3b0574, 0x1adb4d49, 0x94d6bcb6, 
-    0x187a8264, 0xbace3aa6, 0x91cf3bf3, 0x623bd677, 0xbd9c2518, 0x19d165d6, 0x155635f6, 0x3b6212b0, 
-    0x3ed37543, 0x7beefd7a, 0xafaa76c5, 0x7bdefbb6, 0x93093cb5, 0x3812a3f3, 0xc5d345bf, 0x34956022, 
-    0xfc1f1570, 0xd24b9dee, 0xd16d999b, 0x4b7512b4, 0xa3b0bb64, 0x4e9ba1ae, 0xb9b6331c, 0x42c768a2, 
-    0x2e2561f4, 0x77e47ad2, 0x5c7d5d34, 0xd1c78133, 0x5947c2ae, 0x0c0f4c93, 0xb283d37a, 0x162a4efe, 
-    0x55469116, 0x05566e6f, 0xf3b5c746, 0x6c6db1be, 0xe2ef7978, 0xe331e1a1, 0x9b8343ba, 0xe3c586c6, 
-    0xc6968785, 0x3e17c6e9, 0xb5ae321e, 0x63d9d4a5, 0xa54f1d1b, 0xd5c347c6, 0xa873ddd7, 0xd1a6ef7a, 
-    0x8785f5f1, 0x71a93dbc, 0x064b57f1, 0xf5f3426b, 0x597fb289, 0xc72d927c, 0x5f18fec4, 0xf62b9ae5, 
-    0x328318d9, 0x8eabfddb, 0x6cf46daa, 0x231fb9f5, 0x76eb3d6f, 0x9835db3c, 0x29621477, 0x2be94f3e, 
-    0xd7bbddb6, 0x8208acaf, 0xb12f086b, 0xd255f272, 0x77eb1351, 0x75e4bc4d, 0xcb58491c, 0xc7d0a27a, 
-    0x8c73b7a5, 0x0671b2a0, 0xec69951c, 0x43362c9a, 0xb0d56955, 0x77ab39ea, 0xc238415d, 0xbf188d66, 
-    0xf5f54cf7, 0x180ee407, 0x92ec9418, 0xfaea76ab, 0x84db2c19, 0xa6b192bc, 0x3a0054e3, 0x264b65b3, 
-    0xe9e8ae63, 0x435b4159, 0xda3df3be, 0x99325b31, 0xcf4b664c, 0xa63d158a, 0xba9bd269, 0xc26f3cc1, 
-    0x17369318, 0x283a969f, 0x39e29d1b, 0xca2f68bb, 0x1c6b18fd, 0x2663194c, 0xb6a87019, 0x4dfe051c, 
-    0xa3cd351c, 0x12e45979, 0xe6f4b5c5, 0x5420193b, 0xf73b28cd, 0x9a5fafb2, 0x5424e2f8, 0xf9ff81d3, 
-    0xf4b77c59, 0x549ae259, 0x4f205ffc, 0x2ee54a44, 0xd52eca4c, 0x1a0f2c63, 0x02a40924, 0xba69bcf1, 
-    0xb37eff0e, 0x3bb65e7a, 0xd15fbebb, 0xea7193f9, 0x26eeb285, 0x70e8a70a, 0x80ce752e, 0x3c780c14, 
-    0x1298ceb3, 0x23057bfc, 0x7caa53d1, 0x8ece262e, 0xf240a148, 0x3b595ef6, 0x04befe46, 0x83fee2d6, 
-    0x2a9fea29, 0xbaf617ba, 0x967c170e, 0x5ac7222c, 0xa2c25cfe, 0x276453fe, 0xc932e3a4, 0x21cfa948, 
-    0x1d776390, 0x8e323aa6, 0xaca67233, 0xcd4e683a, 0xaa8e2b87, 0x48a79059, 0x9c554e16, 0x1e784820, 
-    0x098b3b64, 0xb6c1836c, 0xa38a9eec, 0xc53c982b, 0x5ae5c530, 0xf3339090, 0x5e7acdfb, 0xcf226bc0, 
-    0x79922aee, 0x7544f18a, 0xa02afc40, 0x1b8d074e, 0x40ee5463, 0x4424984c, 0x1e9af2d9, 0x1bb39963, 
-    0x7ac7b99d, 0x134cd49e, 0x1c93c946, 0x7da4986d, 0xa76ce321, 0xcd4e3ce4, 0x9a734b5b, 0x4de75c3d, 
-    0x2dc6afb7, 0xee79af4d, 0xcf2c4245, 0xd96926c3, 0x67cb1992, 0x1988f3c3, 0x53f625f3, 0x64a9a846, 
-    0x72ccb910, 0x6f29780f, 0x5f4b92a6, 0xe0303256, 0xfcaa82f3, 0x98ab0e4a, 0x68d09c76, 0xed067670, 
-    0xd2997a12, 0xa59b4d08, 0x37efc4e2, 0xda46f03b, 0x78db17ba, 0x859a9ee3, 0xc467c5b7, 0xb6143daa, 
-    0x224291f7, 0xe7d4d457, 0xeebc9aa0, 0xd525e455, 0x3b559d67, 0xce3831e8, 0x67cd33c5, 0xf833e99d, 
-    0x01753eec, 0x20febefd, 0x99e717f5, 0xf29bc99e, 0x0c4658ac, 0x919afb83, 0xfb42e27c, 0x571755d4, 
-    0x5515f7c0, 0xed5873f6, 0x902a57ca, 0x03c6d427, 0x41b50d8b, 0x54d819a4, 0xe0b3093e, 0x1c2d4573, 
-    0xa86c6aa2, 0x9cb133a2, 0x18965fa4, 0xdae067d6, 0x950f505f, 0x5442fd8e, 0x2f278e56, 0x69af4929, 
-    0xb29cfabe, 0x27b6ab8b, 0xb6addce4, 0xb9574ee7, 0x8d1d2eae, 0x69b1a3c1, 0x8a6f3d84, 0x357a4956, 
-    0x513968a1, 0xaa6f3d2c, 0x1b6f351f, 0xf8ab549d, 0x9ec11f14, 0xca0dc80f, 0xaaca563d, 0x0e96d5fe, 
-    0x50dade04, 0x3c9e40d4, 0x7af22f42, 0x72eee1d0, 0xde88ce0f, 0x43a39f57, 0x5feea97e, 0x7941ee5e, 
-    0xb3ddb07e, 0x7c6cf703, 0xc33f472b, 0x629e869a, 0xc957ba3a, 0x88d32688, 0x2eabb9a2, 0xef1a2dd9, 
-    0x873ace5c, 0x7fca7f76, 0x1dc94c13, 0x68c70a9e, 0x1f05f2e6, 0x22266b11, 0x33c98be4, 0x39c22fbd, 
-    0xed39c0e1, 0x6ec22ddf, 0x7115ce27, 0x4b93d925, 0xe17ce553, 0x96369e54, 0xc88c8e4f, 0x70be75bc, 
-    0x8967d25e, 0x5fbc9577, 0x35b92af5, 0x56b8d9de, 0xc956db5c, 0xe47f9219, 0x55e90725, 0xb8d76138, 
-    0x676d909d, 0x23d3b9ec, 0xcf3bf6aa, 0x911a2861, 0x2dc628e1, 0x7d931247, 0xcbbba4a4, 0xf6738a24, 
-    0x98d2797e, 0x0fb289a2, 0x239b39c6, 0x0af1dd38, 0xc2fb0581, 0x59b9c4e7, 0x561e315c, 0xa1b9343e, 
-    0x1d2778c8, 0x1c98c669, 0xe523cda0, 0x8f36c8f9, 0xcb16f3e4, 0x8ae74af3, 0xec337cd9, 0xff169de0, 
-    0x1f88abdc, 0xb34923d3, 0xf6814e8b, 0xad616095, 0x2b9fd6df, 0xd2da0434, 0x40a75865, 0x0d13bddb, 
-    0xa2bac98f, 0x472b38e1, 0xe722bcf9, 0xc2a1b58a, 0xd657b7d1, 0xaedebbe2, 0x0a66e5b5, 0x4aba35a2, 
-    0x38ab4c16, 0x9b0556e4, 0x9f068652, 0x5d67e189, 0x986a4eb6, 0xbdfa2b3e, 0x55cb6b94, 0xfd63858f, 
-    0xe3398ab2, 0x27489c71, 0x2e1523b9, 0x4fa7df4b, 0x078912ce, 0xeb950d36, 0xd6169ab1, 0x0f3f6d63, 
-    0x938f09f3, 0xa7a6cf17, 0x54f4c5d5, 0xbcf920cb, 0x4c530042, 0xe5b37efc, 0xa8f8b46b, 0xe69daad4, 
-    0xb1f5271b, 0x9c6d1d32, 0xcddd31b3, 0x7ed5ba3d, 0x91ee0b8d, 0x952392fa, 0x6938d5bc, 0xab2e3fcb, 
-    0x728cb75f, 0xf18c59db, 0xb5a93cb5, 0x0e7e30b3, 0x612ea479, 0xf636dceb, 0xc6b7dd93, 0x4ef330b2, 
-    0xae499050, 0x6fd3579f, 0x42207ef2, 0x6b949c6c, 0x292d76c0, 0x8a28d4a3, 0x573ee9a2, 0x82ab9e2f, 
-    0xe905258f, 0x62523dea, 0xe522ce23, 0x4b012a20, 0x0648b2d4, 0x5238a1ac, 0x1caa1bbd, 0xa0f69294, 
-    0x9e38f24b, 0xb144eaf5, 0xd0eddd4f, 0xe71d2aa7, 0xf67986bb, 0x9e3f3a4d, 0xdb990c58, 0xe6afdece, 
-    0x9645c79d, 0x699d2bf9, 0x882ace42, 0xd51bc8fa, 0x7e6357b4, 0xedc8c95d, 0x7eaa33e2, 0x8fd7154c, 
-    0x3397a391, 0xa16121dd, 0x4d939019, 0x024d0352, 0x9d9f35cd, 0xe320f2ce, 0x4259c260, 0x76daa2c4, 
-    0x1c47c58f, 0x12c88cb0, 0x7245eaa7, 0xef695ed4, 0x9d35ec2c, 0x3cd171f2, 0x57321cfb, 0x791d5305, 
-    0x76538e8e, 0xeba6f670, 0x196854f6, 0xb505c9d7, 0xd07ccd20, 0xadc98d65, 0xdf89d9e7, 0x1cccca76, 
-    0x84babd14, 0x18653bcf, 0x4d1c8567, 0xc131c3dd, 0x5059e4b0, 0xa1511d26, 0xd49c69b5, 0x3034c0f3, 
-    0xa5321948, 0xe3857df2, 0x7e5ad87c, 0xdf2cb697, 0x78bf792c, 0x560e345e, 0xf2aca933, 0x0da5d1db, 
-    0xef407d0e, 0x596ab206, 0x2a29ca12, 0xdd012ddf, 0x2cc33bcb, 0x788245d6, 0x0c616d97, 0xb26ece38, 
-    0xfda946f7, 0x28a43ecf, 0x31558fa0, 0xc959fad8, 0xbb6e6234, 0x838b6da0, 0x50538b65, 0xf7ae2b5b, 
-    0xb74ea996, 0xad65ede0, 0x159e693e, 0xdf44fc16, 0x47c46802, 0x603d4829, 0x96d9ea25, 0xda3f2d01, 
-    0x35b3f0a3, 0xf8668746, 0x2b5561d9, 0xa72c710d, 0x8ef61287, 0xdbaf2f2c, 0x79aaa655, 0x68370445, 
-    0xa11e4d70, 0x39890774, 0xd8ea4e1d, 0x643c63ab, 0x93114cd8, 0x89522d32, 0xd553dd22, 0x87f6d716, 
-    0x77202c40, 0x4e384923, 0x8e77b77d, 0x510e68e7, 0xb573eeb4, 0x5833f5a7, 0xe7d29036, 0xe7acab08, 
-    0xf69943e8, 0x7ece7c84, 0xb73801b2, 0xbc80e39c, 0xd1052392, 0x47cc1688, 0x8c585d1c, 0x44185204, 
-    0x2171ab06, 0x736b1bd6, 0x576128b8, 0xad7284b5, 0xa1d6bb43, 0x13e0eb5d, 0xd4c7190d, 0xb1fa1563, 
-    0x8558fd0a, 0x99cdcc7c, 0xd38e554b, 0x76fc2a4b, 0xc390d24d, 0x6c3e0b14, 0x0e6382a7, 0x052095c1, 
-    0xf92acf9b, 0x8e2a9394, 0x16e7a453, 0xe6ef2d31, 0xf9f97be7, 0x1f7cfc25, 0xcfcfdf3f, 0x69f3f00f, 
-    0x3f397e7e, 0xafcfc43f, 0xf157e7e4, 0xf9f86bf3, 0x08fdfcb5, 0xfbe59f7f, 0x344ba61b, 0xa48e36fd, 
-    0xd317f368, 0xd0eda716, 0xce2a548e, 0xcb75d759, 0x01a8f9f4, 0xb606a09e, 0x84f1b623, 0xb2c1b3b4, 
-    0xec842799, 0x79fc9d8a, 0x54676591, 0xdfe5efbf, 0xd6ade52f, 0x24cf86c7, 0xcfe01e7f, 0xcb4078cb, 
-    0x3c15ffb9, 0x67792b31, 0x35e7f30d, 0x8602f9fc, 0x59e18467, 0xdfd7d537, 0x83c70a98, 0x83bc70a9, 
-    0xbbaf4bdf, 0x97b8e152, 0xb8e779ef, 0x5e759726, 0x5b682e5a, 0xffa95e96, 0x772dbb49, 0xf2ada925, 
-    0x8aa32822, 0xaffa5efd, 0x85499362, 0xd1d96167, 0x04c9f4e8, 0x78ade3d6, 0xb9ec3e3b, 0x262758b0, 
-    0x6a7145ba, 0x39f6d36d, 0x483182b3, 0x69ee146b, 0x5abf60fb, 0x325515f6, 0x5e18d38d, 0x6bbff5c9, 
-    0xcfc4fe39, 0xc5c16896, 0xb7c635bb, 0x5e0bc631, 0x85acbf68, 0xc1d77eaa, 0xb9f8bb9f, 0xad72cb6e, 
-    0x1798bf7e, 0xee7f0972, 0xf9fae7e3, 0x3eff24b9, 0x19a5edc5, 0x538641ae, 0x7f0c84ef, 0x5f9f8abf, 
-    0xe5acedcd, 0xf6e02e76, 0xb2fee42f, 0x7e22f9fc, 0x773f036e, 0x237eff31, 0x6e26f7b7, 0xefee52ff, 
-    0xca3cfe32, 0xcfce5fdf, 0x6cedc95f, 0xe2ae76e5, 0xfdc2dff6, 0xd7cfe36d, 0xf83b73f0, 0xf7f96bb9, 
-    0x5dbdb93b, 0xdcf5fedc, 0xf9fc0ddf, 0xcdfdfc6d, 0x6e1efcfc, 0x73b71f67, 0x1b7fb72b, 0x9fce37f7, 
-    0xbdcfc1df, 0xc03b9f93, 0x6e33ffbf, 0xffb720ef, 0xddefee2e, 0x7f10f9fc, 0xfe7e1eff, 0x07cedc7d, 
-    0xdc239db8, 0x7f739ffe, 0x844f221f, 0x4f385293, 0x6f330f3d, 0x5d4b4b0c, 0x96a892d4, 0x552f8e70, 
-    0xab8cb83d, 0x9fe65fc6, 0xe5cb0644, 0x33198675, 0x2d1ef6a9, 0x43a94e1e, 0xcefd6bad, 0x624ad152, 
-    0x552863b0, 0x2e46c31d, 0x59c4daa0, 0xdcfccdf6, 0x874e7e3c, 0x3b72b5cd, 0xda5d4c6d, 0xe02caa99, 
-    0x3ce25013, 0xd83c85d8, 0x3a14160e, 0xac93bef9, 0xbdb9187b, 0xa651dc8c, 0xee46616a, 0x23772310, 
-    0x91847723, 0x6ea632fb, 0x7515a7ab, 0x6d54ca5b, 0x65f52339, 0x1806cd4c, 0xa9191ba9, 0x61d48c23, 
-    0x46216ea6, 0xe5491aee, 0xf3d738d4, 0x71e22f38, 0x2fefe06e, 0xf237efe6, 0xeff137ef, 0x5fedc4df, 
-    0xf213edc2, 0xb0e7f6af, 0x60954a65, 0xde78651f, 0xce5cf0cc, 0xcfc15fcf, 0x8dedc95f, 0xb95b7b71, 
-    0xbfb8abbf, 0x573c30b7, 0x78db3c33, 0xbb73b7de, 0x3bbb70d7, 0xb96bdfb8, 0x1f3c9ddf, 0xab0e54e6, 
-    0x3cd0b378, 0x70a5375d, 0xef9e7ae5, 0xbb4eecdd, 0x46e3d781, 0xf1b78f5e, 0xf7f137f7, 0x6feff337, 
-    0xe1efdfe1, 0xfb72f7f6, 0x5bffb8fb, 0x18dbffb9, 0xbe19dbbe, 0x7ef71e71, 0xf9dbf71e, 0xdfe0eff7, 
-    0x3fdb93bf, 0x19ffedc0, 0xf7077ff7, 0xbbe1907f, 0x177be193, 0x8c5dd3e3, 0x3c66ef4f, 0x1fef9bbb, 
-    0xe1effbe6, 0x7f97bddf, 0xf76e3ef7, 0x07eedcfd, 0xdc23dfb8, 0x5c339fef, 0x3eb8641f, 0x87bae3c4, 
-    0x3e61f5c7, 0x7a3c80d1, 0x7c907dfa, 0x7e5aea6d, 0x0e7c960e, 0x7bcecfa8, 0xba38eb29, 0x6f03f732, 
-    0xd2d4bef0, 0x35e64799, 0xe197cc1f, 0x9febaf8d, 0x7abffe34, 0x61cef387, 0xaced20be, 0xc1053fec, 
-    0x293f676c, 0x2f163547, 0xdd03a18e, 0xa47e8258, 0x33274431, 0x460d8b20, 0x27170e6d, 0x2aab6cec, 
-    0x954e4675, 0xa5555eae, 0x592acfe5, 0x3d3dcac6, 0xeb1ce4fb, 0x19a51d50, 0x5c66b157, 0xaaae55cb, 
-    0x98f93c98, 0x3931553c, 0xadaf31f2, 0x63e43262, 0x42c55432, 0xf04e7d15, 0x4e7f24e7, 0x0a7436f1, 
-    0x3f266e55, 0xb256b79a, 0x4876e550, 0x7df01799, 0xf1d753cd, 0x8d2cf5e7, 0x0cfed46e, 0xc7d9f1ad, 
-    0xa14b172c, 0x67216576, 0x623a6185, 0xf73ac9b2, 0xac42aed2, 0xc57671bd, 0x464f3f5c, 0x13746990, 
-    0xd30b464f, 0x464f10e6, 0x56e2d323, 0x4cf98c9e, 0x193ca393, 0x13706982, 0x0b0b464f, 0x8c9e211a, 
-    0xfd309646, 0x1641193c, 0x193ca234, 0x2b706982, 0x497cc64f, 0xddfafb73, 0x2bd42fbc, 0xdbf54560, 
-    0x3eb5212f, 0x837745fb, 0xba2ad4e1, 0xd2a70aef, 0x9385befa, 0x08d24b64, 0x883cea7c, 0xb9c2715f, 
-    0xa4a70a07, 0xb18a7916, 0xdf2a6f3b, 0x35e8f68e, 0x5a2a87e0, 0x06164201, 0x9506d750, 0x976be008, 
-    0xaea7bdac, 0xb8cf1c2b, 0xf23df71d, 0xa2a20bbe, 0xe8ad020a, 0x75036be2, 0x5d2d62b2, 0xbad0b0bb, 
-    0xc678e15f, 0xb1efb8ed, 0xed1d87ee, 0x84ed1d84, 0x1d84ed1d, 0xed1d84ed, 0x5b3b5584, 0x7e3f5d76, 
-    0x375b8ed3, 0xdd67badf, 0xbf6e5b9e, 0xcc5b86f2, 0x2dbf6f3d, 0xc29a5c9a, 0xf5c2ec16, 0xd84dc718, 
-    0x19b15b81, 0xd60f62b7, 0xc16e0f61, 0x3712b8ed, 0xd89816e0, 0x36e3b783, 0x52c49144, 0x5ad8aca4, 
-    0x91a7dce0, 0xffc55754, 0x319ca744, 0xdc517a43, 0x52b5f232, 0x646a085a, 0xb93aef9d, 0x0a974813, 
-    0x226713ca, 0xe749d312, 0x9d272c22, 0x0c41768c, 0x42c7100b, 0x0baa0359, 0x1e8dd08b, 0x94af462c, 
-    0x43e8129a, 0x653c3cbf, 0xb8796900, 0x610c72ca, 0x89583205, 0x6ac61855, 0x5c5ac1ac, 0x82310b80, 
-    0x3d61d62c, 0x5c06c22e, 0x84d88d8c, 0x5c12e137, 0x0cb8cd8a, 0x378a305b, 0x815c72e3, 0xad86312b, 
-    0xc16f0ab8, 0xed86d8d5, 0xc1ae2b78, 0x38e0610e, 0xf83de30e, 0x9f8a389f, 0x07b8bde2, 0xe0cf8e7f, 
-    0xbf1e7c01, 0x00fc11c2, 0xfc51f087, 0x0f8b7e07, 0x7ef02fe1, 0x887e13fc, 0xf8b3e0df, 0x330efc1b, 
-    0xf0c71978, 0x27853c45, 0x8b5c25f1, 0x8980989d, 0xf217616f, 0x8bbe26f8, 0x7c69e36f, 0x3ae12f07, 
-    0xe14c2ffc, 0xd710787b, 0x08f8d7e3, 0xfc29c19e, 0xdfe3760b, 0x007c0bf1, 0xbc06e237, 0x26e3370d, 
-    0x61cf82dc, 0x2f61f60f, 0x186dc56e, 0x8fd8edc7, 0x7867e3b7, 0x9de00e07, 0xc41c33f8, 0xafe1c81d, 
-    0x89dc2ef0, 0xfc6ef0bb, 0xa4c4bf1c, 0x9c0a8970, 0x85b84145, 0x7e37ff07, 0xaf0b1f84, 0x7c09c4a8, 
-    0x6a895459, 0x827e1bfc, 0xf08d4547, 0x87515a89, 0xee22f017, 0x3cf1f7c3, 0xff1a634e, 0x2cf0e78a, 
-    0x0efe37fe, 0x78f5115f, 0xaf80ff18, 0x10f1efe3, 0xf1bb81be, 0x2f87de38, 0x157c09e0, 0x7c7e135f, 
-    0x83440450, 0x08908a08, 0x1468888b, 0xcc59a24d, 0x55a22d13, 0x317689b4, 0x4c45445f, 0xb171102c, 
-    0x4e887450, 0x891625d1, 0x1623d16e, 0x44b15e8b, 0xd109152c, 0x5245fa27, 0x4880c4a4, 0x5062658b, 
-    0x6243172c, 0x9588c885, 0x16189562, 0xb11ac5ab, 0xcb7e3bd6, 0x6b7d7d0d, 0xf76bbcfb, 0x96e7bf5c, 
-    0xeef36f5d, 0xbf2cf7e0, 0x9eef52ef, 0x1cec764b, 0xe7977dbf, 0xaa36f516, 0x6f536ede, 0x03b7a957, 
-    0x2afaadf2, 0x3bedcf73, 0x75dcee76, 0x07d5edcb, 0xf1dacbac, 0xb75dcc5b, 0xcf73b6de, 0x6bccbbad, 
-    0x935ea26f, 0xac2f6b7d, 0xfed775bd, 0x7f5cf69b, 0x371dcec3, 0xf6e7b2dd, 0xfd75d1ca, 0x2e8ff47d, 
-    0xcfa2f9fa, 0x8be948ba, 0xd018bea4, 0xc5f5cb17, 0xa658be90, 0x45f5062f, 0x74062f9a, 0xf3fd493b, 
-    0xad22eeb4, 0x76e94e5b, 0x524efa92, 0xedd4933f, 0x03a835a4, 0x0694e1fa, 0xe85d6923, 0x9e1a93de, 
-    0xbfa17594, 0xf45dd01a, 0x96ea9d5b, 0x01d41a93, 0xf2dd61eb, 0xc0678680, 0x796e971a, 0x6d3cff40, 
-    0x476ad00d, 0xef8ef1de, 0x3da6f6bd, 0x35e6df3b, 0x6eef916f, 0xeba6e9f5, 0xb7adfbd4, 0x6fdbe7f3, 
-    0xdcc3bddb, 0xbd7f96e5, 0x3be4dbe6, 0xebb26b53, 0x2dfa60af, 0xee421070, 0xc6ef030d, 0x2bf0212f, 
-    0x7e060afc, 0x6042df8d, 0xf0303306, 0x6d21d13b, 0x51ba9adc, 0xa568d51b, 0x7591bec0, 0x4a8cde9b, 
-    0xdce21155, 0xe4e44d39, 0x98ac51f7, 0xa8a1bdf5, 0xeeb775df, 0x9bba89d8, 0x877eb86e, 0x7350933c, 
-    0xc48ba216, 0xa7e42a23, 0xee4efce5, 0x7b9d28e2, 0xe2848886, 0x62c2b257, 0x74135e40, 0x0177f27d, 
-    0x57a0420c, 0x76e5173e, 0xa95c94ee, 0xef92ef11, 0xbb8bf961, 0x26fd1ef8, 0x0bffc884, 
+// Generated by tools/bake_font.c from Profontwindows-axBMx.ttf at size 30, do not edit. Run 'make font' to update.
+// Pre-rasterized glyph atlases of the menu font, one per font level.
+
+#define BAKED_FONT_LEVELS 3
+#define BAKED_FONT_GLYPH_COUNT 95
+#define BAKED_FONT_GLYPH_PADDING 4
+
+typedef struct baked_glyph_t {
+    short value, offset_x, offset_y, advance_x;
+    short x, y, width, height; // in the atlas
+} baked_glyph_t;
+
+typedef struct baked_font_t {
+    int size;
+    int atlas_width, atlas_height;
+    int pixel_count, compressed_size;
+    const unsigned char *pixels; // alpha channel of the glyphs, the color is white
+    const baked_glyph_t *glyphs;
+} baked_font_t;
+
+// 15px, alpha values of the glyph rectangles one after another, compressed with the DEFLATE algorithm.
+const unsigned char BAKED_FONT_PIXELS_0[] = {
+    0xbd, 0x58, 0x7d, 0x50, 0x54, 0xd7, 0x15, 0xff, 0xed, 0x82, 0xc4, 0x9a, 0x2c, 0x2e, 0x1f, 0x31,
+    0x7c, 0x4c, 0xf9, 0x50, 0x4c, 0xad, 0x06, 0x7d, 0x22, 0x63, 0x9a, 0x14, 0x32, 0x97, 0x62, 0xd4,
+    0xb1, 0x03, 0xc6, 0xaa, 0xfc, 0x61, 0x82, 0x2c, 0xd2, 0xce, 0x64, 0xf2, 0x0f, 0xd4, 0x69, 0x9a,
+    0xb1, 0x65, 0x9c, 0x67, 0x62, 0xfd, 0x4a, 0x28, 0xd6, 0x92, 0xf8, 0xb1, 0xd2, 0x35, 0x5a, 0x74,
+    0x1a, 0x35, 0x1a, 0x13, 0x83, 0x4e, 0xaa, 0xb7, 0xd1, 0x6a, 0xc4, 0x85, 0x40, 0x14, 0xe3, 0x4c,
+    0x9d, 0xaa, 0xc4, 0xa9, 0x31, 0x64, 0x41, 0x81, 0xe0, 0xc7, 0xae, 0xcb, 0xe9, 0x9c, 0xfb, 0x76,
+    0x61, 0x97, 0xdd, 0xc5, 0xda, 0x3f, 0xf2, 0x60, 0xcf, 0x99, 0x77, 0xdf, 0x3b, 0x5f, 0xbf, 0x7b,
+    0xce, 0x3d, 0xf7, 0x3e, 0x7c, 0x5f, 0x97, 0xad, 0x56, 0x97, 0xfe, 0x3f, 0x61, 0x7b, 0x34, 0xb9,
+    0x74, 0x9b, 0xd4, 0x05, 0xf9, 0x7f, 0xb5, 0x36, 0x4d, 0x42, 0x11, 0xe8, 0x57, 0xa4, 0x83, 0xf4,
+    0x0c, 0x79, 0xf3, 0x4a, 0x2b, 0x49, 0x0d, 0xfc, 0x14, 0x20, 0x75, 0x09, 0xd1, 0xea, 0xa8, 0x22,
+    0x61, 0x85, 0x4d, 0x64, 0xe8, 0xac, 0x54, 0x97, 0x00, 0x46, 0x2d, 0x3e, 0xe7, 0xaa, 0xb4, 0xa2,
+    0xba, 0xb3, 0xe5, 0xda, 0x85, 0xa3, 0xb8, 0x5c, 0xae, 0xcb, 0xf4, 0xe3, 0x09, 0x1f, 0xec, 0xaa,
+    0xe1, 0x67, 0x4f, 0x7f, 0x49, 0xf7, 0x0f, 0xe4, 0x02, 0xa6, 0x4d, 0xe7, 0x77, 0xb7, 0x9b, 0x96,
+    0x67, 0xeb, 0x32, 0x95, 0x26, 0x6e, 0x6e, 0xda, 0x77, 0xae, 0xa1, 0xdd, 0x94, 0xba, 0xb9, 0x57,
+    0x3d, 0x33, 0xb4, 0x00, 0x69, 0xd9, 0x00, 0xac, 0xeb, 0xa5, 0x94, 0x52, 0xdb, 0xde, 0xd2, 0xf9,
+    0xcf, 0xd7, 0x49, 0x5c, 0x7f, 0xe1, 0x4f, 0x87, 0x76, 0x74, 0x67, 0x3a, 0x57, 0x34, 0x7a, 0xbb,
+    0x73, 0x51, 0xd2, 0x4f, 0xd4, 0xb3, 0x08, 0xe6, 0x83, 0xf4, 0xdd, 0xea, 0x9e, 0x51, 0x3b, 0xba,
+    0x77, 0x37, 0xc7, 0x52, 0x36, 0x2d, 0xd4, 0xfa, 0x5e, 0x77, 0x45, 0x93, 0x30, 0xad, 0xfe, 0x57,
+    0x09, 0x46, 0x2d, 0x3e, 0xb4, 0x2b, 0x1b, 0xa8, 0xee, 0xac, 0xd9, 0xdf, 0x02, 0x5c, 0x2d, 0xb3,
+    0x36, 0x9d, 0x06, 0xda, 0x1a, 0x9a, 0x9a, 0xe3, 0x80, 0x59, 0x74, 0x33, 0x11, 0xc0, 0xc7, 0x5f,
+    0x74, 0x6d, 0x8f, 0x97, 0x33, 0x3b, 0x17, 0x4e, 0x77, 0x75, 0xb5, 0xc4, 0xbd, 0xdd, 0xb4, 0xb0,
+    0x8d, 0xde, 0x35, 0xa7, 0xbc, 0xd3, 0xf9, 0xb1, 0xf8, 0x4f, 0x8e, 0xf2, 0xe3, 0x07, 0x30, 0x50,
+    0xb2, 0xd5, 0x02, 0x88, 0x05, 0x50, 0xf6, 0x75, 0x2c, 0xca, 0xdc, 0x65, 0x28, 0x75, 0x97, 0x01,
+    0x72, 0x23, 0x00, 0xa9, 0x07, 0x93, 0x55, 0x00, 0xde, 0x74, 0x69, 0x80, 0x79, 0xab, 0x6b, 0x3a,
+    0x60, 0xda, 0xda, 0x19, 0x0b, 0x98, 0x7e, 0x02, 0x8b, 0x19, 0x38, 0x62, 0x37, 0x43, 0x73, 0x19,
+    0x04, 0x58, 0x40, 0x80, 0x08, 0xf8, 0x15, 0x10, 0xe2, 0x9a, 0x9d, 0xf1, 0xcd, 0x67, 0xad, 0x47,
+    0xcf, 0x5a, 0x31, 0xd9, 0x6a, 0x4c, 0x15, 0x80, 0x17, 0x9e, 0xd3, 0xe5, 0x8f, 0x97, 0xa3, 0xc6,
+    0xfb, 0x4d, 0x8f, 0xbb, 0x31, 0x26, 0xaa, 0x8e, 0xe8, 0xb3, 0x44, 0xec, 0xb9, 0xe5, 0xbc, 0x7a,
+    0xf1, 0xfa, 0xe8, 0xa7, 0xc6, 0xe9, 0x32, 0x7a, 0x26, 0x00, 0x61, 0x53, 0x1e, 0xfb, 0x98, 0x0f,
+    0x47, 0xc5, 0xfc, 0x13, 0x26, 0x1c, 0xad, 0x42, 0x58, 0x07, 0x9f, 0x29, 0xd5, 0x58, 0xd9, 0x30,
+    0x66, 0x8c, 0x87, 0x16, 0xa3, 0xe2, 0x3b, 0x1b, 0x16, 0xb9, 0x9f, 0xd7, 0xdc, 0xaf, 0x00, 0x79,
+    0x80, 0x24, 0x22, 0x4d, 0x08, 0x81, 0x95, 0x0d, 0xa3, 0xc7, 0x78, 0xe8, 0x19, 0x54, 0xfc, 0x21,
+    0x4a, 0x49, 0xfd, 0x54, 0xc6, 0x28, 0x7e, 0xec, 0x3d, 0xc3, 0xdc, 0xfd, 0xc9, 0x8a, 0x9f, 0xf8,
+    0xab, 0x62, 0xcf, 0x7b, 0x9e, 0x54, 0xfc, 0x33, 0x87, 0x62, 0xf3, 0xdc, 0xe3, 0x99, 0x99, 0x9c,
+    0x5b, 0xd5, 0xed, 0xfc, 0xbb, 0x69, 0xea, 0xb6, 0xad, 0x4e, 0xdd, 0x2e, 0xba, 0x9d, 0xa2, 0xb8,
+    0xb3, 0xd6, 0x48, 0xcb, 0x94, 0x04, 0x83, 0x8f, 0x5a, 0x7c, 0xe8, 0xef, 0x95, 0x56, 0xfc, 0xae,
+    0xb3, 0x66, 0xf5, 0xd5, 0xa3, 0xe8, 0x28, 0x85, 0xb9, 0x7e, 0x60, 0x02, 0x09, 0xb3, 0xbd, 0x9b,
+    0x04, 0x15, 0xd8, 0xbb, 0x73, 0x49, 0x90, 0xb3, 0x3b, 0x17, 0x24, 0x7a, 0xbb, 0x73, 0x61, 0xa1,
+    0x9c, 0xba, 0x8b, 0x0b, 0x0a, 0x1b, 0xda, 0x4d, 0xc9, 0x75, 0xbe, 0x24, 0x5a, 0xc9, 0x0a, 0xb5,
+    0xfa, 0x7b, 0x1c, 0xe7, 0x5c, 0x79, 0x45, 0x86, 0x20, 0x12, 0xcc, 0x7c, 0xc0, 0xf8, 0x60, 0x1a,
+    0xb2, 0xfe, 0xc6, 0x85, 0xa3, 0x78, 0xb7, 0x18, 0xc8, 0x18, 0xc8, 0xe4, 0x77, 0x7f, 0xe9, 0x65,
+    0xff, 0xca, 0x3d, 0xe5, 0x8c, 0x9d, 0x41, 0xdd, 0x0c, 0x76, 0x99, 0xb7, 0x5e, 0x08, 0x61, 0xf5,
+    0x06, 0x89, 0x57, 0x1b, 0xe2, 0x3b, 0x8b, 0x81, 0xf1, 0x03, 0x1c, 0x75, 0x54, 0x65, 0x5b, 0x14,
+    0xa0, 0x13, 0x95, 0x00, 0xc8, 0x28, 0xdc, 0xfd, 0x3e, 0x96, 0x67, 0x03, 0xa9, 0x94, 0xb9, 0xb9,
+    0xa9, 0xa8, 0xd0, 0x57, 0x01, 0x07, 0x79, 0x1e, 0xa1, 0x1d, 0x53, 0xd4, 0x45, 0x8a, 0x3a, 0x89,
+    0xa9, 0xbd, 0x80, 0x00, 0x57, 0xbd, 0x59, 0xd5, 0x5f, 0xab, 0xe4, 0x6a, 0xd4, 0x75, 0x9d, 0x6b,
+    0x13, 0xc8, 0x50, 0x65, 0xc8, 0xaa, 0x49, 0x70, 0xc1, 0x48, 0xa9, 0x91, 0x43, 0xd7, 0x75, 0x3d,
+    0x83, 0xaa, 0x44, 0x5e, 0x8c, 0x31, 0xff, 0x37, 0xca, 0x58, 0x69, 0xd4, 0xaf, 0x6f, 0xa8, 0xd9,
+    0x8b, 0xa2, 0x3c, 0xb6, 0x6e, 0xa1, 0x9c, 0xb7, 0x0d, 0xeb, 0x29, 0xef, 0x28, 0xe8, 0x46, 0x2d,
+    0x3e, 0x24, 0x25, 0x38, 0x76, 0x5d, 0x07, 0x3a, 0x6a, 0x02, 0xc5, 0x49, 0x28, 0x71, 0x12, 0x4a,
+    0xbc, 0xb7, 0x48, 0x89, 0xd7, 0x19, 0xe2, 0x3e, 0xe4, 0x7d, 0xd6, 0xd9, 0xb6, 0xce, 0xef, 0x71,
+    0xee, 0x29, 0x56, 0xe6, 0x9d, 0xc6, 0x94, 0x6b, 0x06, 0xc5, 0x8a, 0x42, 0xff, 0x34, 0x64, 0x1e,
+    0x82, 0xa1, 0xfb, 0x77, 0xb9, 0x82, 0xee, 0xcf, 0xbb, 0x2c, 0x0c, 0x5d, 0x12, 0xc3, 0x5b, 0x82,
+    0xca, 0xb3, 0x45, 0x0c, 0xdd, 0xd5, 0x25, 0x83, 0xd0, 0xed, 0x1a, 0x84, 0x2e, 0x78, 0xe2, 0x3a,
+    0x4a, 0x81, 0x74, 0x4e, 0x1b, 0xe5, 0xc4, 0xd9, 0xd7, 0x14, 0x2b, 0xb9, 0xd7, 0x2c, 0x25, 0x09,
+    0xa4, 0x2c, 0xd7, 0x6b, 0x28, 0x07, 0x9a, 0x60, 0xe7, 0x21, 0x8d, 0x75, 0x69, 0xf6, 0xaf, 0xcc,
+    0x63, 0xee, 0x50, 0x01, 0x1c, 0xa7, 0xe3, 0x31, 0x54, 0x19, 0xb3, 0x50, 0xb1, 0x26, 0x26, 0xc2,
+    0xb3, 0x90, 0xaa, 0xe1, 0x2b, 0xee, 0xc8, 0x53, 0x00, 0xe2, 0x9b, 0x79, 0x99, 0x89, 0x6f, 0x69,
+    0x89, 0x07, 0x12, 0x3e, 0xff, 0x9c, 0xa5, 0x8e, 0xf7, 0x3c, 0xce, 0xcf, 0x67, 0x74, 0x39, 0xcc,
+    0xcc, 0x73, 0xba, 0xfe, 0x62, 0x36, 0x26, 0x7a, 0xbb, 0xe2, 0xd3, 0xbe, 0x9d, 0xaf, 0xe4, 0x9f,
+    0x80, 0x50, 0x97, 0x3f, 0x1f, 0x7d, 0x6b, 0x76, 0x20, 0xb6, 0x7a, 0x06, 0x4c, 0x6a, 0xd0, 0x74,
+    0xd8, 0xa8, 0x76, 0x23, 0x1d, 0x39, 0x39, 0x97, 0x29, 0x5e, 0xe1, 0xa9, 0x50, 0x7c, 0x8d, 0x97,
+    0xc5, 0x67, 0x74, 0xb3, 0xa5, 0x9c, 0xae, 0x7a, 0x33, 0x30, 0xbd, 0xcb, 0xce, 0xd6, 0x1a, 0xb7,
+    0x2a, 0x9b, 0x8f, 0x99, 0x82, 0xeb, 0x2d, 0x6c, 0xc6, 0x1b, 0xca, 0x8b, 0x55, 0xae, 0x43, 0x14,
+    0x2b, 0xc5, 0x8f, 0x26, 0x2b, 0x56, 0xba, 0x2d, 0x44, 0xbc, 0xa3, 0x14, 0x13, 0x96, 0x32, 0xee,
+    0x73, 0x07, 0x88, 0x04, 0x09, 0xbd, 0xd9, 0xc2, 0x6c, 0x99, 0xa7, 0x79, 0x60, 0x42, 0x6f, 0x51,
+    0x4c, 0xb9, 0x3e, 0x17, 0x75, 0x4d, 0x45, 0x1c, 0x5f, 0x72, 0x5d, 0xaf, 0x11, 0xdf, 0x8e, 0x63,
+    0x0c, 0xcc, 0x1c, 0xcf, 0xb5, 0xf5, 0x00, 0x4e, 0x3b, 0x6c, 0x7d, 0x8f, 0x63, 0x8e, 0x27, 0x2b,
+    0xfa, 0xd2, 0x3a, 0xb5, 0x8c, 0xd8, 0xfa, 0x12, 0xe9, 0xbc, 0x94, 0x27, 0x49, 0xa8, 0xac, 0x66,
+    0x65, 0x6a, 0x2e, 0x7d, 0x4c, 0x4a, 0xc9, 0xd6, 0xc9, 0xa1, 0xb3, 0x75, 0x1e, 0x1c, 0x3f, 0x90,
+    0xc6, 0xb9, 0x5a, 0xd9, 0x16, 0xa5, 0x00, 0x2c, 0x01, 0x55, 0x09, 0x4e, 0x1a, 0x7e, 0x96, 0x4a,
+    0x99, 0x7c, 0xd7, 0xd0, 0x6e, 0x22, 0xa2, 0x08, 0x49, 0x73, 0x3c, 0x21, 0x28, 0x77, 0xfd, 0x4c,
+    0x65, 0xbc, 0x9e, 0x10, 0x92, 0xf1, 0xc3, 0xac, 0x0f, 0xe5, 0x5c, 0x28, 0xb3, 0x50, 0x4e, 0x80,
+    0xf5, 0xa1, 0x82, 0xf1, 0x97, 0x6b, 0xb0, 0x59, 0xbe, 0xc0, 0xce, 0x0b, 0x31, 0x34, 0x58, 0x15,
+    0x98, 0x1a, 0x0f, 0x2f, 0x1e, 0xc4, 0x1e, 0x10, 0xbb, 0x50, 0xf3, 0x07, 0xab, 0x20, 0x11, 0xbe,
+    0xda, 0x35, 0x4e, 0x4b, 0x2d, 0x7c, 0xb4, 0x86, 0x83, 0xca, 0x7a, 0x38, 0x24, 0x30, 0xe8, 0xbc,
+    0xae, 0xcb, 0x2b, 0x9c, 0xd0, 0x23, 0xac, 0xcf, 0x61, 0x97, 0x69, 0xa3, 0x28, 0xb4, 0x30, 0x61,
+    0x0d, 0x32, 0xf5, 0xd4, 0xef, 0xfc, 0x8c, 0x00, 0xe7, 0x0f, 0xce, 0x54, 0x92, 0x73, 0xe5, 0x44,
+    0x12, 0x98, 0x7b, 0xe7, 0xb7, 0x20, 0xc1, 0x14, 0xb4, 0x96, 0x29, 0x88, 0xb6, 0x29, 0x05, 0x8d,
+    0xfd, 0x05, 0x4a, 0x81, 0xde, 0xff, 0x33, 0xa5, 0x95, 0x39, 0x2b, 0xd7, 0xfb, 0x9f, 0x1c, 0xd9,
+    0x70, 0x38, 0x16, 0x3c, 0x71, 0x79, 0x40, 0xd2, 0x87, 0x1a, 0xf5, 0xe5, 0x25, 0x5d, 0x24, 0x41,
+    0x17, 0xfb, 0x2e, 0x31, 0x9b, 0xd5, 0x78, 0x2d, 0x49, 0x95, 0x8c, 0x54, 0x28, 0x65, 0x68, 0x88,
+    0x00, 0xdd, 0x31, 0x1f, 0xf2, 0xbc, 0xcb, 0xe0, 0x5e, 0xe8, 0x52, 0x6f, 0x16, 0xd8, 0x5d, 0x1a,
+    0xbf, 0x62, 0xb6, 0xbb, 0xd4, 0x9b, 0x66, 0xbb, 0x21, 0x60, 0x1e, 0x2e, 0x3e, 0xd2, 0x42, 0x19,
+    0xcc, 0x22, 0xad, 0xf2, 0x21, 0x15, 0x97, 0xa1, 0x2a, 0xee, 0x46, 0x8c, 0xbf, 0x57, 0xf8, 0x1a,
+    0xcf, 0xff, 0x98, 0x75, 0x11, 0xad, 0xc7, 0x2d, 0x8c, 0xa3, 0xe9, 0x75, 0x67, 0xb6, 0x7b, 0x4f,
+    0x9d, 0x42, 0x72, 0x5d, 0xef, 0xc0, 0xc0, 0x3a, 0xa5, 0x62, 0x99, 0xdb, 0xd8, 0x65, 0x64, 0xe1,
+    0xe1, 0xaa, 0x3f, 0x96, 0xa6, 0x8e, 0x84, 0xc4, 0xe5, 0x72, 0x55, 0x01, 0x07, 0x76, 0x59, 0x58,
+    0x79, 0x6e, 0xbb, 0x6f, 0xbb, 0x9a, 0x53, 0xa8, 0xb6, 0xab, 0xbc, 0x78, 0x4c, 0x0c, 0x6e, 0x97,
+    0x0f, 0x9d, 0xc2, 0xc1, 0x6c, 0xc4, 0x02, 0x0a, 0x33, 0x0f, 0x33, 0x02, 0xac, 0xfb, 0x52, 0x78,
+    0x48, 0xdc, 0xf3, 0x0b, 0x20, 0x91, 0xf2, 0x1c, 0xa7, 0x80, 0xb5, 0x97, 0xa2, 0xb3, 0x3c, 0xb3,
+    0x13, 0xfb, 0x6c, 0x80, 0xe3, 0xf4, 0xba, 0x4b, 0xd1, 0x40, 0x96, 0xc7, 0xa3, 0x56, 0x6f, 0x07,
+    0xdf, 0x00, 0x59, 0x2f, 0x3d, 0xd0, 0xba, 0x2f, 0x07, 0xb7, 0x9c, 0x8f, 0x26, 0x41, 0x7b, 0x07,
+    0xee, 0xec, 0xe5, 0x9a, 0xae, 0xca, 0xeb, 0xe3, 0x9a, 0x06, 0xf2, 0xfa, 0x84, 0x5f, 0xbc, 0x40,
+    0x25, 0x98, 0xd3, 0x19, 0x67, 0xb6, 0xbb, 0xd2, 0xe3, 0x9c, 0x4e, 0x07, 0x27, 0x65, 0x7c, 0x97,
+    0x1a, 0xb7, 0xbb, 0x5a, 0x9d, 0x71, 0xb0, 0xbb, 0xb4, 0x38, 0xa7, 0x73, 0x2c, 0x2d, 0x00, 0xe2,
+    0x86, 0xaa, 0x3f, 0x9c, 0x75, 0x57, 0xbd, 0x99, 0xb7, 0x0a, 0x9a, 0xcb, 0x6e, 0xe3, 0x4d, 0x82,
+    0xe6, 0xf2, 0xaa, 0xad, 0xc2, 0xaa, 0xd0, 0xad, 0x42, 0x40, 0x37, 0x5c, 0xa3, 0x84, 0x1f, 0xf9,
+    0xf0, 0xab, 0x14, 0x45, 0x27, 0x00, 0x8f, 0x7c, 0x34, 0x44, 0x71, 0x58, 0x51, 0xd0, 0x8a, 0xc0,
+    0xfa, 0xd3, 0x89, 0xf4, 0x56, 0x8e, 0x31, 0xfc, 0x3f, 0x51, 0x5a, 0x7e, 0xbe, 0xff, 0xb0, 0x34,
+    0xe7, 0x13, 0xa3, 0xd7, 0xfe, 0xf0, 0xae, 0xd1, 0x9f, 0xb1, 0xa9, 0xd5, 0x18, 0x48, 0xbe, 0xbd,
+    0xc0, 0x18, 0x78, 0xab, 0xcd, 0x18, 0x18, 0xd7, 0xb7, 0xd0, 0x18, 0x58, 0xfb, 0x85, 0xea, 0xae,
+    0x88, 0xef, 0x59, 0x64, 0x0c, 0xac, 0x3a, 0x6f, 0x0c, 0x58, 0xbb, 0x4b, 0x8c, 0x81, 0xdf, 0xb7,
+    0x1b, 0x03, 0x96, 0x6f, 0x8b, 0x8c, 0x81, 0x49, 0x66, 0x49, 0x52, 0x73, 0x44, 0xf2, 0x48, 0x4a,
+    0x92, 0xd9, 0xf9, 0xd9, 0x83, 0x27, 0xb8, 0x67, 0x3f, 0x19, 0xcb, 0xb4, 0xb7, 0xe7, 0xcc, 0x58,
+    0x3c, 0xdb, 0xbb, 0x25, 0xe9, 0xc2, 0x99, 0xb1, 0x07, 0xb6, 0x98, 0xf0, 0xc4, 0x85, 0xa5, 0xa3,
+    0xd9, 0x97, 0x31, 0x38, 0x61, 0x5c, 0xe5, 0xd5, 0xc6, 0xf5, 0xdc, 0xd6, 0x72, 0xbc, 0xe8, 0x2e,
+    0xc3, 0x92, 0x4a, 0x98, 0x66, 0x30, 0x10, 0x33, 0xdb, 0x15, 0x10, 0x07, 0x1b, 0x2c, 0x0c, 0xfc,
+    0xfd, 0x42, 0x35, 0x8b, 0xbd, 0x45, 0x30, 0xd7, 0x93, 0xd8, 0xdc, 0x54, 0xfa, 0xe9, 0x31, 0x12,
+    0xa9, 0x9b, 0x3b, 0x7e, 0x33, 0xda, 0x37, 0x53, 0x81, 0xeb, 0x58, 0xc4, 0x3d, 0x61, 0xd8, 0x16,
+    0x07, 0x53, 0x0e, 0x0b, 0xe4, 0xb6, 0x2b, 0x81, 0x03, 0x0d, 0x16, 0x16, 0x60, 0x7b, 0x51, 0xc2,
+    0xd2, 0x6b, 0x04, 0x3f, 0x7c, 0x3f, 0x10, 0xb4, 0xb0, 0x9b, 0x72, 0xb8, 0x83, 0xe4, 0x1a, 0xee,
+    0x1e, 0x18, 0x72, 0xd7, 0x57, 0x15, 0x20, 0xa1, 0xc4, 0x49, 0xf8, 0xc5, 0xc3, 0xda, 0x3b, 0xc7,
+    0x1b, 0x88, 0xbc, 0xde, 0x7d, 0xaa, 0x51, 0x0e, 0xb7, 0x97, 0xb9, 0x41, 0x6a, 0x78, 0xf4, 0x66,
+    0xa3, 0x9e, 0xa1, 0xad, 0x72, 0x15, 0x18, 0x67, 0x9f, 0xc1, 0x7c, 0x8b, 0x44, 0xd9, 0x2f, 0x61,
+    0x7d, 0x08, 0xbf, 0xf8, 0xec, 0x74, 0x3b, 0x01, 0x9b, 0x4e, 0x9c, 0xbe, 0xb7, 0x11, 0x28, 0xad,
+    0x5e, 0x31, 0x35, 0xa4, 0x7f, 0x3d, 0x00, 0xdb, 0x90, 0x32, 0x45, 0x61, 0x15, 0x30, 0xb1, 0x10,
+    0x9a, 0xd0, 0x20, 0x49, 0x1a, 0xae, 0xf9, 0x7e, 0x9a, 0xa3, 0x55, 0x18, 0x81, 0x8c, 0xf0, 0x92,
+    0xff, 0x67, 0x3e, 0xb2, 0xe1, 0xc4, 0xe5, 0xee, 0xcc, 0xea, 0xb2, 0x31, 0xa1, 0x2d, 0xd5, 0x9c,
+    0x3f, 0x0d, 0xaa, 0xa9, 0x68, 0x50, 0x2d, 0x06, 0x20, 0x27, 0xed, 0x35, 0x03, 0xe4, 0x7a, 0x89,
+    0x8f, 0xb2, 0xb4, 0x40, 0x1d, 0x69, 0x59, 0x40, 0x73, 0xe5, 0xd7, 0xca, 0x5a, 0xd8, 0x64, 0x78,
+    0x2b, 0x7e, 0x97, 0x84, 0x08, 0x8e, 0x53, 0x3f, 0xa9, 0xe2, 0xd4, 0xa5, 0x8a, 0xd3, 0xb7, 0xf2,
+    0x04, 0x32, 0x61, 0x45, 0x2a, 0x0b, 0xcc, 0xdb, 0x78, 0x8f, 0x05, 0xae, 0xed, 0xff, 0x11, 0x0b,
+    0x38, 0xcc, 0x91, 0x81, 0x89, 0x98, 0x74, 0x11, 0x4e, 0x2e, 0xc3, 0x5d, 0x7a, 0x60, 0x5a, 0x07,
+    0xf7, 0xb4, 0xea, 0x74, 0xa3, 0x2c, 0xff, 0x9f, 0xa4, 0x08, 0x51, 0x15, 0x39, 0x5a, 0x61, 0x09,
+    0x2b, 0x02, 0xa4, 0xb3, 0xd9, 0x29, 0x17, 0x95, 0xd9, 0x7d, 0x07, 0xf9, 0xcb, 0x06, 0x8a, 0xdc,
+    0xe7, 0xf6, 0xbf, 0x92, 0x08, 0x24, 0x2f, 0x7d, 0xb3, 0xed, 0x30, 0xc7, 0x37, 0x6f, 0xfb, 0x97,
+    0xd1, 0x44, 0xd4, 0xf5, 0xb7, 0x1c, 0xff, 0xd1, 0x5f, 0x25, 0x32, 0x4f, 0x4a, 0xd8, 0x94, 0x5f,
+    0xde, 0xac, 0xce, 0xe4, 0xf7, 0x5e, 0xe3, 0xc3, 0x65, 0xc9, 0x59, 0x35, 0x0b, 0x80, 0xb0, 0x86,
+    0x02, 0x1e, 0x69, 0xe5, 0xf0, 0x0b, 0xcc, 0x06, 0x62, 0x48, 0xc8, 0x3d, 0xc0, 0xcb, 0x37, 0xad,
+    0xc2, 0x3b, 0x39, 0xa6, 0x43, 0x07, 0xe4, 0x9e, 0x97, 0x6f, 0x5a, 0x01, 0xe1, 0xfd, 0x46, 0x7d,
+    0x3d, 0x92, 0xea, 0xc6, 0x9a, 0xa1, 0x29, 0x0b, 0x61, 0x72, 0xe0, 0x46, 0xd1, 0x1f, 0x9b, 0x63,
+    0x69, 0xd2, 0xce, 0xf7, 0xce, 0x5f, 0xab, 0xf9, 0x0a, 0x13, 0xff, 0xb1, 0x64, 0x4a, 0xcb, 0x1c,
+    0xf8, 0x2c, 0x0c, 0xef, 0x1b, 0xb7, 0x48, 0x9d, 0xcb, 0xdd, 0xb7, 0xec, 0x66, 0x3e, 0x74, 0x72,
+    0x7a, 0x7a, 0xab, 0x00, 0x8d, 0xf2, 0x23, 0xc6, 0xf0, 0x50, 0x65, 0x1b, 0x78, 0x40, 0x0b, 0x38,
+    0xd9, 0x06, 0xd1, 0xa0, 0x8f, 0x02, 0xdc, 0x1c, 0x60, 0xda, 0xe3, 0xc6, 0xcf, 0xef, 0x3e, 0x03,
+    0xfd, 0xa4, 0x01, 0xf1, 0x1b, 0x12, 0x69, 0xed, 0x1b, 0x20, 0x3f, 0x32, 0x61, 0xfe, 0xd7, 0x2f,
+    0x02, 0x35, 0x01, 0xd5, 0xb2, 0xcc, 0xf5, 0x18, 0x46, 0x77, 0x74, 0x01, 0x31, 0xf3, 0x87, 0x3e,
+    0xd5, 0x05, 0xfe, 0xa5, 0x65, 0x8f, 0x63, 0xd4, 0x9a, 0x92, 0x90, 0x7e, 0x61, 0xbd, 0xd2, 0x65,
+    0xc8, 0x9e, 0x04, 0x8a, 0xfb, 0x9f, 0x06, 0x5e, 0x25, 0x4c, 0xbd, 0xb1, 0x02, 0x7a, 0x73, 0x40,
+    0x8d, 0xef, 0xc4, 0xfb, 0x77, 0xa7, 0xa1, 0x90, 0x21, 0x48, 0x89, 0x65, 0x18, 0x5e, 0xf5, 0xf4,
+    0xbf, 0x35, 0x89, 0xa6, 0x74, 0x2e, 0xad, 0xb8, 0x4e, 0x1f, 0x30, 0x98, 0xd1, 0x59, 0xc0, 0x7f,
+    0x01,
+};
+
+const baked_glyph_t BAKED_FONT_GLYPHS_0[BAKED_FONT_GLYPH_COUNT] = {
+    {32, 0, 11, 7, 4, 4, 7, 15},
+    {33, 2, 2, 7, 19, 4, 2, 9},
+    {34, 1, 1, 7, 29, 4, 4, 4},
+    {35, 0, 2, 7, 41, 4, 7, 7},
+    {36, 0, 1, 7, 56, 4, 7, 12},
+    {37, 0, 2, 7, 71, 4, 7, 9},
+    {38, 0, 2, 7, 86, 4, 7, 10},
+    {39, 2, 1, 7, 101, 4, 2, 4},
+    {40, 1, 0, 7, 111, 4, 5, 13},
+    {41, 1, 0, 7, 124, 4, 4, 13},
+    {42, 0, 2, 7, 136, 4, 7, 7},
+    {43, 0, 3, 7, 151, 4, 7, 7},
+    {44, 1, 8, 7, 166, 4, 4, 6},
+    {45, 1, 6, 7, 178, 4, 4, 2},
+    {46, 1, 8, 7, 190, 4, 4, 3},
+    {47, 0, 1, 7, 202, 4, 8, 13},
+    {48, 0, 2, 7, 218, 4, 7, 9},
+    {49, 0, 2, 7, 233, 4, 7, 9},
+    {50, 0, 2, 7, 4, 27, 7, 9},
+    {51, 0, 2, 7, 19, 27, 7, 9},
+    {52, 0, 2, 7, 34, 27, 7, 9},
+    {53, 0, 2, 7, 49, 27, 7, 9},
+    {54, 0, 2, 7, 64, 27, 7, 9},
+    {55, 0, 2, 7, 79, 27, 7, 9},
+    {56, 0, 2, 7, 94, 27, 7, 9},
+    {57, 0, 2, 7, 109, 27, 7, 9},
+    {58, 1, 4, 7, 124, 27, 4, 7},
+    {59, 1, 4, 7, 136, 27, 4, 10},
+    {60, 0, 2, 7, 148, 27, 7, 10},
+    {61, 0, 4, 7, 163, 27, 7, 5},
+    {62, 0, 1, 7, 178, 27, 7, 11},
+    {63, 0, 2, 7, 193, 27, 7, 9},
+    {64, 0, 2, 7, 208, 27, 7, 9},
+    {65, 0, 2, 7, 223, 27, 7, 9},
+    {66, 0, 2, 7, 238, 27, 7, 9},
+    {67, 0, 2, 7, 4, 50, 7, 9},
+    {68, 0, 2, 7, 19, 50, 7, 9},
+    {69, 0, 2, 7, 34, 50, 7, 9},
+    {70, 0, 2, 7, 49, 50, 7, 9},
+    {71, 0, 2, 7, 64, 50, 7, 9},
+    {72, 0, 2, 7, 79, 50, 7, 9},
+    {73, 0, 2, 7, 94, 50, 7, 9},
+    {74, 0, 2, 7, 109, 50, 7, 9},
+    {75, 0, 2, 7, 124, 50, 7, 9},
+    {76, 0, 2, 7, 139, 50, 7, 9},
+    {77, 0, 2, 7, 154, 50, 7, 9},
+    {78, 0, 2, 7, 169, 50, 7, 9},
+    {79, 0, 2, 7, 184, 50, 7, 9},
+    {80, 0, 2, 7, 199, 50, 7, 9},
+    {81, 0, 2, 7, 214, 50, 7, 11},
+    {82, 0, 2, 7, 229, 50, 7, 9},
+    {83, 0, 2, 7, 4, 73, 7, 9},
+    {84, 0, 2, 7, 19, 73, 7, 9},
+    {85, 0, 2, 7, 34, 73, 7, 9},
+    {86, 0, 2, 7, 49, 73, 7, 9},
+    {87, 0, 2, 7, 64, 73, 7, 9},
+    {88, 0, 2, 7, 79, 73, 7, 9},
+    {89, 0, 2, 7, 94, 73, 7, 9},
+    {90, 0, 2, 7, 109, 73, 7, 9},
+    {91, 2, 1, 7, 124, 73, 3, 12},
+    {92, 0, 0, 7, 135, 73, 8, 14},
+    {93, 1, 1, 7, 151, 73, 3, 12},
+    {94, 0, 1, 7, 162, 73, 7, 6},
+    {95, 0, 12, 7, 177, 73, 8, 2},
+    {96, 1, 1, 7, 193, 73, 3, 3},
+    {97, 0, 4, 7, 204, 73, 7, 7},
+    {98, 0, 2, 7, 219, 73, 7, 9},
+    {99, 0, 4, 7, 234, 73, 7, 7},
+    {100, 0, 2, 7, 4, 96, 7, 9},
+    {101, 0, 4, 7, 19, 96, 7, 7},
+    {102, 1, 2, 7, 34, 96, 6, 9},
+    {103, 0, 4, 7, 48, 96, 7, 10},
+    {104, 0, 2, 7, 63, 96, 7, 9},
+    {105, 1, 2, 7, 78, 96, 4, 9},
+    {106, 0, 2, 7, 90, 96, 4, 12},
+    {107, 0, 2, 7, 102, 96, 7, 9},
+    {108, 1, 2, 7, 117, 96, 4, 9},
+    {109, 0, 4, 7, 129, 96, 7, 7},
+    {110, 0, 4, 7, 144, 96, 7, 7},
+    {111, 0, 4, 7, 159, 96, 7, 7},
+    {112, 0, 4, 7, 174, 96, 7, 10},
+    {113, 0, 4, 7, 189, 96, 7, 10},
+    {114, 0, 4, 7, 204, 96, 7, 7},
+    {115, 0, 4, 7, 219, 96, 7, 7},
+    {116, 1, 2, 7, 234, 96, 6, 9},
+    {117, 0, 4, 7, 4, 119, 7, 7},
+    {118, 0, 4, 7, 19, 119, 7, 7},
+    {119, 0, 4, 7, 34, 119, 7, 7},
+    {120, 0, 4, 7, 49, 119, 7, 7},
+    {121, 0, 4, 7, 64, 119, 7, 10},
+    {122, 0, 4, 7, 79, 119, 7, 7},
+    {123, 1, -1, 7, 94, 119, 4, 15},
+    {124, 2, 1, 7, 106, 119, 2, 12},
+    {125, 1, -1, 7, 116, 119, 4, 15},
+    {126, 0, 4, 7, 128, 119, 7, 4},
+};
+
+#define BAKED_FONT_0 {15, 256, 256, 5254, 2273, BAKED_FONT_PIXELS_0, BAKED_FONT_GLYPHS_0}
+
+// 30px, alpha values of the glyph rectangles one after another, compressed with the DEFLATE algorithm.
+const unsigned char BAKED_FONT_PIXELS_1[] = {
+    0xed, 0x5c, 0x0b, 0x70, 0x95, 0xd5, 0x11, 0xde, 0x1b, 0xc8, 0x4d, 0x80, 0x42, 0x63, 0x0a, 0x22,
+    0x44, 0xb0, 0x0f, 0xdb, 0x2a, 0x5a, 0x45, 0x94, 0x38, 0x22, 0x49, 0xae, 0x06, 0x22, 0xa0, 0x46,
+    0x7c, 0x21, 0x3e, 0x50, 0x1a, 0xad, 0x58, 0x95, 0x29, 0xc5, 0x8a, 0x4d, 0xb5, 0xfa, 0x53, 0x2d,
+    0x5a, 0x15, 0xa9, 0x52, 0x1d, 0xb5, 0x1d, 0x9d, 0xd6, 0x37, 0x95, 0x12, 0x43, 0x12, 0x1e, 0x49,
+    0x49, 0x8b, 0x50, 0x95, 0x26, 0x84, 0xd1, 0xaa, 0x20, 0x08, 0xa2, 0x40, 0xb4, 0x8a, 0x31, 0x09,
+    0xc9, 0x4d, 0x20, 0x97, 0xaf, 0x73, 0xde, 0xfb, 0xe7, 0xc5, 0x4d, 0x72, 0x6f, 0x14, 0xa7, 0xff,
+    0x30, 0xff, 0xbf, 0xdf, 0x6c, 0xee, 0xf9, 0xcf, 0x39, 0xbb, 0x67, 0xcf, 0x9e, 0xdd, 0xfd, 0xa1,
+    0xff, 0x5f, 0x87, 0xf9, 0xe5, 0x79, 0x21, 0xc0, 0x3b, 0xe4, 0x3f, 0xf5, 0xc7, 0x27, 0xce, 0x08,
+    0xee, 0xc0, 0x8c, 0xc7, 0x76, 0x9c, 0xe8, 0x01, 0x44, 0x8a, 0xd5, 0xa5, 0x67, 0xc8, 0xf3, 0x88,
+    0x5a, 0xdd, 0x48, 0x72, 0xf4, 0xcd, 0x0f, 0xc0, 0x2e, 0xcf, 0x07, 0x3c, 0xaf, 0x5c, 0xdc, 0xe5,
+    0x2d, 0x14, 0xc7, 0x06, 0xe4, 0x65, 0xc7, 0xef, 0x07, 0x81, 0xf4, 0x59, 0xc0, 0xaa, 0xdc, 0x23,
+    0x05, 0x3d, 0xb2, 0x54, 0xb5, 0x5b, 0x77, 0x2d, 0xd1, 0x80, 0x6d, 0xf6, 0x35, 0x79, 0x74, 0x3f,
+    0xb0, 0x24, 0x1d, 0x58, 0x38, 0xfb, 0x63, 0xd4, 0x0e, 0xa9, 0xc2, 0xee, 0x44, 0xd9, 0xc0, 0x6c,
+    0x20, 0xb7, 0x1e, 0x4f, 0xaa, 0xd6, 0x06, 0x79, 0xde, 0xb8, 0x2a, 0xec, 0xea, 0x6b, 0x9b, 0x7e,
+    0x00, 0x78, 0xee, 0x34, 0x03, 0xbe, 0xb1, 0x5d, 0xb6, 0xd4, 0xbc, 0x71, 0x41, 0x3f, 0x22, 0xfa,
+    0xce, 0x1a, 0xdd, 0xf2, 0xe6, 0x34, 0xd1, 0x83, 0xd3, 0x67, 0x01, 0x95, 0xd5, 0xc0, 0xca, 0x80,
+    0xe9, 0x5b, 0x70, 0x29, 0x30, 0xd6, 0x76, 0xf4, 0x74, 0x60, 0x56, 0x35, 0x8a, 0x14, 0x48, 0x07,
+    0x66, 0xad, 0x40, 0xcb, 0x8f, 0x04, 0x48, 0x5c, 0x02, 0x8c, 0x3d, 0xfb, 0x20, 0x5a, 0x8a, 0x80,
+    0x8a, 0xdd, 0xb2, 0x81, 0xf9, 0x07, 0x79, 0xd3, 0x67, 0xaf, 0xa8, 0x16, 0x2f, 0xbd, 0xaf, 0x7f,
+    0xe7, 0x73, 0x40, 0x44, 0xf9, 0xf9, 0x19, 0x9a, 0x3a, 0x7e, 0xb6, 0xa7, 0xaf, 0x10, 0x5d, 0xd7,
+    0xe2, 0xe6, 0x7a, 0x70, 0x0b, 0x9b, 0xf8, 0x99, 0xa8, 0xcd, 0xfe, 0x2b, 0x30, 0x84, 0xfa, 0x03,
+    0xde, 0x32, 0x2c, 0x17, 0x7d, 0x9c, 0xd2, 0xbf, 0x0c, 0xc8, 0xff, 0x0c, 0x0f, 0xd2, 0x20, 0x60,
+    0x7e, 0x19, 0x50, 0xd6, 0x7f, 0x35, 0x0a, 0x45, 0x87, 0xc3, 0x82, 0xa6, 0x5b, 0xf1, 0x45, 0xe8,
+    0x45, 0xf1, 0xeb, 0xb2, 0xfe, 0x44, 0x27, 0x34, 0xeb, 0xa6, 0xd6, 0x8f, 0x24, 0xa2, 0x53, 0x37,
+    0x6b, 0xb4, 0x37, 0x87, 0x88, 0x86, 0x7c, 0x2e, 0xc8, 0x7f, 0xd4, 0xe3, 0x0d, 0x22, 0xd1, 0x26,
+    0xf0, 0x66, 0xc2, 0x15, 0x88, 0x0c, 0x11, 0x74, 0xd9, 0x7e, 0x3c, 0x41, 0x69, 0xc0, 0x95, 0xb2,
+    0xfd, 0x77, 0x15, 0x98, 0x0e, 0xac, 0xed, 0x4f, 0xf7, 0x61, 0x53, 0xc2, 0x65, 0x68, 0xfe, 0xa6,
+    0x1c, 0xd7, 0x19, 0xc0, 0x9a, 0x3a, 0xac, 0x52, 0x83, 0x4c, 0x78, 0x0b, 0xc0, 0xc1, 0x69, 0x7a,
+    0xc4, 0xa9, 0x2f, 0x7c, 0x5a, 0x75, 0xb9, 0x16, 0xfd, 0x5d, 0xb7, 0x8e, 0xd0, 0xc3, 0x56, 0xb2,
+    0x3f, 0xf0, 0xb2, 0x90, 0x8f, 0x13, 0xfe, 0x75, 0x02, 0x49, 0xe9, 0x53, 0x42, 0x31, 0x36, 0x09,
+    0x24, 0xc5, 0x4f, 0x99, 0xfb, 0xb0, 0x53, 0xa0, 0x5a, 0x2c, 0x96, 0xa0, 0x31, 0x5b, 0xa0, 0xb5,
+    0xd8, 0x90, 0x2c, 0xc0, 0x44, 0xd9, 0xe4, 0x7c, 0x60, 0xdd, 0x3e, 0x84, 0x73, 0xd4, 0x0b, 0x92,
+    0x57, 0x03, 0x08, 0x9f, 0x63, 0x26, 0x3c, 0x17, 0xc0, 0x6b, 0xc9, 0xb2, 0x1b, 0x44, 0x59, 0x8d,
+    0xe2, 0x65, 0x25, 0x49, 0x44, 0xd9, 0xeb, 0x52, 0xe9, 0x59, 0x84, 0xa7, 0x96, 0x00, 0x45, 0x49,
+    0xd9, 0x0d, 0x58, 0x17, 0xd8, 0x89, 0xc7, 0x29, 0xa9, 0x18, 0x78, 0xb5, 0x01, 0x8d, 0x13, 0x48,
+    0xea, 0x41, 0xd2, 0x72, 0xd1, 0x54, 0x0e, 0x51, 0xb1, 0x50, 0x04, 0x3a, 0x57, 0x37, 0x95, 0x15,
+    0x41, 0x4b, 0xd1, 0xe3, 0x61, 0xd1, 0x54, 0x71, 0x12, 0xd1, 0xed, 0x11, 0x41, 0x35, 0x9e, 0xfb,
+    0x0a, 0xf0, 0x14, 0x11, 0x65, 0x95, 0x54, 0xef, 0x7c, 0x36, 0x8b, 0x82, 0xcb, 0xf6, 0x1c, 0xcf,
+    0x2c, 0x47, 0xe2, 0x31, 0x52, 0x11, 0xda, 0xfe, 0x93, 0x0b, 0x4a, 0x5c, 0xa7, 0x06, 0xd5, 0x33,
+    0xbb, 0xa1, 0x30, 0xa8, 0x9e, 0x68, 0x38, 0x55, 0x3f, 0xb3, 0xdb, 0x79, 0x66, 0xe8, 0xa7, 0x58,
+    0x7b, 0xd9, 0x6e, 0x25, 0xc6, 0x86, 0x50, 0x7d, 0x99, 0x07, 0x2c, 0x4f, 0x12, 0x44, 0xb0, 0x50,
+    0x4c, 0x93, 0xa4, 0x5e, 0x51, 0x83, 0x26, 0x0a, 0x16, 0x00, 0x25, 0x72, 0x62, 0x83, 0xcb, 0x80,
+    0x15, 0x92, 0x4a, 0xfc, 0x1b, 0xf6, 0x8d, 0x51, 0xe3, 0x7d, 0x26, 0xd3, 0x0e, 0xc9, 0x8c, 0xe8,
+    0x25, 0x40, 0x12, 0xa2, 0xb5, 0xce, 0x08, 0xd9, 0x66, 0x19, 0x37, 0x2f, 0x3d, 0x78, 0x2e, 0x50,
+    0xcf, 0x09, 0x0d, 0x68, 0x20, 0xa2, 0x89, 0x8d, 0x72, 0xd2, 0xc4, 0xe3, 0x6c, 0xa2, 0x9c, 0x46,
+    0xec, 0x3b, 0x8b, 0xe8, 0x9c, 0x30, 0xf6, 0x09, 0x21, 0x3c, 0xaf, 0x1e, 0x94, 0xf8, 0x4c, 0x96,
+    0xcf, 0xe4, 0xb7, 0xb3, 0x94, 0x47, 0x19, 0x30, 0x2a, 0x95, 0x8e, 0x09, 0xaf, 0x4d, 0x17, 0x20,
+    0xf5, 0x91, 0x03, 0x8b, 0xe9, 0x8f, 0xc0, 0xc1, 0xe7, 0x81, 0xd7, 0xf7, 0x02, 0xe1, 0x23, 0x8f,
+    0xf8, 0x5d, 0xa3, 0xd6, 0xef, 0xd2, 0x13, 0x88, 0xe8, 0xe8, 0x12, 0xa9, 0x28, 0x17, 0x8b, 0x06,
+    0x06, 0xde, 0xdb, 0x24, 0x19, 0x6f, 0xe7, 0x12, 0x5d, 0xba, 0x07, 0x88, 0xc8, 0x7f, 0x58, 0x97,
+    0x76, 0x1d, 0xf0, 0xea, 0x18, 0xe0, 0xde, 0xb9, 0x7b, 0xb1, 0x39, 0x31, 0xa1, 0x60, 0x7a, 0x40,
+    0xbe, 0xe7, 0x88, 0x07, 0xce, 0x3b, 0x94, 0x65, 0xe9, 0x09, 0xe8, 0xcc, 0xf2, 0x7b, 0x9e, 0x07,
+    0x94, 0x7b, 0x56, 0x51, 0xbb, 0xf3, 0x1e, 0x3b, 0x89, 0x7d, 0x2e, 0xf8, 0x75, 0x1a, 0xd1, 0x12,
+    0x60, 0xff, 0xa8, 0xe1, 0x07, 0x00, 0x3c, 0xfa, 0x8d, 0x5a, 0x00, 0xe5, 0x74, 0x7b, 0xb3, 0xb8,
+    0xd3, 0xd0, 0xff, 0x88, 0xfb, 0x98, 0x1a, 0x94, 0xd3, 0x98, 0xbd, 0x38, 0x30, 0x4d, 0xdc, 0x2e,
+    0xa3, 0x45, 0xe2, 0x46, 0x09, 0x4f, 0x5e, 0xa6, 0xc4, 0xea, 0xeb, 0x65, 0x48, 0xdb, 0x50, 0xd1,
+    0xf2, 0xd1, 0xaa, 0xe5, 0x91, 0xb2, 0xe5, 0x3b, 0x65, 0xcb, 0xb3, 0x44, 0xcb, 0x6f, 0x0f, 0x22,
+    0x1a, 0x9a, 0x19, 0xe0, 0x1b, 0xf9, 0xd8, 0x57, 0x43, 0x1c, 0x96, 0xa0, 0xf9, 0x28, 0x87, 0xc6,
+    0x01, 0x8f, 0x32, 0x66, 0x29, 0xc2, 0x69, 0x0e, 0x65, 0x01, 0xbf, 0x67, 0xcc, 0x7f, 0xa2, 0x81,
+    0xfd, 0x72, 0x02, 0xf0, 0x00, 0x63, 0xae, 0x47, 0xfd, 0x10, 0x87, 0x26, 0x03, 0xbf, 0x75, 0x28,
+    0xb0, 0x01, 0x5f, 0xa4, 0x3a, 0x98, 0xeb, 0x9b, 0xaf, 0x40, 0x15, 0xf6, 0x7e, 0xd3, 0xc1, 0x8b,
+    0x81, 0x5f, 0x39, 0x94, 0xf0, 0x16, 0x3e, 0x1d, 0xe8, 0xe0, 0x74, 0xe0, 0x56, 0x87, 0xfa, 0xbc,
+    0x8b, 0xea, 0xfe, 0x0e, 0xce, 0x00, 0xe6, 0x38, 0xd4, 0x77, 0x2b, 0x76, 0x25, 0x3b, 0x98, 0x07,
+    0xdc, 0xe8, 0x50, 0x70, 0x07, 0x3e, 0x08, 0x3a, 0x78, 0x03, 0xf0, 0x13, 0x87, 0x92, 0x3e, 0xc4,
+    0xfb, 0x89, 0x0e, 0xce, 0x06, 0xae, 0x61, 0xe3, 0x5c, 0x8b, 0x2d, 0x7d, 0x19, 0xec, 0x9b, 0x77,
+    0x9e, 0xdf, 0x6d, 0x0a, 0x8c, 0x9d, 0x75, 0x97, 0x97, 0x9f, 0x2b, 0xe7, 0x22, 0x6d, 0xa5, 0x12,
+    0x5c, 0x6d, 0x1e, 0x51, 0xbf, 0xcd, 0x6c, 0xef, 0x5f, 0x20, 0xad, 0x3f, 0x1d, 0x71, 0x7f, 0x18,
+    0xb5, 0x43, 0x36, 0x4a, 0xe3, 0x4f, 0x14, 0x2c, 0x05, 0x72, 0x9b, 0xb1, 0xd0, 0x18, 0x21, 0xe4,
+    0xab, 0x79, 0x92, 0xb4, 0xf6, 0xb5, 0x04, 0x5d, 0xa6, 0x81, 0xa4, 0xfb, 0x2b, 0xa0, 0x68, 0x65,
+    0x75, 0x17, 0x28, 0x5a, 0x81, 0x06, 0x45, 0x93, 0xd6, 0x22, 0x49, 0x0b, 0xb0, 0xc7, 0xd0, 0x62,
+    0xef, 0x2f, 0xc2, 0xc1, 0xab, 0x85, 0xca, 0xc8, 0xbd, 0x7f, 0x7c, 0x0b, 0xb0, 0xde, 0xf3, 0x16,
+    0xaa, 0xbd, 0x7f, 0x5e, 0x0b, 0xdf, 0xfb, 0xc7, 0x17, 0xed, 0xb1, 0x0e, 0x87, 0x58, 0xd8, 0xdc,
+    0x60, 0xdc, 0xec, 0xa4, 0x3a, 0xf0, 0xc6, 0x3d, 0x16, 0x94, 0x2b, 0x15, 0x6e, 0x07, 0xcc, 0x94,
+    0xab, 0x2d, 0x1e, 0x4b, 0x3c, 0x4a, 0xe0, 0x5b, 0xef, 0x1d, 0x9b, 0x85, 0xa8, 0x64, 0x7a, 0xad,
+    0x91, 0xe9, 0xa0, 0xd9, 0x1f, 0xa3, 0xee, 0x48, 0x23, 0x53, 0xe9, 0xcf, 0xe5, 0x7b, 0xe7, 0xab,
+    0x17, 0x0f, 0x06, 0xe6, 0xda, 0x5e, 0x5c, 0x64, 0xb6, 0x32, 0x92, 0x56, 0xb9, 0x71, 0x80, 0xa3,
+    0xed, 0x8e, 0x9e, 0xc3, 0xe9, 0x46, 0x34, 0xea, 0x6d, 0x5f, 0xd8, 0x74, 0x1f, 0x3d, 0xd1, 0xac,
+    0xc9, 0x46, 0xb1, 0x9f, 0xb7, 0xa5, 0xb3, 0x1b, 0x81, 0x32, 0xe3, 0x81, 0x35, 0x74, 0x36, 0xd2,
+    0x74, 0x39, 0xd2, 0xce, 0x3c, 0xd7, 0x6b, 0xb5, 0xef, 0xa2, 0x47, 0x5a, 0xd5, 0xee, 0x48, 0xd3,
+    0x80, 0x9f, 0x73, 0xcd, 0xc8, 0x64, 0x9a, 0xb1, 0x2b, 0xe8, 0xec, 0xf0, 0xa7, 0xa3, 0xc8, 0x81,
+    0x25, 0x01, 0x63, 0x41, 0x17, 0x56, 0x43, 0xad, 0x03, 0xb5, 0x5a, 0x97, 0x02, 0x23, 0x2c, 0x3a,
+    0x1d, 0xb8, 0x46, 0x7a, 0x2c, 0x46, 0x7b, 0xa5, 0xe7, 0xaa, 0xb5, 0x37, 0x5d, 0x7a, 0xae, 0x4a,
+    0x7b, 0x4b, 0x99, 0xe7, 0xba, 0x6d, 0xa4, 0xf5, 0x5c, 0xab, 0xee, 0x1f, 0xe0, 0x5a, 0x9e, 0xe7,
+    0xd4, 0x42, 0x2c, 0x21, 0x4e, 0x83, 0xd3, 0x70, 0x74, 0x83, 0x06, 0x72, 0xfb, 0xd6, 0x3b, 0xae,
+    0xda, 0xd3, 0xd5, 0x36, 0xac, 0xf7, 0x77, 0x05, 0xf4, 0x5e, 0x6f, 0xce, 0x1c, 0x65, 0x41, 0x72,
+    0x40, 0xea, 0x9d, 0x3a, 0x66, 0x74, 0xa6, 0x7c, 0x7e, 0x7f, 0xa5, 0x15, 0x70, 0xe7, 0x14, 0xb7,
+    0xb3, 0xf9, 0xb6, 0x39, 0xe3, 0x77, 0x7b, 0x87, 0x50, 0xf2, 0xce, 0x56, 0x8b, 0xec, 0xa8, 0x52,
+    0x7f, 0xfb, 0x03, 0xa1, 0xfe, 0xec, 0xf7, 0x79, 0xe6, 0xaf, 0x07, 0xc9, 0xe3, 0x0c, 0x37, 0x9e,
+    0xb9, 0x16, 0x0c, 0x02, 0xf2, 0x3b, 0x5e, 0x92, 0x3e, 0x99, 0x16, 0x33, 0x99, 0x8e, 0x95, 0x3e,
+    0xa8, 0xb5, 0x48, 0xca, 0x05, 0x35, 0x16, 0x29, 0xab, 0xa4, 0xda, 0x59, 0x24, 0xb9, 0x4e, 0x3d,
+    0x75, 0x74, 0x34, 0xeb, 0x54, 0x4c, 0x95, 0x5b, 0xa7, 0xca, 0x49, 0x12, 0xda, 0xab, 0x2e, 0xbb,
+    0x4e, 0xc5, 0xd5, 0x8c, 0x8a, 0x68, 0x46, 0xaa, 0x3b, 0xae, 0x46, 0x6a, 0x47, 0x21, 0x46, 0x6a,
+    0xc1, 0x20, 0x6b, 0xbc, 0xc9, 0xd8, 0x5e, 0x06, 0xf6, 0xf0, 0x91, 0x16, 0xf1, 0x91, 0x8e, 0x6f,
+    0xe1, 0x23, 0xed, 0xd0, 0xf6, 0x46, 0x29, 0xd3, 0xae, 0x1a, 0xc6, 0x6c, 0x06, 0x84, 0xe7, 0x9d,
+    0xc1, 0xe8, 0xec, 0x43, 0xd0, 0xc4, 0x69, 0x02, 0x16, 0xc4, 0xca, 0x5e, 0xf7, 0xd0, 0x22, 0xd5,
+    0x8a, 0xb3, 0xb4, 0xb1, 0x48, 0x7f, 0x17, 0x67, 0x69, 0x63, 0x91, 0x6e, 0x12, 0x67, 0x69, 0x6b,
+    0x91, 0xfe, 0x60, 0x1a, 0x13, 0x16, 0x69, 0xf4, 0x01, 0x0d, 0x96, 0x04, 0xe8, 0xfb, 0x1f, 0x23,
+    0x52, 0x6c, 0x2c, 0xd2, 0x9f, 0x10, 0x39, 0xc5, 0x5a, 0xa4, 0xed, 0x46, 0x8c, 0x3e, 0x8b, 0x74,
+    0x1a, 0xb3, 0x48, 0x7d, 0x9f, 0x63, 0x16, 0x69, 0xd7, 0xa1, 0x2c, 0x52, 0x57, 0x3c, 0x07, 0xa5,
+    0x7c, 0xbe, 0x5d, 0xa6, 0xd9, 0x58, 0xcc, 0x28, 0x95, 0x4f, 0x00, 0xa3, 0x7c, 0x12, 0x68, 0xe5,
+    0xd3, 0xbb, 0xf2, 0xbc, 0x16, 0xae, 0x48, 0x52, 0xf9, 0x5a, 0x69, 0x95, 0xd0, 0x5e, 0x7b, 0xe4,
+    0x5b, 0x22, 0x83, 0x0b, 0xd2, 0x43, 0xd5, 0xda, 0x6b, 0xdd, 0x57, 0xa9, 0xbd, 0x1e, 0x0b, 0x55,
+    0x10, 0x89, 0xfb, 0xa4, 0x8d, 0xfb, 0x1e, 0x4b, 0xee, 0xf3, 0x01, 0x80, 0x99, 0xc7, 0x0a, 0xe6,
+    0x33, 0xb4, 0x01, 0x40, 0x0e, 0x1d, 0xfb, 0xf0, 0x9a, 0x2b, 0x7d, 0xfe, 0x6b, 0x07, 0x8e, 0xf4,
+    0x1d, 0xc2, 0xdd, 0xdd, 0x32, 0x94, 0x68, 0x68, 0x56, 0x20, 0x56, 0x6d, 0x76, 0xc1, 0x39, 0x77,
+    0x7e, 0xf0, 0x4b, 0xce, 0x93, 0x9c, 0xd8, 0x88, 0x97, 0x88, 0xed, 0xd7, 0x13, 0xd8, 0xfe, 0x6e,
+    0xf6, 0xe8, 0x49, 0x61, 0x7b, 0x7c, 0xa7, 0xc9, 0x61, 0x84, 0x27, 0x69, 0x7a, 0x4a, 0x13, 0x9a,
+    0x26, 0x6b, 0xfa, 0xdc, 0x26, 0x34, 0x4d, 0xd1, 0xf4, 0x79, 0x4d, 0x68, 0x3a, 0xd7, 0x34, 0x5a,
+    0x0c, 0x54, 0xf4, 0x33, 0xa0, 0xdf, 0x6a, 0xa0, 0xd4, 0xa1, 0x95, 0xc0, 0x2a, 0xeb, 0xf1, 0x26,
+    0xaf, 0x00, 0x56, 0x3a, 0x54, 0x6c, 0x4e, 0xad, 0xd2, 0xc1, 0x2d, 0x52, 0x71, 0x01, 0x8d, 0xec,
+    0x79, 0xd7, 0x9c, 0x79, 0x97, 0x5b, 0x07, 0x37, 0xb8, 0x0c, 0xf7, 0xb0, 0x73, 0xfd, 0xf4, 0x6e,
+    0x98, 0x9e, 0xb6, 0x61, 0xc5, 0x28, 0x1b, 0xe0, 0x5e, 0xf6, 0xf7, 0xb6, 0x4c, 0x70, 0x1e, 0xf7,
+    0x16, 0x37, 0x97, 0xca, 0xcb, 0xc9, 0xe1, 0xf3, 0xef, 0xa2, 0x21, 0xd2, 0x7b, 0x9a, 0x64, 0x91,
+    0x98, 0xf7, 0xc9, 0xee, 0x80, 0xc2, 0x66, 0x58, 0xcd, 0xbd, 0x9d, 0x63, 0x39, 0xfb, 0xd6, 0xab,
+    0xef, 0x57, 0x01, 0x14, 0x1b, 0xba, 0x14, 0x58, 0xad, 0x27, 0x3c, 0x79, 0x15, 0xb0, 0xd2, 0xd0,
+    0x2b, 0xdd, 0xf4, 0x8a, 0x89, 0x2f, 0xd6, 0x74, 0x52, 0x89, 0x9b, 0x5a, 0x31, 0xe9, 0x85, 0x66,
+    0x9a, 0x5f, 0x02, 0x0a, 0xac, 0xd6, 0x9c, 0xb5, 0x6f, 0x19, 0x3b, 0x8b, 0x9c, 0x9c, 0xd8, 0xb5,
+    0xc3, 0x44, 0xec, 0x1c, 0xcf, 0x1c, 0x36, 0x79, 0xdc, 0xc1, 0x9c, 0xc0, 0x1c, 0x4c, 0x6a, 0x70,
+    0x4a, 0x4d, 0x84, 0x86, 0x09, 0xd1, 0x44, 0x92, 0x4f, 0x9c, 0xc1, 0xc6, 0xb7, 0x03, 0x33, 0x1c,
+    0x78, 0x6c, 0xc7, 0x89, 0xdd, 0x38, 0x36, 0x75, 0x68, 0xfc, 0x86, 0xcd, 0xf5, 0x16, 0x1a, 0xe3,
+    0x37, 0x6d, 0x3f, 0x73, 0x6c, 0x36, 0x70, 0x2f, 0x07, 0x58, 0x96, 0x30, 0xc6, 0x81, 0xf9, 0x94,
+    0x60, 0x40, 0x1d, 0xf6, 0xce, 0x5f, 0x06, 0xcc, 0x95, 0xe0, 0x51, 0xf9, 0x93, 0xfd, 0xc3, 0x24,
+    0x18, 0xb6, 0xb8, 0x0e, 0xd8, 0x30, 0x8d, 0x9c, 0xf5, 0x24, 0x22, 0x67, 0x3d, 0xc5, 0xf6, 0x6c,
+    0xad, 0xa7, 0x70, 0xc7, 0x3a, 0xb5, 0x9e, 0xe9, 0x9e, 0xf7, 0x4b, 0x63, 0x8d, 0x02, 0x15, 0x00,
+    0x2e, 0xd6, 0xe0, 0x7c, 0xf1, 0x27, 0x9b, 0x02, 0x86, 0x51, 0xb3, 0x08, 0xb8, 0xc8, 0x9e, 0x98,
+    0x53, 0x6a, 0x14, 0x2b, 0x50, 0x89, 0x9a, 0x14, 0x61, 0x4f, 0x2f, 0x24, 0xa2, 0x0b, 0x64, 0x93,
+    0x29, 0x35, 0xa8, 0x0a, 0x68, 0x86, 0x34, 0xb5, 0x53, 0x35, 0x43, 0xb3, 0x36, 0x2a, 0x86, 0x64,
+    0x5d, 0x00, 0x54, 0xa9, 0x5e, 0x2e, 0x6a, 0xeb, 0x03, 0xb6, 0xeb, 0x10, 0x76, 0x13, 0xe8, 0x4b,
+    0x6d, 0xdd, 0xb6, 0x5d, 0xb1, 0x75, 0xb3, 0xd7, 0x5c, 0xcb, 0xbd, 0xa9, 0xba, 0x23, 0xdb, 0xf7,
+    0xa6, 0xc4, 0xd6, 0x6d, 0x81, 0xd8, 0xba, 0x35, 0x50, 0x5b, 0xb7, 0x6b, 0xec, 0xd3, 0x51, 0xac,
+    0xe9, 0x25, 0x01, 0xe3, 0xb9, 0xaa, 0xad, 0xdb, 0x34, 0x20, 0xb7, 0x6e, 0xdb, 0x9a, 0xd8, 0xba,
+    0x2d, 0x10, 0x1b, 0x9a, 0x01, 0xf2, 0x30, 0x61, 0x1a, 0x90, 0x87, 0x09, 0xd7, 0xf4, 0xb6, 0x91,
+    0xe6, 0x3d, 0x31, 0xdf, 0xba, 0x3d, 0x6f, 0x5c, 0x1c, 0x0f, 0xbe, 0xb1, 0x72, 0x3c, 0xe3, 0xee,
+    0x21, 0xc7, 0x0e, 0xb4, 0x96, 0xe9, 0x58, 0x26, 0xd3, 0x95, 0x4c, 0xa6, 0x9b, 0xd3, 0xac, 0x4c,
+    0xbb, 0xe2, 0x62, 0xc7, 0x40, 0x3e, 0xec, 0x68, 0xd2, 0x0a, 0x94, 0x9b, 0x78, 0x5f, 0x77, 0x9b,
+    0x2e, 0x8f, 0x66, 0x08, 0x5f, 0x8b, 0x91, 0x46, 0x05, 0x7a, 0x79, 0x9d, 0x7a, 0x7c, 0xde, 0x7c,
+    0x20, 0xe4, 0x79, 0x9d, 0x6a, 0x6f, 0x0c, 0xd6, 0x69, 0xc8, 0x97, 0xc5, 0x8d, 0xdf, 0x32, 0xeb,
+    0x58, 0x5d, 0x8c, 0x4c, 0xe3, 0xb7, 0xb6, 0x29, 0x7a, 0xed, 0xfd, 0x52, 0xe2, 0x8b, 0xb1, 0x0e,
+    0x43, 0x76, 0x9e, 0xa6, 0x89, 0x3f, 0x70, 0xef, 0xed, 0x9e, 0xf6, 0xa6, 0x33, 0xed, 0x2d, 0x65,
+    0xda, 0xbb, 0x75, 0xa4, 0xd5, 0xde, 0xaa, 0xfb, 0x06, 0xb0, 0xf1, 0x7d, 0x9b, 0x69, 0xef, 0xb7,
+    0x77, 0xe0, 0xe0, 0x34, 0x0d, 0x04, 0x3d, 0x5b, 0x77, 0x4f, 0xd1, 0x0a, 0x68, 0x5a, 0x02, 0x43,
+    0x0b, 0x60, 0x69, 0x02, 0x9e, 0xb6, 0xb4, 0x34, 0x42, 0x86, 0x96, 0x60, 0xf7, 0x50, 0x0b, 0x76,
+    0x00, 0x6f, 0x1f, 0xe5, 0x46, 0x0e, 0xbc, 0x73, 0x94, 0x9d, 0x13, 0x8b, 0xe4, 0x4b, 0x3d, 0xe0,
+    0xdd, 0x61, 0x76, 0xb6, 0x34, 0x72, 0xab, 0x7e, 0xf3, 0x30, 0x27, 0x68, 0x60, 0xf3, 0x70, 0x3b,
+    0x55, 0x1e, 0x70, 0xd7, 0x97, 0x25, 0xc9, 0x98, 0x82, 0xe8, 0x76, 0x99, 0x3b, 0x4d, 0x02, 0x68,
+    0xaa, 0xf8, 0xb3, 0x4a, 0x85, 0xf2, 0x22, 0xf2, 0xcf, 0x24, 0xca, 0x8b, 0xe8, 0xdf, 0x54, 0xa6,
+    0x4a, 0x5a, 0x80, 0x08, 0x50, 0x39, 0x27, 0x02, 0xc5, 0x79, 0xb8, 0x52, 0x70, 0x23, 0x79, 0x4a,
+    0xdf, 0x52, 0x2b, 0x05, 0x6d, 0x94, 0x2f, 0x15, 0x78, 0xd8, 0x69, 0xa2, 0xb9, 0xb5, 0x05, 0x72,
+    0xc2, 0xe3, 0x6c, 0x91, 0xe6, 0x05, 0xb9, 0xed, 0x2d, 0x0c, 0x72, 0x6b, 0x59, 0x18, 0xe4, 0xa6,
+    0x53, 0x21, 0x93, 0xa7, 0x91, 0xc8, 0x66, 0x70, 0x04, 0x72, 0xb9, 0x9d, 0xc2, 0x20, 0xb1, 0xac,
+    0x4f, 0x61, 0x90, 0xe7, 0x83, 0x0a, 0x6d, 0x0f, 0x78, 0xa6, 0x48, 0x23, 0xdb, 0xb7, 0x60, 0x21,
+    0xef, 0x68, 0x30, 0x16, 0x23, 0xed, 0xad, 0x90, 0x55, 0x8f, 0x41, 0xec, 0xfc, 0xde, 0x58, 0x9c,
+    0x65, 0x6e, 0xe1, 0x67, 0x99, 0x5c, 0x76, 0x96, 0x11, 0xbe, 0xb2, 0xcf, 0x8b, 0xf6, 0xf9, 0xd7,
+    0xbe, 0x28, 0xfc, 0xe1, 0xe0, 0x23, 0xc5, 0x49, 0xa6, 0x29, 0x46, 0xa6, 0xcb, 0x89, 0x26, 0xd6,
+    0x9c, 0x2f, 0xf2, 0xd0, 0xd7, 0x15, 0xa1, 0xe5, 0xb8, 0x94, 0x1a, 0x34, 0xe7, 0x56, 0x00, 0x27,
+    0x8d, 0x6f, 0xc1, 0x81, 0xc2, 0xb5, 0xd2, 0x78, 0x94, 0xf7, 0x71, 0x32, 0xfd, 0x68, 0xb0, 0x91,
+    0x69, 0xa4, 0x05, 0xcd, 0x53, 0x79, 0x5c, 0x68, 0xff, 0x25, 0x0c, 0xb1, 0xf8, 0x06, 0x4d, 0x3a,
+    0x87, 0x0e, 0xbf, 0x63, 0xec, 0x97, 0xb6, 0x9c, 0xeb, 0x4d, 0xac, 0x5d, 0xb8, 0xc7, 0x1b, 0x4d,
+    0xac, 0x5d, 0x17, 0xa6, 0x88, 0x58, 0xbb, 0x8e, 0xa2, 0x6d, 0xe6, 0x75, 0x6b, 0x36, 0x4f, 0xa3,
+    0xea, 0xd6, 0x44, 0x0f, 0x16, 0xba, 0xba, 0x35, 0x3d, 0xd2, 0xb1, 0x3c, 0xfb, 0x37, 0xab, 0xc7,
+    0x99, 0xa2, 0xaf, 0x81, 0xd3, 0x18, 0xb5, 0x6f, 0xd9, 0x5b, 0x07, 0x81, 0x1e, 0x82, 0x0e, 0x65,
+    0x9a, 0xce, 0x64, 0x5a, 0xca, 0x64, 0x2a, 0x9d, 0x46, 0x25, 0x53, 0xbf, 0xd3, 0xd8, 0x9d, 0x91,
+    0x06, 0x00, 0xaf, 0x46, 0x94, 0x06, 0x4a, 0x07, 0x05, 0x98, 0xe3, 0x01, 0x32, 0x1e, 0x2c, 0x43,
+    0x67, 0x29, 0x35, 0xd8, 0x10, 0x50, 0x0c, 0xe5, 0xef, 0x9d, 0xa7, 0x19, 0x32, 0xbc, 0x56, 0x11,
+    0xd0, 0x0c, 0xc9, 0xca, 0xb5, 0xc1, 0xb6, 0x94, 0x1a, 0x54, 0x5e, 0xc8, 0xbd, 0xbd, 0xbd, 0x26,
+    0x0a, 0x27, 0x58, 0x4c, 0x5a, 0x1e, 0x2c, 0x43, 0xb2, 0xb8, 0xa7, 0xef, 0x18, 0x44, 0x29, 0x73,
+    0xa8, 0xf7, 0x65, 0xda, 0xb1, 0x2b, 0xc5, 0x41, 0x1e, 0x50, 0x95, 0xaa, 0x81, 0xf4, 0xdd, 0x2a,
+    0x53, 0x25, 0xa8, 0x8a, 0x20, 0xf2, 0x3e, 0x50, 0xa9, 0x57, 0x56, 0x24, 0x2f, 0xb5, 0xd2, 0x2c,
+    0xb3, 0x48, 0x1e, 0x91, 0x44, 0x9e, 0xa2, 0x15, 0xf2, 0x34, 0x2d, 0x91, 0x17, 0xf5, 0x48, 0x17,
+    0x38, 0xaf, 0xc6, 0xe4, 0x21, 0x85, 0xbf, 0x33, 0x4f, 0x67, 0x28, 0xb5, 0x07, 0x25, 0x91, 0x2d,
+    0xbf, 0x13, 0x68, 0xad, 0xf5, 0xc8, 0xb2, 0x1b, 0x9c, 0x77, 0x46, 0xc1, 0xb5, 0x00, 0x26, 0xf3,
+    0xf4, 0xbf, 0x6b, 0xb3, 0x70, 0x72, 0xdb, 0x36, 0x89, 0xb7, 0x99, 0xa1, 0xd3, 0xfc, 0x2a, 0x9f,
+    0x1a, 0xf5, 0x31, 0x36, 0xb6, 0x32, 0x65, 0x3d, 0xf0, 0xf5, 0xcd, 0xd7, 0x6b, 0xdf, 0x78, 0xfc,
+    0x23, 0xd5, 0xa5, 0x0e, 0x36, 0x4f, 0x10, 0x8c, 0x59, 0x46, 0xb7, 0xab, 0x09, 0xa4, 0xe1, 0x0c,
+    0x0c, 0xdf, 0x02, 0x5c, 0xcf, 0xe8, 0x07, 0x35, 0x9d, 0xc6, 0xe9, 0xf7, 0xda, 0xa7, 0x8f, 0xe6,
+    0xf4, 0xd6, 0xf6, 0xe9, 0x11, 0x8c, 0xa6, 0x6d, 0x8c, 0x26, 0xe0, 0xf9, 0x2e, 0x1f, 0x79, 0x38,
+    0x28, 0xf7, 0xfc, 0x8b, 0x26, 0x76, 0x37, 0x73, 0xe5, 0x8b, 0xab, 0x75, 0xe6, 0xe5, 0xd4, 0x92,
+    0x19, 0xbc, 0x2e, 0x77, 0x17, 0xde, 0xe3, 0x59, 0xb5, 0x9b, 0x81, 0xab, 0x19, 0x4c, 0xda, 0x89,
+    0xad, 0x9c, 0x7d, 0x3d, 0x30, 0x93, 0xff, 0xfa, 0x7d, 0x6c, 0xe3, 0xec, 0x99, 0xac, 0xea, 0x43,
+    0xa5, 0xe5, 0x78, 0xd5, 0x1c, 0x5d, 0x29, 0xbc, 0x22, 0x56, 0xc8, 0xf7, 0x36, 0xb6, 0x73, 0xf6,
+    0xa5, 0xbe, 0x92, 0x3b, 0x4a, 0xd8, 0xe4, 0x2b, 0xc8, 0x13, 0xe9, 0x8b, 0x59, 0xdc, 0x27, 0xfd,
+    0x37, 0x76, 0x72, 0xf6, 0x14, 0xe0, 0x06, 0x3e, 0xce, 0x7f, 0xe1, 0xc3, 0x24, 0xf2, 0x95, 0x26,
+    0xde, 0x48, 0xbe, 0xc2, 0xc5, 0x8f, 0x38, 0x3b, 0x13, 0xb8, 0x89, 0x7c, 0x45, 0x8f, 0xbc, 0x52,
+    0x50, 0x94, 0x79, 0xcf, 0xe6, 0xec, 0x62, 0xec, 0xe6, 0xec, 0xd3, 0x0e, 0xe2, 0x67, 0x9c, 0x5d,
+    0x80, 0xf5, 0x1c, 0x9e, 0x34, 0x37, 0x49, 0xc5, 0xfa, 0xd4, 0x3d, 0x64, 0x6a, 0xdc, 0x7a, 0xe1,
+    0xce, 0xdf, 0x9b, 0x21, 0xd4, 0x21, 0xa3, 0x9d, 0x64, 0x5c, 0xca, 0x9a, 0x4c, 0x06, 0xde, 0x40,
+    0x7d, 0x06, 0x03, 0xb0, 0x50, 0x80, 0xd7, 0x5b, 0x50, 0x3f, 0xde, 0x80, 0xa5, 0x89, 0x57, 0xb5,
+    0xa0, 0xee, 0x4c, 0x03, 0x88, 0x14, 0x2c, 0x50, 0x40, 0xc2, 0xda, 0xa1, 0x3f, 0xdc, 0xbd, 0x54,
+    0x0b, 0xf9, 0xaa, 0x96, 0x39, 0x44, 0xc7, 0x58, 0x89, 0x1f, 0x4f, 0xb4, 0xc0, 0x7f, 0xf1, 0xd5,
+    0x21, 0xbc, 0x41, 0xff, 0x95, 0xbc, 0x4c, 0x64, 0x22, 0x5f, 0x96, 0x99, 0xf2, 0xcc, 0x7a, 0x99,
+    0x7f, 0xcc, 0xa8, 0x97, 0xa9, 0xc7, 0xf1, 0x75, 0x11, 0xa1, 0x95, 0x67, 0x5e, 0xa3, 0x6a, 0x43,
+    0x6c, 0xc6, 0xcd, 0xd4, 0x86, 0x88, 0xc1, 0xb3, 0xda, 0x10, 0x78, 0xf7, 0xdb, 0x7a, 0x1f, 0xc0,
+    0xb3, 0xb5, 0x21, 0x02, 0xd8, 0xa3, 0x8a, 0xcf, 0x80, 0x26, 0x33, 0x20, 0x92, 0xb9, 0xc6, 0x35,
+    0x11, 0x34, 0x3c, 0x55, 0xda, 0x11, 0x7a, 0x0d, 0xa2, 0xc2, 0x51, 0x96, 0x76, 0x94, 0x03, 0xd5,
+    0xc7, 0x89, 0x1f, 0xa8, 0xd2, 0x8e, 0x37, 0x8f, 0x55, 0x02, 0x39, 0x7b, 0x45, 0xf5, 0xd6, 0x07,
+    0x06, 0xb4, 0x32, 0xee, 0x3d, 0x8b, 0xb1, 0xf4, 0x5e, 0xda, 0xa5, 0xbb, 0x59, 0x13, 0xe9, 0xc0,
+    0x7b, 0xf1, 0x8f, 0xb0, 0xc7, 0x24, 0x0d, 0xdb, 0xc3, 0x60, 0xaa, 0x1c, 0xa9, 0x2e, 0x96, 0xb1,
+    0x87, 0x18, 0xc0, 0x63, 0x23, 0x85, 0xb7, 0x80, 0x2b, 0xdf, 0xc6, 0x43, 0x2b, 0x5f, 0x3c, 0xca,
+    0x75, 0x7a, 0x2c, 0x92, 0x0a, 0x35, 0x9d, 0x2a, 0xb5, 0xde, 0xd1, 0x6e, 0x17, 0x1b, 0x91, 0xc8,
+    0xf3, 0x5f, 0xc8, 0xf5, 0xd4, 0x73, 0xe7, 0x45, 0xcf, 0x5f, 0xbb, 0x67, 0xfa, 0x18, 0xf2, 0x3c,
+    0xd9, 0x43, 0x56, 0x2f, 0xef, 0x27, 0xfd, 0xc2, 0x8b, 0x3f, 0x69, 0xf4, 0x42, 0x0c, 0xf6, 0x2b,
+    0xad, 0x17, 0xec, 0x44, 0x6d, 0x5d, 0x00, 0x75, 0xd6, 0xce, 0x16, 0x06, 0x7a, 0xf1, 0x27, 0xfe,
+    0x32, 0xae, 0x77, 0xc5, 0x21, 0xfa, 0x0e, 0x61, 0x9c, 0xeb, 0x5f, 0xff, 0x4d, 0xbf, 0x98, 0x64,
+    0x21, 0xca, 0x0f, 0x8f, 0x64, 0x32, 0x2b, 0x61, 0x31, 0xd5, 0x2b, 0xae, 0x70, 0x85, 0x5d, 0x21,
+    0xfd, 0xe1, 0x88, 0xa7, 0x27, 0xd8, 0x6b, 0x1b, 0x45, 0xe8, 0xd2, 0x33, 0x64, 0xd2, 0x42, 0xad,
+    0x16, 0x9c, 0xaf, 0xa8, 0xa6, 0x57, 0x7b, 0xd4, 0xf1, 0x53, 0x6b, 0x91, 0x54, 0x20, 0xa3, 0x3b,
+    0x46, 0x6d, 0x62, 0xa8, 0x31, 0x9e, 0xae, 0xda, 0xf6, 0x32, 0xc8, 0x85, 0xbc, 0x55, 0x70, 0xdc,
+    0x7d, 0x59, 0xe5, 0xc2, 0xe4, 0xfa, 0xcb, 0xc7, 0x42, 0x17, 0x6a, 0x17, 0xa1, 0xf5, 0xcf, 0x06,
+    0xea, 0xd6, 0x1a, 0x78, 0x10, 0x1e, 0x28, 0x74, 0xbf, 0x41, 0x61, 0xd0, 0xb5, 0x26, 0x0e, 0x53,
+    0xfc, 0x3d, 0xe4, 0x82, 0xf0, 0xf6, 0xa8, 0x34, 0xcf, 0x85, 0xd6, 0x0b, 0xa5, 0xd7, 0xd7, 0x4b,
+    0xf3, 0x1e, 0x9d, 0xc6, 0x74, 0xa5, 0x6e, 0xc3, 0x7c, 0x92, 0x6a, 0x0f, 0x19, 0x76, 0xa9, 0xc9,
+    0x4f, 0x52, 0xcd, 0x52, 0x8b, 0x2e, 0x30, 0xd0, 0x55, 0x20, 0x67, 0x2d, 0x21, 0x7d, 0x8e, 0x8e,
+    0xb6, 0x7a, 0x34, 0x78, 0xb5, 0x8d, 0xb6, 0x7a, 0x3f, 0xfc, 0xc0, 0x45, 0x5b, 0x5f, 0xac, 0x46,
+    0x8d, 0x37, 0x52, 0x47, 0x5b, 0x81, 0x15, 0x29, 0xd6, 0x26, 0xe8, 0x4a, 0x3c, 0xd5, 0xd1, 0xf2,
+    0xe4, 0xb8, 0xd9, 0x84, 0x98, 0x79, 0x3a, 0xbd, 0x52, 0x2b, 0xfe, 0xd5, 0xf7, 0x1d, 0xbb, 0x63,
+    0x10, 0x9a, 0x9b, 0xef, 0x68, 0x95, 0xba, 0x38, 0xac, 0xb6, 0xde, 0xee, 0x8e, 0x39, 0x86, 0xab,
+    0x44, 0xba, 0xd9, 0xe5, 0xc9, 0x71, 0xcb, 0x26, 0x11, 0x0d, 0x9f, 0x69, 0x44, 0x32, 0x7c, 0xe1,
+    0x5b, 0xa6, 0xfa, 0xdd, 0x1b, 0xba, 0x85, 0x89, 0x64, 0x1e, 0xf0, 0x54, 0xe6, 0xb7, 0x4c, 0x4d,
+    0x28, 0xc2, 0x27, 0xf0, 0xef, 0x08, 0xbf, 0x58, 0xfd, 0x48, 0x7e, 0xa6, 0x12, 0xd2, 0x2d, 0x6a,
+    0x46, 0xeb, 0x0a, 0xa6, 0x0b, 0x74, 0xc4, 0xc5, 0x4f, 0xec, 0x90, 0xf8, 0x17, 0x26, 0x04, 0x71,
+    0xdc, 0xe5, 0x1f, 0x63, 0x9f, 0x3d, 0xe9, 0x07, 0x9e, 0x02, 0x8e, 0x56, 0xef, 0xbe, 0xfb, 0xb9,
+    0x37, 0x81, 0x4a, 0xa6, 0xf1, 0xef, 0x18, 0xe5, 0x6b, 0x5e, 0x73, 0xdb, 0x29, 0x81, 0xd6, 0x07,
+    0x81, 0xa8, 0xbd, 0x3d, 0x63, 0x6f, 0xe3, 0xe0, 0x7c, 0x32, 0x7f, 0x9a, 0x79, 0xd3, 0x5a, 0xc3,
+    0x64, 0x4f, 0x95, 0x7e, 0xa9, 0x1f, 0x48, 0xed, 0xf2, 0xe2, 0x14, 0x19, 0x8e, 0xe7, 0x89, 0xb8,
+    0x6d, 0x47, 0x1f, 0x57, 0xb4, 0xa8, 0xbb, 0x2d, 0x47, 0xe3, 0x30, 0x09, 0x16, 0x01, 0xa1, 0x10,
+    0xb0, 0x48, 0x32, 0x1a, 0x45, 0x69, 0xbe, 0x66, 0x09, 0x06, 0x91, 0x62, 0x29, 0x86, 0x66, 0x29,
+    0x86, 0x62, 0x19, 0x86, 0x64, 0x3d, 0xaf, 0x19, 0x92, 0x05, 0xc3, 0x50, 0x9f, 0x26, 0x5a, 0x05,
+    0x08, 0x19, 0x86, 0xda, 0xc5, 0xf5, 0x2d, 0xb6, 0x5b, 0x5d, 0x2d, 0xee, 0x15, 0x33, 0x2b, 0x6f,
+    0x73, 0x0b, 0xb0, 0x94, 0x46, 0x43, 0xdd, 0x46, 0xff, 0x14, 0xdb, 0x93, 0x6e, 0x02, 0xb6, 0x27,
+    0xdf, 0x8c, 0xea, 0xc0, 0x77, 0x81, 0x75, 0xe1, 0x70, 0x29, 0x5e, 0x6b, 0xc2, 0x5f, 0x64, 0xfd,
+    0x3f, 0xee, 0x1e, 0xfc, 0x39, 0xd0, 0x94, 0x41, 0xd4, 0xef, 0xc9, 0x3d, 0x4f, 0x0f, 0xa0, 0x29,
+    0x5b, 0x5e, 0x9f, 0xd4, 0x26, 0x29, 0x10, 0x83, 0xf8, 0x2f, 0x8b, 0x81, 0xfb, 0xa2, 0xe3, 0x3c,
+    0x6e, 0xce, 0x23, 0xea, 0xbe, 0x58, 0xbb, 0x2f, 0x0a, 0xef, 0x8b, 0xcf, 0xf7, 0x56, 0xf6, 0xe2,
+    0xab, 0x70, 0x40, 0x8a, 0x22, 0xd2, 0xdd, 0xa5, 0x8f, 0xac, 0xba, 0x41, 0x47, 0xf7, 0xd9, 0xa7,
+    0x30, 0x9e, 0x59, 0x32, 0x64, 0x7a, 0xfa, 0x26, 0x69, 0xb7, 0x7e, 0x50, 0xab, 0xec, 0x57, 0x81,
+    0xde, 0x2c, 0xff, 0xab, 0xf7, 0x49, 0xf3, 0x59, 0xe6, 0x21, 0xbc, 0xd1, 0x81, 0xfa, 0x79, 0xb3,
+    0xf8, 0x4c, 0x47, 0x26, 0xb8, 0x0f, 0x1c, 0x2b, 0x27, 0xaa, 0xe2, 0x0c, 0x53, 0xa0, 0x2e, 0xca,
+    0xdd, 0xab, 0x81, 0xe2, 0xbe, 0x3a, 0xc5, 0x7b, 0x95, 0x9e, 0xea, 0xae, 0x79, 0xbd, 0x07, 0xb4,
+    0x94, 0x2b, 0xf5, 0x87, 0x59, 0x73, 0x81, 0x83, 0xab, 0x85, 0xed, 0x7f, 0xc1, 0xd8, 0xdf, 0x0b,
+    0x57, 0xed, 0x8a, 0xe6, 0xbf, 0xb1, 0xe9, 0xfc, 0x5f, 0x7e, 0x7e, 0xc6, 0xb8, 0x4b, 0x46, 0xe8,
+    0x6c, 0x5d, 0xd3, 0x3d, 0x89, 0xda, 0xc8, 0x2f, 0xd6, 0x1e, 0x13, 0x4e, 0xd6, 0xce, 0xd2, 0x8d,
+    0xda, 0x4f, 0x8a, 0x76, 0x10, 0x0b, 0xf5, 0x20, 0x54, 0xaa, 0xfc, 0x69, 0x9d, 0x25, 0x1f, 0x70,
+    0x77, 0x58, 0x75, 0x7e, 0x70, 0xa9, 0x7c, 0x4e, 0xf9, 0x1c, 0x11, 0xf1, 0x09, 0xca, 0x56, 0x3d,
+    0x48, 0xe8, 0x41, 0x47, 0x7f, 0x34, 0xbb, 0x5d, 0xab, 0xee, 0xf9, 0x44, 0x53, 0x3f, 0x01, 0x3e,
+    0x18, 0x24, 0xfb, 0xff, 0xb9, 0x48, 0xab, 0xdf, 0xb6, 0xf1, 0x61, 0xfd, 0xb9, 0xe6, 0x80, 0x6b,
+    0xce, 0x30, 0xeb, 0x32, 0xf0, 0x50, 0x0d, 0xb0, 0xe5, 0x0a, 0xa2, 0x3e, 0xc0, 0x1d, 0x39, 0x4a,
+    0x4d, 0x1e, 0x1a, 0x31, 0x1b, 0x18, 0x5d, 0x80, 0x37, 0xbf, 0x33, 0xf1, 0x3d, 0xf5, 0xbf, 0xac,
+    0x50, 0x0b, 0xee, 0x26, 0x4a, 0xfd, 0x73, 0x23, 0xb0, 0x7e, 0x9c, 0xb1, 0x40, 0x29, 0x3f, 0x1e,
+    0x4d, 0x44, 0xff, 0x03,
 };
 
+const baked_glyph_t BAKED_FONT_GLYPHS_1[BAKED_FONT_GLYPH_COUNT] = {
+    {32, 0, 22, 15, 4, 4, 15, 30},
+    {33, 5, 4, 15, 27, 4, 3, 18},
+    {34, 2, 2, 15, 38, 4, 8, 8},
+    {35, 0, 4, 15, 54, 4, 13, 13},
+    {36, 0, 2, 15, 75, 4, 13, 23},
+    {37, 0, 4, 15, 96, 4, 13, 18},
+    {38, 0, 4, 15, 117, 4, 14, 19},
+    {39, 5, 2, 15, 139, 4, 3, 8},
+    {40, 2, 1, 15, 150, 4, 9, 24},
+    {41, 2, 1, 15, 167, 4, 8, 24},
+    {42, 0, 4, 15, 183, 4, 13, 13},
+    {43, 0, 7, 15, 204, 4, 13, 13},
+    {44, 3, 16, 15, 225, 4, 6, 11},
+    {45, 2, 12, 15, 239, 4, 8, 3},
+    {46, 3, 16, 15, 255, 4, 6, 6},
+    {47, 0, 2, 15, 269, 4, 15, 25},
+    {48, 0, 4, 15, 292, 4, 13, 18},
+    {49, 0, 4, 15, 313, 4, 13, 18},
+    {50, 0, 4, 15, 334, 4, 13, 18},
+    {51, 0, 4, 15, 355, 4, 13, 18},
+    {52, 0, 4, 15, 376, 4, 13, 18},
+    {53, 0, 4, 15, 397, 4, 13, 18},
+    {54, 0, 4, 15, 418, 4, 13, 18},
+    {55, 0, 4, 15, 439, 4, 13, 18},
+    {56, 0, 4, 15, 460, 4, 13, 18},
+    {57, 0, 4, 15, 481, 4, 13, 18},
+    {58, 3, 8, 15, 4, 42, 6, 14},
+    {59, 3, 8, 15, 18, 42, 6, 19},
+    {60, 1, 4, 15, 32, 42, 13, 19},
+    {61, 0, 9, 15, 53, 42, 13, 8},
+    {62, 1, 3, 15, 74, 42, 13, 20},
+    {63, 0, 4, 15, 95, 42, 13, 18},
+    {64, 0, 4, 15, 116, 42, 13, 18},
+    {65, 0, 4, 15, 137, 42, 13, 18},
+    {66, 0, 4, 15, 158, 42, 13, 18},
+    {67, 0, 4, 15, 179, 42, 13, 18},
+    {68, 0, 4, 15, 200, 42, 13, 18},
+    {69, 0, 4, 15, 221, 42, 13, 18},
+    {70, 0, 4, 15, 242, 42, 13, 18},
+    {71, 0, 4, 15, 263, 42, 13, 18},
+    {72, 0, 4, 15, 284, 42, 13, 18},
+    {73, 0, 4, 15, 305, 42, 13, 18},
+    {74, 0, 4, 15, 326, 42, 13, 18},
+    {75, 0, 4, 15, 347, 42, 13, 18},
+    {76, 0, 4, 15, 368, 42, 13, 18},
+    {77, 0, 4, 15, 389, 42, 13, 18},
+    {78, 0, 4, 15, 410, 42, 13, 18},
+    {79, 0, 4, 15, 431, 42, 13, 18},
+    {80, 0, 4, 15, 452, 42, 13, 18},
+    {81, 0, 4, 15, 473, 42, 13, 21},
+    {82, 0, 4, 15, 4, 80, 13, 18},
+    {83, 0, 4, 15, 25, 80, 13, 18},
+    {84, 0, 4, 15, 46, 80, 13, 18},
+    {85, 0, 4, 15, 67, 80, 13, 18},
+    {86, 0, 4, 15, 88, 80, 13, 18},
+    {87, 0, 4, 15, 109, 80, 13, 18},
+    {88, 0, 4, 15, 130, 80, 13, 18},
+    {89, 0, 4, 15, 151, 80, 13, 18},
+    {90, 0, 4, 15, 172, 80, 13, 18},
+    {91, 5, 2, 15, 193, 80, 5, 23},
+    {92, 0, 1, 15, 206, 80, 15, 26},
+    {93, 2, 2, 15, 229, 80, 6, 23},
+    {94, 0, 3, 15, 243, 80, 14, 10},
+    {95, 0, 24, 15, 265, 80, 15, 3},
+    {96, 2, 2, 15, 288, 80, 6, 6},
+    {97, 0, 9, 15, 302, 80, 13, 13},
+    {98, 0, 4, 15, 323, 80, 13, 18},
+    {99, 0, 9, 15, 344, 80, 13, 13},
+    {100, 0, 4, 15, 365, 80, 13, 18},
+    {101, 0, 9, 15, 386, 80, 13, 13},
+    {102, 2, 4, 15, 407, 80, 11, 18},
+    {103, 0, 9, 15, 426, 80, 13, 18},
+    {104, 0, 4, 15, 447, 80, 13, 18},
+    {105, 2, 4, 15, 468, 80, 8, 18},
+    {106, 0, 4, 15, 484, 80, 8, 23},
+    {107, 0, 4, 15, 4, 118, 13, 18},
+    {108, 2, 4, 15, 25, 118, 8, 18},
+    {109, 0, 9, 15, 41, 118, 13, 13},
+    {110, 0, 9, 15, 62, 118, 13, 13},
+    {111, 0, 9, 15, 83, 118, 13, 13},
+    {112, 0, 9, 15, 104, 118, 13, 18},
+    {113, 0, 9, 15, 125, 118, 13, 18},
+    {114, 0, 9, 15, 146, 118, 13, 13},
+    {115, 0, 9, 15, 167, 118, 13, 13},
+    {116, 2, 4, 15, 188, 118, 11, 18},
+    {117, 0, 9, 15, 207, 118, 13, 13},
+    {118, 0, 9, 15, 228, 118, 13, 13},
+    {119, 0, 9, 15, 249, 118, 13, 13},
+    {120, 0, 9, 15, 270, 118, 13, 13},
+    {121, 0, 9, 15, 291, 118, 13, 18},
+    {122, 0, 9, 15, 312, 118, 13, 13},
+    {123, 2, -1, 15, 333, 118, 8, 28},
+    {124, 5, 2, 15, 349, 118, 3, 23},
+    {125, 2, -1, 15, 360, 118, 8, 28},
+    {126, 0, 9, 15, 376, 118, 13, 6},
+};
+
+#define BAKED_FONT_1 {30, 512, 256, 18943, 3972, BAKED_FONT_PIXELS_1, BAKED_FONT_GLYPHS_1}
+
+// 60px, alpha values of the glyph rectangles one after another, compressed with the DEFLATE algorithm.
+const unsigned char BAKED_FONT_PIXELS_2[] = {
+    0xed, 0x5d, 0x7b, 0x74, 0x95, 0xc5, 0xb5, 0x9f, 0x73, 0x92, 0x08, 0x52, 0x95, 0x00, 0x21, 0x24,
+    0x27, 0x21, 0x04, 0x10, 0xb0, 0xe1, 0xea, 0x5d, 0x2a, 0x57, 0x7b, 0x97, 0x88, 0x58, 0x8b, 0x06,
+    0xd0, 0xb5, 0x72, 0x83, 0x20, 0xe5, 0x65, 0xaa, 0x05, 0x7c, 0xc5, 0x47, 0x2d, 0xad, 0xda, 0x96,
+    0x66, 0xd5, 0x04, 0xb0, 0x5a, 0xad, 0x20, 0x55, 0xda, 0x50, 0x97, 0xb7, 0x2e, 0xeb, 0x75, 0x55,
+    0xbd, 0x15, 0x13, 0xb4, 0xb0, 0x48, 0x7d, 0x15, 0x51, 0x40, 0x04, 0x84, 0xbc, 0x79, 0x18, 0x92,
+    0x45, 0x2d, 0x04, 0x04, 0x0c, 0xaf, 0x9c, 0xe9, 0xfa, 0xe6, 0xf1, 0x7d, 0xf3, 0xd8, 0x3b, 0x26,
+    0x48, 0x72, 0x0e, 0x64, 0xbe, 0x3f, 0x72, 0xbe, 0x6f, 0xff, 0xb2, 0xcf, 0x99, 0x6f, 0xcf, 0x63,
+    0xcf, 0xec, 0xbd, 0x67, 0x0f, 0x71, 0x97, 0xbb, 0xdc, 0xe5, 0x2e, 0x77, 0xb9, 0xab, 0x1b, 0x5f,
+    0x34, 0x96, 0x17, 0x5a, 0xaa, 0x8c, 0xa5, 0x0d, 0x8b, 0x07, 0x2c, 0xa3, 0x94, 0x2e, 0x6e, 0xa4,
+    0x94, 0x36, 0x94, 0x52, 0x4a, 0x97, 0x66, 0x97, 0x36, 0x2e, 0xcb, 0x08, 0xd8, 0x8c, 0x6f, 0x39,
+    0x5b, 0x1e, 0xd1, 0xbb, 0xae, 0x00, 0x62, 0xdf, 0x18, 0xdc, 0x9b, 0x77, 0xf5, 0x9b, 0x43, 0x68,
+    0xd7, 0x02, 0x49, 0x93, 0x4a, 0xca, 0x9b, 0x18, 0xd0, 0x58, 0x56, 0x9c, 0x9f, 0xe8, 0xd3, 0x47,
+    0xae, 0xd7, 0xa4, 0xb4, 0x6e, 0x04, 0x27, 0x87, 0xe7, 0xb5, 0x18, 0xf2, 0x3b, 0x52, 0x18, 0xf2,
+    0x80, 0x87, 0x00, 0xd1, 0x16, 0x12, 0x42, 0x2e, 0x3e, 0x0a, 0x00, 0x47, 0x86, 0x93, 0xa4, 0x8d,
+    0xec, 0xee, 0xfd, 0x89, 0xe9, 0xec, 0x33, 0xfd, 0xc6, 0xb5, 0xec, 0x73, 0x6d, 0xc2, 0x64, 0xf6,
+    0xf9, 0x58, 0x82, 0x5f, 0xdc, 0xc4, 0xc5, 0xec, 0x26, 0x6f, 0xa1, 0xf7, 0xf7, 0xdd, 0xb0, 0xf2,
+    0x1e, 0x89, 0x8c, 0xa7, 0x78, 0xa5, 0xf7, 0x77, 0x82, 0xf6, 0x82, 0x37, 0x7a, 0x37, 0x65, 0xec,
+    0xbd, 0xd2, 0x34, 0x80, 0xfd, 0x5a, 0x23, 0x00, 0xf0, 0x8b, 0x7d, 0xd5, 0x78, 0x00, 0x60, 0x3f,
+    0x5e, 0x11, 0xb2, 0x81, 0x29, 0xec, 0xf9, 0x97, 0x21, 0x0b, 0x38, 0x67, 0x13, 0x23, 0x54, 0x8c,
+    0x4f, 0x33, 0xc5, 0x7e, 0xe9, 0x71, 0x55, 0x16, 0x8d, 0x65, 0xc5, 0x79, 0x09, 0x02, 0x29, 0x32,
+    0x05, 0xb5, 0x76, 0x38, 0x07, 0x12, 0x8b, 0x8e, 0xc3, 0x62, 0x27, 0xe4, 0xd2, 0x4d, 0x90, 0xd8,
+    0x59, 0x09, 0xa6, 0x2c, 0x5c, 0xd9, 0x64, 0x88, 0xdd, 0x68, 0x0c, 0x81, 0xd8, 0xad, 0x56, 0x22,
+    0xc5, 0x6e, 0x37, 0x1f, 0x21, 0x76, 0xa0, 0x5d, 0x71, 0xb1, 0x03, 0x00, 0x2a, 0x76, 0x0e, 0x00,
+    0x62, 0x9f, 0xc8, 0xbe, 0xca, 0x16, 0x7b, 0xc2, 0xfb, 0xec, 0xc7, 0x2d, 0xb1, 0x87, 0x1f, 0xe3,
+    0xc5, 0x35, 0xc4, 0x9e, 0x36, 0xe1, 0x5d, 0xf9, 0x82, 0x97, 0x1e, 0x87, 0x5b, 0x22, 0x20, 0x76,
+    0x29, 0xc4, 0xf6, 0x8b, 0x5d, 0xf6, 0x0f, 0x4d, 0xec, 0x7a, 0x8f, 0xea, 0xba, 0x7e, 0xfe, 0xa5,
+    0x77, 0xe9, 0xa4, 0x11, 0x3f, 0x5f, 0xd3, 0x02, 0x0d, 0x7d, 0xd7, 0x7d, 0x09, 0x8f, 0x89, 0x93,
+    0x8f, 0xc2, 0x83, 0xe5, 0xc0, 0x16, 0x64, 0x14, 0x7d, 0x0e, 0x19, 0x5e, 0x07, 0x33, 0x09, 0x16,
+    0xa7, 0x2f, 0xf2, 0x3e, 0x5a, 0x93, 0x83, 0x82, 0xcf, 0xf7, 0xfe, 0xbc, 0x17, 0x22, 0xe1, 0x0d,
+    0xde, 0xcd, 0xf7, 0x58, 0x21, 0x19, 0xf0, 0x22, 0xab, 0x59, 0x42, 0x08, 0xab, 0xd1, 0x87, 0x3d,
+    0xfa, 0x1e, 0x06, 0x7c, 0xe8, 0xfd, 0xb9, 0x91, 0x10, 0x92, 0xef, 0xdd, 0xbc, 0xee, 0xd3, 0xf7,
+    0xec, 0x63, 0x4d, 0xd9, 0x9b, 0xb9, 0x78, 0x37, 0x0d, 0x3e, 0x7d, 0x44, 0xb3, 0x06, 0x9c, 0xf0,
+    0xe9, 0xe4, 0x13, 0xef, 0x73, 0x22, 0x21, 0xe4, 0x7f, 0xbc, 0x9b, 0xe3, 0x3e, 0x9d, 0xfc, 0x3f,
+    0x2b, 0x9a, 0xec, 0xf0, 0xd4, 0xa7, 0x93, 0x05, 0xde, 0xdd, 0x1a, 0x42, 0x42, 0xeb, 0x74, 0x3a,
+    0x19, 0x72, 0xd2, 0xbb, 0x2f, 0x4a, 0x2b, 0x36, 0xe8, 0x84, 0xfc, 0xc5, 0x94, 0xc5, 0x17, 0x45,
+    0xa9, 0xbc, 0xed, 0x7c, 0x65, 0x89, 0xe9, 0xab, 0xef, 0x33, 0xe4, 0xa6, 0x13, 0x16, 0x72, 0x6c,
+    0x1c, 0x43, 0x66, 0xda, 0x15, 0xf5, 0xe5, 0x30, 0x86, 0xf4, 0x7e, 0x60, 0x97, 0x89, 0xfc, 0x41,
+    0x54, 0xfa, 0x1e, 0x9f, 0x22, 0x2a, 0xe0, 0x68, 0x9a, 0x41, 0xf7, 0x2b, 0xe0, 0x17, 0x3a, 0x9d,
+    0x16, 0xc9, 0x0a, 0x78, 0x25, 0x90, 0xf3, 0x11, 0xef, 0xef, 0x4d, 0xb2, 0x02, 0xd6, 0x07, 0x72,
+    0x66, 0x8d, 0x22, 0x22, 0xe5, 0xbc, 0x3f, 0x90, 0xb3, 0x5e, 0x33, 0xfb, 0x02, 0x39, 0x7f, 0xa8,
+    0x55, 0xc0, 0x87, 0x81, 0xdc, 0x5e, 0xd4, 0x2a, 0x80, 0x3d, 0x51, 0x26, 0xcf, 0xf9, 0x5a, 0x05,
+    0xcc, 0x0f, 0x1a, 0xff, 0xd0, 0x13, 0x4a, 0x05, 0x9c, 0x18, 0xaa, 0xf4, 0x8a, 0x52, 0x45, 0x24,
+    0xa5, 0x6a, 0x77, 0xc9, 0x3e, 0x16, 0x88, 0x37, 0x5b, 0xeb, 0x47, 0xb3, 0x64, 0x87, 0x3f, 0x3e,
+    0xcb, 0xe8, 0x60, 0xe3, 0x0f, 0xb1, 0xc7, 0x43, 0xe3, 0xad, 0x9e, 0x97, 0x33, 0xbf, 0xa2, 0xb9,
+    0x62, 0x7e, 0x8e, 0xa5, 0x52, 0xbf, 0xf8, 0x5b, 0x71, 0x1f, 0xbd, 0x17, 0xaa, 0x4a, 0xf5, 0xf3,
+    0xef, 0x29, 0x80, 0xa1, 0x56, 0x5b, 0xc7, 0x05, 0x90, 0xa9, 0x58, 0x1b, 0xfa, 0x4a, 0xc4, 0x56,
+    0xad, 0x25, 0xb2, 0x04, 0xbe, 0x72, 0xf5, 0x46, 0xcc, 0x59, 0xde, 0xfd, 0x2a, 0x01, 0x05, 0xea,
+    0xd5, 0x1f, 0x7e, 0xff, 0xa5, 0xea, 0x38, 0xa6, 0x60, 0x09, 0x21, 0x29, 0x9f, 0x7a, 0x4f, 0xf5,
+    0xaa, 0x5e, 0x9c, 0xa0, 0x22, 0xf4, 0xff, 0x04, 0x14, 0x0c, 0xea, 0x12, 0xa9, 0x8a, 0x08, 0x68,
+    0x97, 0x0f, 0x09, 0xa4, 0x3a, 0x43, 0x96, 0xfd, 0x45, 0x59, 0xff, 0x02, 0xa9, 0xf1, 0x11, 0x32,
+    0xd7, 0x7b, 0xde, 0x91, 0x2d, 0x91, 0xda, 0xcc, 0x40, 0x16, 0x39, 0x8c, 0xb2, 0x63, 0x94, 0x40,
+    0x06, 0x2a, 0x12, 0x0c, 0xd5, 0x30, 0x5a, 0x94, 0xfd, 0xad, 0xcb, 0xd2, 0xc4, 0x3e, 0x78, 0xb7,
+    0x2f, 0xa1, 0xfa, 0x2c, 0x63, 0xac, 0xbc, 0xb0, 0x41, 0x20, 0x3b, 0x06, 0x59, 0xe3, 0xe8, 0x58,
+    0x01, 0x5d, 0x63, 0x21, 0x99, 0xd5, 0xf2, 0xfb, 0x02, 0x2e, 0x2e, 0xd2, 0xac, 0x3a, 0xff, 0xb7,
+    0xfc, 0x52, 0x44, 0x36, 0xe5, 0x06, 0x25, 0xa4, 0x6a, 0xd9, 0x23, 0x95, 0xb4, 0x25, 0xd7, 0x7f,
+    0xaf, 0xb1, 0xf5, 0x5c, 0x16, 0x99, 0x1c, 0xa1, 0x1e, 0x26, 0xa5, 0x31, 0xa8, 0x4e, 0x4a, 0x90,
+    0x21, 0x94, 0x7e, 0x9a, 0xe0, 0xcb, 0x30, 0xab, 0x96, 0xcb, 0x7d, 0x54, 0xa5, 0xfc, 0x9f, 0x40,
+    0xf2, 0x03, 0x55, 0xb9, 0x78, 0xb2, 0x54, 0xea, 0xcb, 0x7f, 0x0b, 0x4a, 0xeb, 0xbc, 0xf2, 0x94,
+    0xfb, 0x6a, 0x98, 0x90, 0x8c, 0x2a, 0x4d, 0x62, 0x25, 0xbe, 0x22, 0x26, 0x84, 0xfc, 0x57, 0x54,
+    0x95, 0xcb, 0x24, 0x5f, 0x15, 0xfb, 0xbf, 0x26, 0xb9, 0x92, 0xd6, 0x4b, 0x65, 0x9c, 0x36, 0xb1,
+    0x5e, 0xff, 0x2d, 0x32, 0xd2, 0xd0, 0x24, 0xd1, 0xe0, 0xdd, 0xc9, 0x3c, 0x0d, 0xa9, 0x1e, 0xb5,
+    0x3d, 0x68, 0x3d, 0xe1, 0x87, 0x94, 0x56, 0x5f, 0x97, 0x49, 0xd2, 0xb6, 0xb1, 0xbb, 0x05, 0xbc,
+    0x7f, 0x7d, 0x2c, 0x91, 0x1a, 0xef, 0xf7, 0x07, 0x6c, 0xa5, 0x94, 0x3e, 0x2f, 0x1a, 0x74, 0xe2,
+    0xa4, 0x05, 0xe5, 0x4d, 0xbb, 0x5e, 0x9c, 0x9b, 0xc3, 0x5f, 0x22, 0x75, 0x0b, 0x2d, 0x0d, 0x23,
+    0x0b, 0xe0, 0xfe, 0x3f, 0x0b, 0x9f, 0xde, 0x55, 0x89, 0xf2, 0xdd, 0x91, 0x15, 0x11, 0xf5, 0xa7,
+    0x22, 0x95, 0xb4, 0x32, 0xa2, 0x3d, 0x52, 0x85, 0x20, 0xaa, 0x7a, 0x85, 0xfe, 0x28, 0xf1, 0x2e,
+    0x7b, 0x24, 0xc6, 0x23, 0x31, 0x1e, 0xf9, 0x73, 0x04, 0x9f, 0x99, 0xb8, 0x67, 0x40, 0x3e, 0x55,
+    0x01, 0xa1, 0xd2, 0x18, 0x1d, 0xd3, 0x05, 0xc1, 0x1f, 0xfa, 0xd2, 0xb7, 0x2b, 0xbd, 0x43, 0x25,
+    0xf8, 0x43, 0xa0, 0xe8, 0x07, 0xc1, 0x98, 0x98, 0xf6, 0x99, 0x31, 0x14, 0x0e, 0xb0, 0x08, 0x5b,
+    0x8d, 0x21, 0x2c, 0xd5, 0x22, 0x6c, 0x61, 0x84, 0x37, 0xfc, 0x82, 0xa6, 0x6e, 0xf6, 0x46, 0x9e,
+    0x14, 0xa5, 0xab, 0x6c, 0xd6, 0x1e, 0x09, 0xe9, 0xff, 0x52, 0x4a, 0x87, 0x9b, 0x39, 0x79, 0xc3,
+    0x68, 0x50, 0x66, 0xfb, 0x8b, 0x35, 0x81, 0x18, 0x04, 0xe5, 0x4d, 0x5c, 0xd3, 0x6e, 0xf3, 0xd9,
+    0x90, 0x4f, 0xa4, 0x4a, 0x7b, 0xce, 0xa8, 0xd6, 0xe4, 0x2b, 0xf4, 0x51, 0x65, 0xba, 0x78, 0xe4,
+    0xca, 0x64, 0xbb, 0x78, 0x1c, 0x68, 0x3c, 0x72, 0xa5, 0xb7, 0x8d, 0xab, 0x32, 0xa9, 0x77, 0x3f,
+    0x33, 0x1e, 0x07, 0xf0, 0xc7, 0x41, 0x5c, 0xfb, 0x6c, 0x35, 0x1e, 0x53, 0xb5, 0xf6, 0xb7, 0x45,
+    0x3e, 0xf2, 0xa9, 0xc7, 0xe6, 0xd4, 0xe0, 0x35, 0x52, 0x3e, 0xa5, 0x9b, 0xfb, 0xab, 0x0d, 0x3a,
+    0xe5, 0xa5, 0xfe, 0xa4, 0xab, 0xad, 0x35, 0x13, 0x67, 0x84, 0x0d, 0x20, 0x65, 0xe9, 0x0d, 0x84,
+    0x90, 0x1e, 0xf5, 0x74, 0xfd, 0x58, 0x15, 0x48, 0xba, 0x6f, 0x3f, 0xdd, 0x9e, 0x44, 0xc8, 0x83,
+    0xde, 0xf3, 0x5f, 0x2f, 0xf2, 0x81, 0xf1, 0x6c, 0xd0, 0xf8, 0x11, 0xe9, 0xb7, 0x9f, 0x11, 0x4e,
+    0x2c, 0xed, 0xcf, 0x3e, 0x2f, 0x2a, 0xe3, 0x5a, 0xea, 0x40, 0xea, 0xdd, 0x52, 0x61, 0x1d, 0xe4,
+    0x73, 0x60, 0xf1, 0xb4, 0xff, 0x3a, 0x32, 0x6e, 0x83, 0xad, 0xd5, 0x4e, 0x3e, 0xeb, 0x75, 0xf5,
+    0xd0, 0xd4, 0x5a, 0x83, 0xfe, 0xf7, 0xff, 0x94, 0x2b, 0xe1, 0x7b, 0xf6, 0x2a, 0xe4, 0x5d, 0x53,
+    0x94, 0x77, 0x49, 0x0d, 0x26, 0x43, 0x35, 0x8a, 0x9c, 0x43, 0x53, 0xd5, 0xb5, 0xcc, 0xde, 0x7b,
+    0xce, 0x11, 0xf4, 0xcb, 0xdf, 0x33, 0x7e, 0xa3, 0x76, 0xaa, 0xa7, 0xc6, 0x07, 0x94, 0xb6, 0xda,
+    0xc5, 0xda, 0x30, 0x8e, 0xdc, 0x78, 0x50, 0x2e, 0xab, 0x94, 0xbf, 0x94, 0xd2, 0xbb, 0xb3, 0x8e,
+    0xf0, 0x9b, 0x57, 0x06, 0xb1, 0x8f, 0xcc, 0xe7, 0x39, 0xff, 0xfe, 0x7e, 0x7c, 0x79, 0xf1, 0xc9,
+    0x35, 0xbe, 0xac, 0x2e, 0x79, 0xcb, 0xfb, 0x7c, 0x90, 0x90, 0x73, 0x77, 0xd2, 0xbd, 0x73, 0x12,
+    0x54, 0xb1, 0x8f, 0xdb, 0x48, 0xeb, 0x7b, 0x78, 0xab, 0xa0, 0xdf, 0xf4, 0x36, 0xea, 0x23, 0x3c,
+    0x73, 0x62, 0x3c, 0xd8, 0xf4, 0xce, 0x66, 0x20, 0x4e, 0x5c, 0x26, 0xdd, 0xb2, 0x3e, 0x7a, 0x5f,
+    0xde, 0x5b, 0xdc, 0x7d, 0xfb, 0x83, 0x28, 0x8d, 0xbe, 0xc7, 0xec, 0x0f, 0x57, 0xf1, 0xde, 0x75,
+    0xf8, 0x32, 0x42, 0xce, 0x95, 0x9d, 0x7a, 0x5b, 0x4f, 0x72, 0x9d, 0x2f, 0xb4, 0x6b, 0xc9, 0xfd,
+    0xfe, 0xfd, 0x03, 0x64, 0xba, 0x62, 0x61, 0x18, 0x16, 0x55, 0xac, 0x0d, 0xcf, 0x28, 0xf7, 0xe7,
+    0xbd, 0xa2, 0x58, 0x21, 0xc8, 0x84, 0xa7, 0xaa, 0xfc, 0x7b, 0x61, 0xac, 0xe3, 0xf7, 0x3d, 0x2b,
+    0xfc, 0xfb, 0x9e, 0x2b, 0xfd, 0xff, 0x17, 0xb7, 0xcd, 0x97, 0x07, 0xb7, 0x57, 0x60, 0xb7, 0xc2,
+    0xf4, 0xc7, 0x6e, 0x39, 0x9d, 0xdf, 0xb2, 0x07, 0x79, 0x4b, 0x48, 0xcf, 0x97, 0xaf, 0x38, 0xfd,
+    0xcd, 0x8f, 0x4b, 0x34, 0x59, 0x11, 0xe8, 0xbb, 0x43, 0x03, 0x79, 0x1e, 0x1c, 0x1a, 0x88, 0x73,
+    0xb5, 0x22, 0xcd, 0x7e, 0x81, 0x30, 0xc7, 0x04, 0xb2, 0xcc, 0xf1, 0x45, 0x79, 0x30, 0xd1, 0x97,
+    0xe4, 0xdd, 0x52, 0x90, 0xd1, 0x67, 0xc2, 0x5c, 0x8e, 0x2b, 0x9e, 0xbc, 0x0e, 0x77, 0x46, 0xe6,
+    0xac, 0xbd, 0x1e, 0x07, 0x5f, 0xa1, 0xf4, 0xdd, 0x31, 0x08, 0x76, 0x09, 0x1b, 0x44, 0xa7, 0xc0,
+    0xe0, 0xeb, 0xcc, 0x10, 0x7a, 0x2e, 0x88, 0x5d, 0x1e, 0x55, 0xcd, 0xd5, 0xc6, 0xf5, 0xa6, 0x87,
+    0xed, 0xee, 0x01, 0x62, 0x57, 0xb2, 0xf7, 0x9b, 0x0b, 0x33, 0xbe, 0xcd, 0x56, 0xcc, 0xe7, 0x80,
+    0xd8, 0x68, 0xc6, 0x78, 0x1b, 0xcc, 0xb8, 0x86, 0x69, 0xa3, 0x44, 0x10, 0xbb, 0x96, 0x31, 0xce,
+    0x84, 0x19, 0x99, 0x72, 0xda, 0x96, 0x00, 0x62, 0xd7, 0x33, 0xc6, 0x5b, 0x60, 0x46, 0x66, 0xf7,
+    0xda, 0x0c, 0x2f, 0x43, 0x99, 0x01, 0x9c, 0xe6, 0x83, 0x58, 0x88, 0x69, 0xe3, 0x8d, 0x21, 0x10,
+    0x64, 0x16, 0x35, 0x66, 0x27, 0xb5, 0xaf, 0x30, 0xb3, 0x9c, 0xac, 0x83, 0x4b, 0xc3, 0x6d, 0xea,
+    0x37, 0x80, 0x58, 0x02, 0x5b, 0x3c, 0xbc, 0x0f, 0x33, 0xf2, 0x76, 0xf8, 0x5d, 0x10, 0x4b, 0xac,
+    0x12, 0x76, 0x3b, 0xe8, 0x2a, 0x60, 0x8c, 0xa3, 0x41, 0x2c, 0x89, 0xcd, 0xe0, 0xde, 0x86, 0x19,
+    0x67, 0x33, 0xc6, 0x2b, 0x41, 0xac, 0x07, 0x9b, 0x42, 0xbc, 0x09, 0x33, 0xde, 0xc5, 0xfa, 0xc3,
+    0x65, 0x20, 0xd6, 0x93, 0x99, 0x82, 0x5e, 0x83, 0x19, 0xef, 0x63, 0x76, 0xb9, 0x4b, 0x40, 0xac,
+    0x57, 0x93, 0x6a, 0x10, 0x33, 0xae, 0x1f, 0xb3, 0xa9, 0xd2, 0xb7, 0x41, 0xec, 0xbc, 0x7f, 0x7a,
+    0xe0, 0x9f, 0x60, 0xc6, 0x47, 0xd8, 0x1c, 0x6d, 0x18, 0x88, 0xf5, 0x66, 0x86, 0xd5, 0x3f, 0xc2,
+    0x8c, 0xbf, 0x64, 0x73, 0xb7, 0xc1, 0x20, 0xd6, 0xe7, 0x80, 0x07, 0x2e, 0x83, 0x19, 0x99, 0x05,
+    0xf5, 0xe8, 0x40, 0x10, 0x4b, 0x61, 0xf6, 0xe7, 0x25, 0x30, 0x23, 0x33, 0x14, 0x7f, 0x15, 0x01,
+    0xb1, 0x01, 0x87, 0x3d, 0xf0, 0x49, 0x98, 0xf1, 0x49, 0xa6, 0x3a, 0x06, 0x80, 0x58, 0x84, 0x0d,
+    0x84, 0x8b, 0x60, 0xc6, 0x25, 0xcc, 0x00, 0xde, 0x0f, 0xc4, 0x06, 0x32, 0x0b, 0xd1, 0xa3, 0x30,
+    0x23, 0xf3, 0x53, 0x34, 0xf7, 0x01, 0x31, 0xee, 0xab, 0x98, 0x0f, 0x33, 0x2e, 0x67, 0xa6, 0xd2,
+    0x0b, 0x60, 0xf0, 0xe7, 0x9e, 0x58, 0x1f, 0xc2, 0x06, 0xcf, 0x3e, 0x8f, 0x1e, 0xdc, 0x7b, 0x1e,
+    0x3e, 0xb6, 0xf6, 0xbb, 0xba, 0xcd, 0x20, 0x91, 0x84, 0xbc, 0xe2, 0xb2, 0x46, 0xcb, 0x55, 0x48,
+    0xc8, 0xf0, 0xb5, 0xa0, 0xab, 0x30, 0x54, 0x78, 0x04, 0xf6, 0x59, 0x15, 0x22, 0x5e, 0xae, 0xe1,
+    0x47, 0x60, 0xbf, 0x58, 0xc2, 0x5a, 0xc5, 0x88, 0x4c, 0x48, 0xd6, 0xb4, 0x37, 0x84, 0x27, 0x2d,
+    0x4f, 0x33, 0x21, 0x7b, 0xa3, 0xca, 0x52, 0xee, 0x7b, 0x2b, 0x56, 0x0d, 0xc8, 0xbc, 0x0e, 0x99,
+    0x07, 0xa6, 0xb8, 0x4c, 0x31, 0x1f, 0xab, 0xeb, 0x68, 0xfe, 0x5e, 0x69, 0x16, 0x9d, 0x36, 0x9a,
+    0xcb, 0xc8, 0x4a, 0x78, 0x1e, 0x66, 0xd0, 0x29, 0x46, 0xa7, 0x3a, 0x7d, 0x8f, 0x09, 0x48, 0xfa,
+    0x08, 0x03, 0xf0, 0xe9, 0x46, 0xb8, 0x48, 0x40, 0xd7, 0x01, 0x85, 0xae, 0x01, 0x2a, 0x5d, 0x05,
+    0x34, 0xba, 0x02, 0xe8, 0x74, 0x05, 0xd0, 0xe9, 0xe6, 0x74, 0xc4, 0xa7, 0x13, 0x8c, 0x4e, 0x30,
+    0x3a, 0x51, 0xe4, 0xae, 0xd1, 0xb9, 0x87, 0xb6, 0xcc, 0xa2, 0x0b, 0x0f, 0x2d, 0xab, 0xf3, 0x63,
+    0x39, 0x6a, 0x7b, 0xe5, 0x1e, 0x5a, 0xde, 0x4a, 0x5e, 0x4e, 0x0a, 0x5a, 0x89, 0xf0, 0xd0, 0x8a,
+    0x76, 0xb5, 0x7a, 0x26, 0x37, 0x33, 0x29, 0x1e, 0x5a, 0xac, 0x25, 0xe2, 0x6d, 0x17, 0x6f, 0xed,
+    0x68, 0xff, 0x68, 0xa3, 0x47, 0x05, 0xef, 0x4b, 0x51, 0x85, 0x0c, 0xf4, 0xcf, 0xf7, 0x61, 0x40,
+    0xbc, 0xaf, 0x09, 0xc8, 0xf7, 0xd5, 0x81, 0x22, 0x2c, 0x32, 0xab, 0x2b, 0x00, 0xb7, 0xc8, 0x74,
+    0xab, 0xe8, 0xae, 0x5e, 0x45, 0xc7, 0x46, 0xab, 0x8d, 0x30, 0xb5, 0x9a, 0x0c, 0x80, 0x59, 0x97,
+    0x68, 0x69, 0x35, 0x11, 0x00, 0x93, 0x6f, 0x6b, 0x35, 0x11, 0x00, 0x63, 0x69, 0x35, 0x19, 0x00,
+    0x63, 0x6a, 0x35, 0x7f, 0x14, 0x05, 0x2a, 0x86, 0x85, 0xa9, 0xec, 0xc2, 0x86, 0x9b, 0x17, 0x6d,
+    0x7a, 0xf6, 0x0e, 0x78, 0xed, 0x33, 0x68, 0x07, 0x5f, 0x09, 0x5a, 0x74, 0xe1, 0x54, 0x0c, 0xc1,
+    0xf4, 0x1d, 0xd9, 0x06, 0x3d, 0xab, 0xde, 0x74, 0x6c, 0x6a, 0x16, 0x55, 0x8c, 0x5e, 0x67, 0x3a,
+    0x56, 0x07, 0x62, 0xf4, 0xda, 0x36, 0xe9, 0xb5, 0xe6, 0xf4, 0x33, 0x13, 0xa3, 0xd7, 0x18, 0x2e,
+    0x91, 0xf6, 0xd1, 0xab, 0x4d, 0xba, 0xb0, 0x41, 0x07, 0xce, 0x17, 0x9d, 0x5e, 0x85, 0xd1, 0xcd,
+    0xd9, 0xae, 0x30, 0x6d, 0x63, 0x74, 0xfb, 0xaa, 0xea, 0xaa, 0xae, 0x16, 0x9b, 0x10, 0xbf, 0x11,
+    0x7a, 0x14, 0x82, 0xda, 0xd5, 0x26, 0x63, 0x5d, 0x6d, 0x21, 0xd6, 0xd5, 0x56, 0x62, 0x5d, 0xad,
+    0xa9, 0x03, 0x5d, 0x2d, 0x5d, 0x8d, 0x68, 0xb0, 0xba, 0x5a, 0x29, 0xa6, 0xd9, 0xa7, 0x63, 0x9a,
+    0x3d, 0x82, 0x68, 0xf6, 0x25, 0x48, 0x84, 0xf7, 0x0b, 0x61, 0x18, 0x78, 0x35, 0x11, 0x8e, 0x09,
+    0xdf, 0x7f, 0x3e, 0x16, 0x2c, 0x8e, 0x71, 0x18, 0xbf, 0xa1, 0x89, 0x1d, 0x58, 0xba, 0x09, 0xb1,
+    0x03, 0xeb, 0x36, 0x2e, 0xf6, 0xe9, 0x80, 0xac, 0x6e, 0x44, 0x64, 0x25, 0xa4, 0x8b, 0xd5, 0x47,
+    0xd3, 0x4a, 0x25, 0xb6, 0x40, 0x15, 0x7b, 0xf9, 0x42, 0x35, 0xb2, 0x40, 0x11, 0x7b, 0xc9, 0x14,
+    0x25, 0xae, 0x40, 0x15, 0xfb, 0xa4, 0x20, 0xc4, 0x4f, 0x13, 0xfb, 0xfa, 0x24, 0x38, 0xc4, 0xaf,
+    0x65, 0x24, 0x12, 0xe2, 0x37, 0x0f, 0x0e, 0xf1, 0x3b, 0xfa, 0x50, 0x18, 0x0c, 0xf1, 0xdb, 0x78,
+    0x31, 0x10, 0xe2, 0xd7, 0xb4, 0x72, 0xe1, 0xe4, 0x24, 0x70, 0xf5, 0x5a, 0x09, 0x6b, 0x62, 0x3e,
+    0xb3, 0xc7, 0xe8, 0x14, 0xa3, 0x53, 0x8c, 0x4e, 0x31, 0x3a, 0xc5, 0xe8, 0x14, 0xa3, 0x53, 0x80,
+    0x6e, 0x95, 0xca, 0xf7, 0x91, 0xc2, 0x2b, 0xb4, 0xca, 0x08, 0x01, 0x57, 0x68, 0x9e, 0x4f, 0x15,
+    0x5a, 0xa1, 0x31, 0x5f, 0x2b, 0xb0, 0x42, 0xe3, 0x3e, 0x58, 0x7b, 0x85, 0x26, 0x7c, 0xb3, 0xd6,
+    0x0a, 0x4d, 0xfa, 0x6c, 0x03, 0xc0, 0xf0, 0xe5, 0x1a, 0xd1, 0xd7, 0x46, 0x2c, 0x03, 0xe4, 0xa5,
+    0x6f, 0x6f, 0x20, 0x77, 0x9c, 0xec, 0xdf, 0x88, 0xd5, 0xf4, 0xb2, 0x6d, 0x17, 0x49, 0xa7, 0x00,
+    0xb1, 0xbf, 0x62, 0x3a, 0x8d, 0x87, 0x62, 0xc7, 0x81, 0x32, 0xf2, 0xa9, 0x33, 0x54, 0x7a, 0xa6,
+    0xcf, 0xe1, 0x17, 0x2b, 0xc4, 0x00, 0x2d, 0x76, 0x5c, 0x53, 0x2c, 0x6b, 0x13, 0x30, 0xc5, 0x92,
+    0x87, 0x29, 0x96, 0x62, 0x4c, 0xb1, 0x94, 0x61, 0x8a, 0xa5, 0x31, 0xa6, 0x12, 0x47, 0x67, 0x19,
+    0xe5, 0x88, 0x56, 0x2b, 0x2b, 0x41, 0xb4, 0x5a, 0xf1, 0x24, 0x44, 0xab, 0xe5, 0x05, 0xb1, 0x72,
+    0xa6, 0x59, 0x64, 0x64, 0x0b, 0x56, 0x1f, 0xf3, 0x30, 0xb3, 0x88, 0x16, 0x25, 0xa7, 0x9b, 0x45,
+    0x82, 0x18, 0x39, 0xd3, 0x2c, 0xc2, 0x22, 0xe4, 0x20, 0xb3, 0x48, 0xb0, 0x56, 0xd3, 0xc5, 0x64,
+    0xac, 0xd5, 0x24, 0x60, 0xaf, 0xd5, 0x04, 0x50, 0x88, 0xf4, 0x23, 0x60, 0xad, 0xc6, 0x7f, 0x57,
+    0x5f, 0xab, 0x05, 0x97, 0xb5, 0x56, 0xd3, 0x2c, 0xd8, 0xef, 0x02, 0x0e, 0x15, 0x60, 0xad, 0xc6,
+    0x2f, 0x60, 0xad, 0x16, 0x07, 0x5d, 0xcd, 0x68, 0x8e, 0x41, 0x57, 0xb3, 0xda, 0xa9, 0xec, 0x6a,
+    0x76, 0x03, 0x16, 0x5d, 0x0d, 0x68, 0xd9, 0xbc, 0xab, 0x01, 0x40, 0x3a, 0x64, 0x7b, 0x85, 0x76,
+    0xcb, 0x75, 0x1e, 0x80, 0xae, 0x9d, 0xcb, 0xb0, 0xae, 0x56, 0x8c, 0x75, 0xb5, 0x3c, 0xac, 0xab,
+    0x89, 0x76, 0x05, 0x74, 0xb5, 0x58, 0x5a, 0x20, 0xbb, 0xaf, 0x42, 0xeb, 0x08, 0x10, 0xa1, 0xa7,
+    0x34, 0x7f, 0xae, 0xc4, 0xe8, 0x91, 0x38, 0xa7, 0x13, 0x8c, 0x4e, 0x30, 0x3a, 0xc1, 0x16, 0x75,
+    0xce, 0xfc, 0x19, 0x07, 0x3b, 0x1f, 0x7d, 0xb3, 0xc8, 0x3b, 0x13, 0x60, 0xb3, 0xc8, 0xa2, 0x70,
+    0x67, 0x9a, 0x45, 0xea, 0x11, 0xa0, 0xbe, 0x14, 0x19, 0x5e, 0x4b, 0xa7, 0x23, 0xc3, 0xeb, 0xf4,
+    0x08, 0x32, 0xbc, 0x46, 0xb8, 0x73, 0xd6, 0x1a, 0x5e, 0x97, 0x10, 0x12, 0x7e, 0x01, 0x10, 0x09,
+    0x33, 0x59, 0x24, 0xbe, 0x6a, 0xd1, 0x85, 0x91, 0xe3, 0xfc, 0xfd, 0x06, 0x5d, 0x98, 0x45, 0x30,
+    0x0e, 0xf4, 0x37, 0x96, 0x80, 0xd6, 0xa8, 0x25, 0x62, 0x44, 0xb1, 0xad, 0x51, 0x91, 0xe9, 0x88,
+    0xd8, 0xa7, 0x97, 0x22, 0x62, 0x2f, 0x45, 0xa5, 0x0b, 0xd4, 0x47, 0x1a, 0x66, 0x16, 0x19, 0x8f,
+    0x98, 0x45, 0x42, 0x15, 0xb0, 0x59, 0x24, 0x34, 0x1f, 0x36, 0x8b, 0xe4, 0xae, 0x8e, 0x1b, 0xb3,
+    0x48, 0x9c, 0xb8, 0xb0, 0x83, 0x69, 0x14, 0x66, 0xec, 0xcf, 0x3b, 0x8d, 0xc6, 0xfe, 0x78, 0x9b,
+    0x46, 0x71, 0x00, 0x98, 0x46, 0x71, 0xc0, 0x9e, 0x46, 0x09, 0xc0, 0x9a, 0x46, 0x49, 0xc0, 0x98,
+    0x46, 0x29, 0x03, 0x2d, 0x58, 0x1f, 0xac, 0xa4, 0x85, 0x18, 0x60, 0xd7, 0xb9, 0xff, 0x6e, 0xe6,
+    0x32, 0x03, 0x72, 0x22, 0xb5, 0x39, 0x93, 0x41, 0x57, 0x90, 0x13, 0x91, 0x35, 0xa7, 0x98, 0x40,
+    0x62, 0x86, 0xdf, 0x3c, 0xc4, 0xf0, 0xbb, 0x16, 0x99, 0xc8, 0xc9, 0xb5, 0x33, 0xc5, 0x76, 0x6a,
+    0x63, 0x13, 0x48, 0x42, 0xb1, 0x09, 0x24, 0xbc, 0x7f, 0x5c, 0x09, 0xd1, 0x0c, 0x22, 0x34, 0x83,
+    0x00, 0x4d, 0x25, 0x3e, 0x53, 0x09, 0xcf, 0x0c, 0x02, 0x0a, 0xef, 0x0f, 0x02, 0x0a, 0xa7, 0xf9,
+    0x01, 0x85, 0xad, 0x43, 0xfd, 0x80, 0xc2, 0x27, 0xfc, 0xc8, 0xcc, 0x3f, 0xf5, 0x14, 0x01, 0x85,
+    0x4f, 0xe5, 0x9e, 0x42, 0xda, 0x93, 0xd8, 0x15, 0xf2, 0x9b, 0x47, 0xb0, 0xde, 0xaf, 0x44, 0xb0,
+    0x4e, 0x23, 0x6a, 0x01, 0xd4, 0x12, 0xe8, 0x45, 0x38, 0x65, 0x41, 0xb9, 0xa8, 0x5b, 0xec, 0x32,
+    0xf6, 0x17, 0xf9, 0xce, 0xb9, 0x2a, 0x70, 0x46, 0xcc, 0x36, 0x96, 0xd8, 0x80, 0x70, 0x09, 0xae,
+    0x80, 0x3d, 0x91, 0xd5, 0x11, 0x98, 0x9c, 0x01, 0xfa, 0x3f, 0x4d, 0x7f, 0xa3, 0x70, 0xaf, 0x9a,
+    0x6e, 0xcb, 0xec, 0x7a, 0xd0, 0xfb, 0xc9, 0x9d, 0xba, 0xd6, 0xee, 0xd4, 0xc1, 0x3b, 0xc1, 0xad,
+    0xa9, 0x43, 0x38, 0x79, 0xa7, 0xe1, 0xba, 0x1d, 0xc2, 0xf7, 0x4e, 0xec, 0x32, 0x22, 0xff, 0x86,
+    0xf2, 0xdd, 0xaf, 0xbb, 0x86, 0x18, 0x1b, 0x5f, 0x39, 0x79, 0xf7, 0x50, 0x83, 0xfc, 0x39, 0xdf,
+    0x9d, 0x7c, 0xa1, 0x4e, 0x1e, 0xc6, 0xb7, 0xc9, 0x36, 0x18, 0xe1, 0x88, 0xc3, 0x39, 0x79, 0x8f,
+    0x41, 0x0e, 0x09, 0x1b, 0x93, 0x15, 0x84, 0x8a, 0xfc, 0x3f, 0x21, 0xc3, 0x3e, 0x07, 0xbf, 0xdf,
+    0x2f, 0xa6, 0x59, 0x1e, 0xff, 0x6d, 0xcd, 0xf2, 0xfb, 0x42, 0xdb, 0x3d, 0x04, 0xf6, 0x9c, 0x5b,
+    0xf2, 0xf1, 0xeb, 0xca, 0x94, 0xa7, 0x5f, 0xb7, 0xf6, 0xd6, 0x60, 0xd1, 0x16, 0x2c, 0x67, 0xb8,
+    0x6c, 0x52, 0x96, 0x77, 0x5b, 0xba, 0x8d, 0x2d, 0x37, 0xb6, 0xdc, 0x68, 0x5b, 0x9b, 0x89, 0xac,
+    0x50, 0x6b, 0x32, 0x2c, 0x75, 0xb6, 0x0d, 0xf6, 0x58, 0xcb, 0x2d, 0x7f, 0x55, 0xc9, 0x56, 0x0c,
+    0x26, 0xdb, 0xd8, 0xf7, 0x98, 0xdd, 0x31, 0xbc, 0x0d, 0x7e, 0x0b, 0xc0, 0x2d, 0xb0, 0x9b, 0x7f,
+    0x05, 0x77, 0xbc, 0x5e, 0xf1, 0x9b, 0xb7, 0xaa, 0x5b, 0x64, 0xec, 0x4a, 0x86, 0xcb, 0xf5, 0x44,
+    0x15, 0x38, 0x1e, 0x3e, 0x01, 0x35, 0x13, 0x46, 0x06, 0x22, 0x21, 0x48, 0x72, 0x15, 0x1c, 0x3a,
+    0xd1, 0x46, 0xe3, 0xe5, 0xcd, 0xbd, 0xd6, 0x6a, 0xee, 0x99, 0x48, 0x94, 0x07, 0xde, 0x73, 0x64,
+    0x5f, 0xcb, 0x26, 0xed, 0x0c, 0x54, 0x91, 0x11, 0x2f, 0x3b, 0xad, 0xfe, 0x9c, 0xbd, 0x13, 0x1c,
+    0xf1, 0x08, 0x19, 0xbc, 0x0b, 0x01, 0x86, 0xec, 0x46, 0x06, 0x93, 0xa1, 0xd8, 0xf0, 0x23, 0xc7,
+    0x49, 0x7b, 0x24, 0x6b, 0x40, 0x46, 0xb2, 0x61, 0x3c, 0xea, 0xb4, 0x61, 0x38, 0xe8, 0xf9, 0xa0,
+    0xf4, 0xe3, 0x50, 0xbb, 0xfe, 0x5f, 0x7c, 0xbf, 0xf9, 0xc3, 0xa2, 0x3c, 0xe6, 0x1b, 0x20, 0x83,
+    0xbf, 0x18, 0x3c, 0x4d, 0xd1, 0x09, 0xf9, 0x98, 0xa2, 0x16, 0xf2, 0x34, 0xeb, 0x4c, 0xc8, 0xdf,
+    0xac, 0xe3, 0x2c, 0x58, 0xf3, 0x21, 0x7a, 0x12, 0xd1, 0xaa, 0x62, 0x1c, 0x35, 0x75, 0xb6, 0x68,
+    0x88, 0xdb, 0x0d, 0x87, 0x40, 0xa4, 0x5a, 0xdb, 0x0b, 0x6a, 0xec, 0x2b, 0xfe, 0x2c, 0x0d, 0x1c,
+    0x41, 0xb7, 0x02, 0x61, 0xe7, 0x03, 0xb6, 0x2a, 0xbb, 0x40, 0xf5, 0x6d, 0xcd, 0xfd, 0xe3, 0x2a,
+    0x3c, 0xfb, 0x2c, 0x08, 0x64, 0x1b, 0x84, 0x05, 0xb2, 0xd5, 0xc3, 0x81, 0x6c, 0x59, 0x48, 0x20,
+    0xdb, 0x40, 0x24, 0x30, 0x0d, 0x1b, 0x69, 0x30, 0x15, 0x9d, 0x81, 0xd1, 0x91, 0xc1, 0x4f, 0x04,
+    0x76, 0xd5, 0x58, 0x83, 0x22, 0x36, 0x8a, 0x12, 0x44, 0x6d, 0x73, 0xa0, 0x2a, 0x03, 0x56, 0x37,
+    0xf0, 0xc0, 0x1e, 0xd3, 0x8b, 0x25, 0x88, 0x84, 0x00, 0x96, 0x34, 0x92, 0x20, 0x5e, 0xb6, 0x06,
+    0x08, 0x60, 0xc9, 0x25, 0x21, 0x80, 0x25, 0x9c, 0x8c, 0xcf, 0x9d, 0x10, 0xb1, 0x33, 0x23, 0x5d,
+    0xf5, 0x26, 0x6c, 0xed, 0xf8, 0xc9, 0x49, 0x78, 0x96, 0x74, 0x75, 0x2b, 0x32, 0x7d, 0x2a, 0xc3,
+    0xe6, 0x55, 0x4d, 0x6d, 0x66, 0x48, 0x9c, 0x95, 0x20, 0xb2, 0x09, 0x99, 0x80, 0x27, 0x81, 0x84,
+    0xb6, 0x73, 0x2a, 0xb6, 0x97, 0x03, 0xfa, 0x0d, 0xfd, 0xad, 0x15, 0x91, 0xac, 0xd0, 0x00, 0xc5,
+    0xa5, 0xf9, 0x1d, 0x55, 0x22, 0xad, 0x63, 0x60, 0x59, 0xb5, 0xfe, 0x94, 0x40, 0xd2, 0x6d, 0x2a,
+    0xbb, 0xba, 0x0d, 0xbf, 0x30, 0x64, 0x40, 0x0b, 0x7c, 0xcf, 0x15, 0xc0, 0x9e, 0x3c, 0xc8, 0x80,
+    0xa6, 0xfa, 0xb7, 0x35, 0x03, 0x1a, 0xea, 0x11, 0xef, 0x72, 0x03, 0x5a, 0x02, 0x5f, 0x66, 0xec,
+    0xb4, 0x76, 0x52, 0x4e, 0x13, 0xff, 0x38, 0xdb, 0x7c, 0x9d, 0xed, 0x32, 0x95, 0x52, 0x12, 0xcc,
+    0x60, 0xb2, 0xf8, 0x0c, 0x26, 0x0b, 0x37, 0x57, 0x70, 0x2b, 0xc1, 0x0f, 0x55, 0x06, 0xb6, 0x24,
+    0xaa, 0x20, 0xcc, 0x02, 0x51, 0xaf, 0xb0, 0xcc, 0x60, 0xff, 0x3a, 0x56, 0x64, 0x6c, 0xba, 0xdd,
+    0x62, 0x20, 0x26, 0x8b, 0x64, 0x20, 0x06, 0x4b, 0x42, 0x95, 0x64, 0x10, 0x2c, 0x75, 0x82, 0x65,
+    0xa6, 0xcf, 0x20, 0x59, 0x6e, 0x53, 0xf6, 0x37, 0x56, 0x08, 0x76, 0x85, 0x65, 0x96, 0xc2, 0x20,
+    0x59, 0x7e, 0xe0, 0x31, 0x54, 0xab, 0x0c, 0x82, 0xa5, 0x36, 0x91, 0x90, 0x5b, 0x35, 0x86, 0x80,
+    0x25, 0xb1, 0x46, 0x67, 0xf0, 0x59, 0x4c, 0x06, 0xc9, 0x52, 0x60, 0x31, 0x08, 0x96, 0x1a, 0x8b,
+    0x21, 0xc8, 0x71, 0x15, 0x67, 0x11, 0x55, 0xdd, 0x08, 0xd0, 0x4c, 0xb9, 0xc2, 0x0f, 0x09, 0x80,
+    0xeb, 0x46, 0x9c, 0xd6, 0x18, 0x93, 0x11, 0x58, 0x8c, 0xc9, 0xba, 0x44, 0x2c, 0xc6, 0x24, 0xbf,
+    0x73, 0x63, 0x4c, 0xb8, 0xa7, 0x0c, 0x00, 0xb8, 0x1f, 0xd2, 0x06, 0x84, 0x1f, 0xd2, 0x02, 0xa4,
+    0x1f, 0xd2, 0x00, 0x02, 0x3f, 0x24, 0x2c, 0x92, 0x17, 0xc2, 0x30, 0xe0, 0x79, 0x15, 0x21, 0x3a,
+    0xf3, 0x43, 0x76, 0x88, 0x23, 0xf8, 0x0d, 0x28, 0x3c, 0x1b, 0x13, 0x7b, 0x04, 0x13, 0xfb, 0x74,
+    0x4c, 0xec, 0xa5, 0x1d, 0x91, 0x6e, 0xba, 0x1f, 0xe0, 0x06, 0x89, 0xbd, 0x1c, 0x13, 0x7b, 0x09,
+    0x26, 0xf6, 0x49, 0x88, 0xd8, 0xd7, 0x27, 0xc1, 0x22, 0x69, 0x19, 0x89, 0xc8, 0x6a, 0x1e, 0x2c,
+    0x44, 0xe6, 0x87, 0x04, 0xe8, 0xdc, 0x0f, 0x69, 0x10, 0x9d, 0x1f, 0x12, 0xf6, 0x43, 0xba, 0x70,
+    0x90, 0x4e, 0x07, 0x5c, 0x20, 0x9b, 0x8b, 0x9c, 0xec, 0x66, 0x33, 0x99, 0x38, 0x02, 0xd0, 0xfa,
+    0x98, 0x88, 0xd4, 0xa0, 0xe8, 0x6a, 0x98, 0x56, 0xcb, 0x43, 0xb4, 0xda, 0xda, 0x84, 0xb6, 0x5b,
+    0x62, 0x7b, 0xdb, 0x2e, 0xd6, 0xda, 0xc1, 0xfe, 0x11, 0x27, 0x31, 0xa3, 0xdd, 0x7c, 0xd0, 0x47,
+    0xad, 0x24, 0x5d, 0x01, 0x38, 0xb1, 0x77, 0xbf, 0xcb, 0xd5, 0xb9, 0xeb, 0x6a, 0xdd, 0x02, 0x70,
+    0x6b, 0xb5, 0x38, 0xcc, 0x11, 0xd2, 0xb5, 0x80, 0xdb, 0x74, 0xd4, 0x85, 0x6b, 0x35, 0xb7, 0x68,
+    0x88, 0xb1, 0xe1, 0xd7, 0xd9, 0xdb, 0x5d, 0x9d, 0xbb, 0xcc, 0xc5, 0x0e, 0x70, 0x19, 0xc6, 0xdc,
+    0x4a, 0xc9, 0x01, 0xdf, 0x60, 0x8d, 0x18, 0x6f, 0x13, 0xc8, 0x26, 0x6c, 0x02, 0x59, 0x8e, 0x4d,
+    0x20, 0x4b, 0xb0, 0x09, 0xe4, 0x24, 0x64, 0x02, 0xb9, 0x3e, 0x09, 0x9e, 0x40, 0xb2, 0xfd, 0x7d,
+    0x85, 0xd8, 0xfe, 0x3e, 0x7b, 0x02, 0xe9, 0xef, 0xef, 0x33, 0x26, 0x90, 0x1f, 0x8f, 0x04, 0x26,
+    0x90, 0x4d, 0xe5, 0x0b, 0x26, 0x25, 0x62, 0x95, 0x52, 0x84, 0xc8, 0x8a, 0xd3, 0x4f, 0x22, 0x79,
+    0x29, 0x4f, 0xce, 0x30, 0x01, 0x49, 0x37, 0x7f, 0xc3, 0xa7, 0x1b, 0x40, 0x40, 0xd7, 0x01, 0x85,
+    0xae, 0x01, 0x2a, 0x5d, 0x05, 0x34, 0xba, 0x02, 0xe8, 0xf4, 0x00, 0x30, 0xe8, 0x3e, 0x60, 0xd2,
+    0x25, 0x60, 0xd1, 0x05, 0x60, 0xd3, 0x89, 0x12, 0x07, 0xa3, 0xd1, 0x95, 0xe6, 0xa8, 0xd3, 0x09,
+    0x46, 0x0f, 0x80, 0x65, 0x58, 0xcb, 0x3e, 0x39, 0x13, 0x6b, 0xf2, 0x27, 0x67, 0xd9, 0x40, 0x11,
+    0x80, 0xa8, 0xef, 0xd1, 0x7a, 0xab, 0xdd, 0x75, 0x05, 0x52, 0x60, 0xf7, 0x69, 0x0b, 0x31, 0xa4,
+    0xdb, 0xfa, 0x03, 0x7b, 0x14, 0x10, 0xc8, 0x6d, 0xf6, 0xf0, 0x20, 0x90, 0xdb, 0xed, 0x71, 0x43,
+    0x43, 0x80, 0x56, 0xd2, 0xfa, 0x43, 0xbb, 0x51, 0x0b, 0x64, 0xb6, 0xdd, 0xda, 0x03, 0x04, 0x6e,
+    0xbb, 0xd1, 0x39, 0x04, 0x69, 0xed, 0xd1, 0xb9, 0x58, 0xff, 0x88, 0x76, 0xa0, 0x47, 0xb9, 0x91,
+    0xdf, 0x01, 0xce, 0xd8, 0xdf, 0x39, 0x57, 0x8b, 0xb9, 0x61, 0x33, 0xb7, 0x05, 0x46, 0x72, 0x5b,
+    0x60, 0x9e, 0xdc, 0x16, 0xf8, 0xdb, 0x72, 0x5b, 0xe0, 0xdf, 0xc9, 0x6d, 0x81, 0x4b, 0x90, 0xdb,
+    0x02, 0x97, 0x2d, 0xb7, 0x05, 0x2e, 0xb5, 0xfd, 0x3d, 0xfc, 0x6f, 0x51, 0x8b, 0xf2, 0xc4, 0x2e,
+    0xa3, 0x84, 0xca, 0x20, 0xa3, 0xbf, 0x93, 0x3a, 0xfa, 0x68, 0x52, 0xd0, 0x86, 0x25, 0x81, 0xb0,
+    0xb2, 0xe9, 0xe3, 0x15, 0xff, 0xe6, 0x5c, 0xf2, 0xb5, 0xa7, 0xee, 0xc7, 0x09, 0xe0, 0x4c, 0x16,
+    0x5d, 0x0b, 0x58, 0x3b, 0x73, 0x29, 0x86, 0x50, 0x0c, 0xa1, 0x18, 0x42, 0x31, 0x84, 0x62, 0x08,
+    0xc5, 0x10, 0x8a, 0x21, 0x66, 0x7a, 0x7e, 0x3d, 0xe9, 0xa4, 0x9a, 0xd0, 0x5f, 0x4b, 0x53, 0xa9,
+    0x1d, 0x01, 0xa0, 0x26, 0xb6, 0xd4, 0x0f, 0x0d, 0x50, 0x52, 0x61, 0x1a, 0xc7, 0x0c, 0x04, 0xc9,
+    0x33, 0xcd, 0x83, 0x09, 0xfc, 0x74, 0x9b, 0x50, 0xa2, 0x4c, 0xe4, 0xf0, 0x03, 0x91, 0xd2, 0x13,
+    0x4a, 0xc6, 0xd9, 0xfe, 0x03, 0x16, 0xf0, 0x23, 0x19, 0xf0, 0x43, 0x1c, 0x4c, 0x04, 0x4b, 0x4f,
+    0xda, 0xbe, 0xc4, 0xa5, 0x32, 0x45, 0x94, 0xeb, 0x6a, 0xb0, 0x9a, 0x75, 0x7e, 0x35, 0xd7, 0x18,
+    0x9c, 0x5f, 0xad, 0xeb, 0x63, 0x20, 0xbb, 0x7b, 0x64, 0x7f, 0x37, 0x09, 0xc6, 0x73, 0x8b, 0xb8,
+    0xb8, 0x8a, 0x16, 0x41, 0xbb, 0x2d, 0xde, 0xd3, 0xd1, 0xc1, 0x01, 0x1d, 0x4f, 0x50, 0xd5, 0x46,
+    0x50, 0xdd, 0x46, 0x50, 0xe5, 0x46, 0x50, 0xed, 0x86, 0x87, 0x94, 0xe3, 0x6e, 0x7c, 0x87, 0x74,
+    0x2a, 0x12, 0x51, 0x33, 0x7b, 0xa9, 0xf5, 0x93, 0x59, 0xcd, 0xcf, 0xca, 0xca, 0x62, 0x29, 0x1c,
+    0x78, 0x9d, 0xb2, 0x93, 0x15, 0xb3, 0x6a, 0xc5, 0x31, 0x5a, 0x6c, 0x53, 0xe4, 0xab, 0xbc, 0x1d,
+    0xbc, 0x15, 0x92, 0xdb, 0xde, 0xf7, 0x8c, 0x20, 0x61, 0x76, 0xf2, 0xe5, 0x4f, 0x45, 0xdb, 0x79,
+    0xd0, 0xcf, 0x5b, 0xb3, 0x67, 0xc4, 0xb3, 0x22, 0xb3, 0x93, 0x68, 0x6f, 0x65, 0xd7, 0xa6, 0x5e,
+    0xc8, 0x93, 0x41, 0xf0, 0x86, 0x59, 0xd7, 0x0b, 0x69, 0xa3, 0x87, 0x2e, 0x46, 0xda, 0x75, 0x34,
+    0x1f, 0xe9, 0x0b, 0xf4, 0x29, 0xa4, 0xff, 0x50, 0xda, 0x98, 0x63, 0xf7, 0xb9, 0xaf, 0x38, 0xff,
+    0xde, 0x8b, 0x81, 0x7d, 0xdc, 0xbc, 0xf0, 0x5f, 0x5c, 0x8a, 0x42, 0xfb, 0x2f, 0xc3, 0xa0, 0x6a,
+    0x68, 0xeb, 0xbb, 0x07, 0xd9, 0xc9, 0x72, 0x04, 0x54, 0x9f, 0x85, 0x8c, 0x0f, 0xd9, 0x83, 0x9c,
+    0x52, 0x76, 0xdb, 0xed, 0xe2, 0x60, 0xbb, 0x9d, 0x5b, 0x6a, 0x9e, 0xe5, 0x4b, 0xcd, 0x78, 0x4a,
+    0x1c, 0xa0, 0x8a, 0xbd, 0x10, 0x9e, 0xcd, 0x76, 0x64, 0xcd, 0xa3, 0x64, 0xac, 0xb4, 0x12, 0x07,
+    0xc4, 0xfa, 0x7c, 0x88, 0xee, 0x7b, 0x44, 0x83, 0x8b, 0x2b, 0x73, 0x80, 0x03, 0xba, 0x2e, 0xa8,
+    0xcd, 0x99, 0xf8, 0x1c, 0xd0, 0x55, 0x00, 0x7a, 0x9c, 0x1e, 0xa6, 0xd5, 0xca, 0x31, 0xad, 0x56,
+    0x82, 0x69, 0xb5, 0x49, 0x88, 0x56, 0x5b, 0x9f, 0x04, 0x6b, 0x35, 0x16, 0x57, 0x36, 0x0f, 0x8b,
+    0x2b, 0xb3, 0xb5, 0x9a, 0x1f, 0x57, 0x66, 0x68, 0x35, 0x25, 0xae, 0x2c, 0xd0, 0x6a, 0x6d, 0xc6,
+    0x95, 0x9d, 0xb9, 0x55, 0xab, 0xcf, 0xe0, 0x12, 0x03, 0x60, 0x92, 0x06, 0x14, 0xf0, 0x8a, 0xf0,
+    0xfe, 0x6c, 0xd6, 0xe6, 0xa2, 0x3c, 0xa1, 0x0f, 0x4f, 0xd5, 0x33, 0xd9, 0x62, 0x18, 0xcb, 0xb3,
+    0xfb, 0x6c, 0x09, 0x9b, 0x0c, 0x32, 0xbb, 0xcf, 0x2d, 0x16, 0x83, 0x48, 0x08, 0xf4, 0x59, 0xd8,
+    0x64, 0x90, 0x2c, 0xdf, 0xb7, 0x18, 0x04, 0xcb, 0xb6, 0x04, 0x93, 0x41, 0xb2, 0x4c, 0xb3, 0x18,
+    0x04, 0x4b, 0x65, 0x82, 0xc9, 0x20, 0x59, 0x66, 0x58, 0x0c, 0x82, 0xa5, 0x2a, 0xc1, 0x4e, 0x7b,
+    0xc4, 0x59, 0x66, 0x59, 0x0c, 0x82, 0xa5, 0xba, 0xa7, 0x9d, 0xf6, 0x88, 0xb3, 0xac, 0x04, 0xd2,
+    0x1e, 0x55, 0xf8, 0x55, 0xa0, 0xe7, 0x49, 0x52, 0xf2, 0x21, 0x8d, 0x35, 0xaa, 0xb3, 0x02, 0x66,
+    0x08, 0x58, 0xc6, 0x5a, 0xea, 0xa3, 0x02, 0x66, 0x90, 0x2c, 0x63, 0x01, 0x8d, 0x53, 0x01, 0x33,
+    0x70, 0x96, 0xb1, 0xa0, 0x6d, 0xa3, 0x02, 0x66, 0xf0, 0x58, 0xc6, 0x22, 0xe6, 0x90, 0xa2, 0xaf,
+    0xd3, 0x7e, 0x6e, 0x40, 0xee, 0x42, 0x20, 0x2e, 0xa3, 0x60, 0xb0, 0xa0, 0x1d, 0x2c, 0xcc, 0x07,
+    0x0b, 0x0c, 0xc2, 0x42, 0x89, 0xd0, 0xe0, 0x23, 0x34, 0x5c, 0x09, 0x0d, 0x70, 0x6a, 0x2b, 0x24,
+    0x0a, 0x0b, 0xa2, 0xc2, 0xc2, 0xae, 0xb0, 0x40, 0x2d, 0x2c, 0xb4, 0x0b, 0x0b, 0x06, 0xc3, 0xc3,
+    0xc7, 0xe2, 0xb4, 0x25, 0x46, 0xb0, 0x18, 0x0a, 0x2d, 0x6a, 0x46, 0x8b, 0x08, 0x51, 0x10, 0x3f,
+    0x86, 0xc4, 0x40, 0x82, 0x67, 0x1d, 0x51, 0x9f, 0xb0, 0x7b, 0x9c, 0x3b, 0x40, 0x46, 0x61, 0x25,
+    0x89, 0xa2, 0x65, 0x07, 0xa2, 0x87, 0x7c, 0xc4, 0x8a, 0x44, 0x1a, 0xc5, 0xbf, 0x27, 0x3a, 0xca,
+    0xa0, 0x63, 0x1c, 0xd8, 0x6f, 0x60, 0xa5, 0xc2, 0xde, 0xa3, 0xb3, 0xe5, 0x16, 0x41, 0x6b, 0xb0,
+    0x4d, 0xb9, 0xe1, 0xad, 0xc4, 0x8d, 0xed, 0x67, 0x08, 0xe0, 0xfa, 0x79, 0x87, 0x8e, 0xdf, 0x13,
+    0x12, 0x72, 0xc7, 0xe9, 0x9d, 0x0d, 0x7b, 0xfd, 0xee, 0x40, 0x80, 0x3b, 0xa2, 0x30, 0x70, 0x27,
+    0xa7, 0x3f, 0x87, 0xd1, 0x4d, 0xcb, 0xfc, 0x5d, 0x1d, 0xa4, 0xdf, 0x8d, 0xd0, 0xef, 0xe9, 0x20,
+    0xbd, 0xb0, 0x83, 0xf4, 0x7b, 0x11, 0xfa, 0x7d, 0x1d, 0xa4, 0xdf, 0x8f, 0xd1, 0x29, 0x4c, 0x7f,
+    0x00, 0xa1, 0xff, 0xa8, 0x83, 0xf4, 0x07, 0x11, 0x3a, 0xc1, 0xe8, 0x04, 0xa3, 0x13, 0x60, 0x7d,
+    0x7e, 0x16, 0x66, 0x21, 0x82, 0x66, 0xfa, 0xee, 0xee, 0x74, 0xdd, 0xb5, 0xe3, 0xfa, 0xd2, 0xbf,
+    0xb8, 0xcf, 0x0d, 0x0d, 0x64, 0x22, 0x97, 0xbc, 0xfe, 0x30, 0x06, 0x8d, 0xf8, 0x73, 0x2b, 0xfd,
+    0xd7, 0x05, 0x30, 0x96, 0xc2, 0x96, 0x17, 0x3f, 0x43, 0x38, 0x99, 0x8b, 0x7a, 0x1f, 0xc2, 0x9a,
+    0x7d, 0xcc, 0x43, 0x7f, 0x81, 0xb0, 0xfe, 0x8e, 0x39, 0xdf, 0x7b, 0xc3, 0x60, 0x26, 0xfb, 0xd5,
+    0xf9, 0x08, 0xeb, 0xd3, 0xec, 0x94, 0x2f, 0xe4, 0xc4, 0x9a, 0xb4, 0x23, 0xca, 0xf1, 0x62, 0xd6,
+    0xf5, 0xb8, 0x07, 0x1e, 0xe8, 0x03, 0x83, 0xfd, 0x0f, 0x79, 0x28, 0x72, 0x40, 0x11, 0x61, 0x16,
+    0xd0, 0x03, 0x7d, 0x61, 0xb0, 0xef, 0x01, 0x0f, 0x7d, 0x14, 0x33, 0x8b, 0x78, 0xe0, 0x41, 0x84,
+    0xb5, 0xf7, 0x3e, 0x66, 0x47, 0x45, 0x58, 0x1f, 0x61, 0xb5, 0xdc, 0x0f, 0x06, 0xcf, 0xfb, 0xa7,
+    0x87, 0x2e, 0x44, 0x58, 0x7f, 0xcc, 0x62, 0x74, 0x52, 0x60, 0xb0, 0x17, 0x33, 0x8c, 0x2e, 0x42,
+    0x58, 0xef, 0x65, 0xac, 0xc8, 0xd1, 0x24, 0x3d, 0xd9, 0x91, 0x30, 0xbf, 0x46, 0x58, 0xef, 0x64,
+    0xe7, 0xc7, 0xa5, 0xc2, 0xe0, 0x39, 0x2c, 0xfe, 0xe6, 0x71, 0x84, 0xf5, 0x76, 0xe6, 0xad, 0x1c,
+    0x00, 0x83, 0xdc, 0x6e, 0xf7, 0x1b, 0x84, 0x95, 0xa5, 0x51, 0x3f, 0x92, 0x86, 0x04, 0xf1, 0x6d,
+    0xd7, 0x42, 0x8f, 0x8c, 0x6b, 0x2a, 0x8b, 0x34, 0x4a, 0x87, 0xc1, 0xf0, 0x16, 0x0f, 0xfd, 0x2d,
+    0xc2, 0xca, 0x42, 0x69, 0x5a, 0x90, 0x83, 0x34, 0x42, 0xec, 0x3c, 0xde, 0xc5, 0x08, 0x2b, 0x73,
+    0x3b, 0xb7, 0x64, 0x20, 0xe8, 0x3a, 0x71, 0xb0, 0x2d, 0x78, 0xdd, 0xc0, 0xcc, 0xdf, 0x99, 0x08,
+    0xfa, 0x1e, 0xc5, 0x8e, 0xbe, 0x20, 0x84, 0x5c, 0xcb, 0x58, 0x07, 0x22, 0xe8, 0x1a, 0x0f, 0x7d,
+    0x16, 0x01, 0x47, 0x7b, 0xe0, 0x31, 0x2c, 0x0e, 0xea, 0x2d, 0x70, 0x3e, 0x23, 0xae, 0x2b, 0x18,
+    0xeb, 0x20, 0x04, 0x65, 0x67, 0x2d, 0xfc, 0x1e, 0x01, 0x2f, 0xf5, 0x66, 0x02, 0xc7, 0x07, 0x23,
+    0x28, 0x3b, 0xaa, 0xb7, 0x14, 0x01, 0xff, 0xc3, 0x3b, 0xa4, 0xe2, 0xf8, 0x10, 0x04, 0xfd, 0xb3,
+    0xc7, 0xba, 0x1c, 0x01, 0x2f, 0xf2, 0x36, 0x93, 0x9f, 0x18, 0x8a, 0xa0, 0xff, 0xeb, 0xb1, 0x3e,
+    0x8f, 0x80, 0x17, 0x9e, 0xa0, 0xf4, 0x2b, 0x6c, 0x08, 0x21, 0xa5, 0xad, 0xcf, 0x67, 0xa2, 0x23,
+    0x74, 0xe6, 0x25, 0xa7, 0x34, 0x0b, 0x70, 0x9a, 0x32, 0xc6, 0x3a, 0x18, 0x52, 0xc4, 0xfe, 0x20,
+    0x80, 0xd6, 0xf6, 0x98, 0x0f, 0x52, 0x30, 0xe4, 0x30, 0xdd, 0x94, 0x82, 0x21, 0x94, 0x6e, 0xea,
+    0x87, 0x21, 0x94, 0x7e, 0xd2, 0x0f, 0x43, 0x00, 0xcc, 0x47, 0x28, 0xdd, 0xd8, 0x17, 0x43, 0x28,
+    0xdd, 0xd0, 0xd7, 0x46, 0x3e, 0xcd, 0xe7, 0x9f, 0x1b, 0xfa, 0x58, 0x48, 0x8a, 0xbc, 0x5b, 0xdf,
+    0xc7, 0x42, 0x88, 0x81, 0xa9, 0x88, 0xff, 0xf4, 0x71, 0xb2, 0x85, 0xf8, 0xcf, 0x1f, 0x25, 0x5b,
+    0x88, 0x82, 0x3d, 0x65, 0x22, 0x12, 0x3b, 0x79, 0x53, 0xe8, 0x39, 0x13, 0xe1, 0x98, 0x97, 0x19,
+    0x20, 0xf4, 0x9c, 0x89, 0x78, 0x18, 0xdf, 0xcb, 0x1f, 0x7a, 0xc4, 0xae, 0x89, 0x31, 0xde, 0x5e,
+    0xfe, 0xf3, 0xdb, 0xbc, 0x62, 0x35, 0x1f, 0x0f, 0x5a, 0x21, 0x74, 0x11, 0x92, 0x5d, 0x31, 0x48,
+    0x89, 0x77, 0x95, 0x47, 0x58, 0xb1, 0xa8, 0x58, 0x71, 0x3e, 0x15, 0x3f, 0xda, 0xac, 0x8e, 0xa9,
+    0x88, 0x94, 0x4d, 0xca, 0x11, 0x92, 0xfd, 0x3e, 0x51, 0x8e, 0x9f, 0xea, 0xb7, 0x51, 0x39, 0x73,
+    0xaa, 0xef, 0x06, 0x7e, 0x3c, 0x24, 0xd3, 0x83, 0x7d, 0x99, 0xd7, 0xb7, 0xe5, 0xbb, 0xec, 0xcb,
+    0xfa, 0x7c, 0xac, 0x18, 0xac, 0x93, 0x3f, 0x52, 0x6c, 0xd7, 0xc9, 0x63, 0xe4, 0x5d, 0x70, 0x5c,
+    0xbe, 0x3e, 0xa4, 0x19, 0xc7, 0xe5, 0x4b, 0xc0, 0x3e, 0x2e, 0x5f, 0x00, 0x0f, 0x21, 0xa3, 0x23,
+    0x78, 0x5c, 0x3e, 0xa5, 0x54, 0x1c, 0x97, 0x2f, 0x83, 0xf9, 0x82, 0x1e, 0x3f, 0xd9, 0x0c, 0xe6,
+    0x93, 0x80, 0x7d, 0x5c, 0xbe, 0x00, 0x80, 0xe3, 0xf2, 0x51, 0x37, 0xfb, 0x69, 0x34, 0xbe, 0x65,
+    0x23, 0x80, 0x88, 0x7f, 0xb6, 0x00, 0x49, 0x37, 0x4b, 0xe5, 0xff, 0xbf, 0x71, 0x68, 0x7c, 0xf0,
+    0x3d, 0xfa, 0xa1, 0xf1, 0x39, 0xc1, 0xf7, 0x6b, 0x87, 0xc6, 0x17, 0xb0, 0xbe, 0xb6, 0x8c, 0x91,
+    0x82, 0x43, 0xe3, 0xb3, 0x0b, 0x5e, 0x67, 0xb7, 0xcb, 0xc3, 0xbc, 0x40, 0xe6, 0xa1, 0xf1, 0x41,
+    0x2c, 0xad, 0x7e, 0x68, 0xfc, 0x53, 0x09, 0xfe, 0x58, 0xac, 0x1e, 0x1a, 0x7f, 0x68, 0xaa, 0x36,
+    0x48, 0xfb, 0x87, 0xc6, 0x57, 0x8d, 0x34, 0x46, 0x6f, 0x76, 0x68, 0x7c, 0xcd, 0xe2, 0x09, 0xe7,
+    0x7e, 0x8d, 0x74, 0xbb, 0x65, 0xd6, 0x03, 0x97, 0x3b, 0xdf, 0x65, 0x90, 0xef, 0xdc, 0x4d, 0x6b,
+    0x6e, 0x4f, 0x70, 0x4c, 0xfa, 0xb9, 0x3b, 0x5e, 0xae, 0x9b, 0x3a, 0x4c, 0x30, 0x91, 0x20, 0x42,
+    0x44, 0xc5, 0x8e, 0x55, 0x14, 0x56, 0xb5, 0x46, 0x57, 0x0b, 0x4a, 0x95, 0x87, 0x4d, 0xa3, 0x8a,
+    0xb1, 0x69, 0x54, 0x19, 0x36, 0x8d, 0x6a, 0xec, 0xd4, 0x69, 0xd4, 0x69, 0xdc, 0x84, 0xae, 0xbc,
+    0xc7, 0x78, 0x00, 0x80, 0xba, 0x9a, 0x22, 0x2b, 0xbd, 0xab, 0xa9, 0xd2, 0xd5, 0xba, 0x5a, 0xdb,
+    0xf5, 0xd1, 0x65, 0x5d, 0xad, 0xfb, 0x8e, 0xed, 0xb1, 0xba, 0xdc, 0xd8, 0xae, 0xa2, 0x50, 0x83,
+    0x83, 0xf6, 0x60, 0x43, 0xdb, 0x94, 0xa0, 0x37, 0x52, 0x5f, 0x5f, 0x1b, 0xcd, 0xa0, 0x81, 0x0c,
+    0x1a, 0xc3, 0xa0, 0xe1, 0xcb, 0xa8, 0xb2, 0x76, 0x1c, 0x12, 0xf1, 0x8d, 0x69, 0x6d, 0x87, 0x5e,
+    0x3a, 0x5a, 0x4c, 0x68, 0x4e, 0x3b, 0x3b, 0xed, 0x1c, 0xc3, 0x89, 0x70, 0x84, 0x22, 0x87, 0xeb,
+    0xdf, 0x84, 0x6c, 0x7e, 0x4c, 0xfc, 0x08, 0xde, 0x2e, 0x99, 0xf4, 0x8c, 0xb2, 0xc1, 0x32, 0x30,
+    0x77, 0x0e, 0x9b, 0xb2, 0x5e, 0xdd, 0x92, 0x09, 0xef, 0x58, 0x84, 0x80, 0x42, 0x78, 0x60, 0x3c,
+    0x7c, 0x77, 0x08, 0x04, 0xde, 0x09, 0x5c, 0x32, 0x81, 0x55, 0xb3, 0xfa, 0x95, 0x87, 0xaf, 0x0f,
+    0xbb, 0xc0, 0x29, 0x67, 0xde, 0x71, 0xe1, 0x98, 0x5d, 0xbc, 0x0f, 0x3f, 0x63, 0x69, 0xc3, 0x62,
+    0xc5, 0x5b, 0xbf, 0x4c, 0x77, 0x77, 0x37, 0xb2, 0x0c, 0x25, 0x5a, 0xa8, 0x88, 0xe2, 0x96, 0xce,
+    0x2e, 0x6d, 0x5c, 0x96, 0x81, 0x47, 0xab, 0x9c, 0xda, 0x85, 0x4e, 0x8f, 0x3a, 0xfe, 0xd8, 0x8e,
+    0x6d, 0x9a, 0x67, 0xf6, 0x63, 0xa7, 0x84, 0x4a, 0xba, 0x16, 0xe1, 0x1e, 0x8d, 0x14, 0x52, 0xf0,
+    0x54, 0x43, 0x9f, 0x60, 0xc8, 0x69, 0x85, 0x31, 0x99, 0x68, 0xc3, 0x6c, 0xad, 0xe9, 0x23, 0x36,
+    0x5d, 0x30, 0x26, 0x09, 0x6e, 0x6a, 0x00, 0x03, 0x46, 0xba, 0x56, 0x28, 0x50, 0x1d, 0x4a, 0xc8,
+    0x1a, 0xa4, 0x84, 0x85, 0x02, 0xdb, 0xa1, 0xa4, 0xaf, 0xc6, 0x8f, 0x43, 0x89, 0x6a, 0xa1, 0x00,
+    0x79, 0x28, 0x15, 0xad, 0x0a, 0xd8, 0x01, 0xf5, 0x50, 0xba, 0xdb, 0x00, 0x90, 0xa1, 0xf9, 0x16,
+    0x50, 0x79, 0x4a, 0x99, 0x78, 0x2b, 0x91, 0x4c, 0xbc, 0x95, 0x11, 0x38, 0x13, 0xaf, 0xf7, 0x08,
+    0x65, 0xe2, 0xe5, 0x0f, 0xb6, 0x10, 0x25, 0xbb, 0x25, 0xf6, 0xc8, 0xd7, 0x55, 0x14, 0x5e, 0xb5,
+    0x66, 0x26, 0x5e, 0x82, 0xed, 0xc7, 0xc0, 0x76, 0x1c, 0x51, 0x82, 0x21, 0x04, 0x45, 0xdc, 0x90,
+    0xeb, 0xa6, 0x06, 0x80, 0x09, 0x33, 0x46, 0x0b, 0x13, 0x76, 0x07, 0x2d, 0x4c, 0x64, 0x84, 0x81,
+    0xb5, 0x30, 0x91, 0x77, 0xd6, 0xc2, 0xc4, 0xbf, 0x33, 0x17, 0x26, 0xfe, 0x9d, 0xb9, 0x30, 0x89,
+    0xcf, 0x64, 0xf4, 0x67, 0x3d, 0x40, 0x7a, 0xe4, 0x3e, 0x5d, 0x6d, 0xe4, 0xe2, 0xe3, 0x76, 0xdf,
+    0xad, 0x76, 0x2e, 0x3e, 0x66, 0xe8, 0x3d, 0x00, 0x34, 0x38, 0x42, 0x42, 0x25, 0x51, 0xa8, 0xc1,
+    0x91, 0xf0, 0xef, 0xe1, 0x5c, 0x7c, 0xe1, 0x3f, 0xb2, 0x8f, 0xd7, 0x0b, 0xb2, 0x8d, 0x5c, 0x7c,
+    0x2f, 0xb0, 0xb9, 0x4a, 0x81, 0x9d, 0x8b, 0xcf, 0xbb, 0x76, 0x8c, 0x04, 0x56, 0xc2, 0x1e, 0x3d,
+    0x1b, 0x5a, 0x09, 0x6b, 0x74, 0xcd, 0x37, 0xa1, 0xd2, 0x55, 0x91, 0xe8, 0x74, 0x05, 0xc8, 0x76,
+    0xeb, 0x5a, 0x97, 0x91, 0xee, 0xcc, 0x4b, 0x7e, 0xee, 0x52, 0x80, 0x3b, 0x5b, 0x9f, 0x0b, 0xe5,
+    0x72, 0xf9, 0xc7, 0x4f, 0x07, 0x60, 0x87, 0xed, 0x3b, 0xdf, 0x9d, 0xf3, 0xdd, 0xb9, 0x20, 0xb6,
+    0xae, 0xec, 0x7e, 0x6e, 0xde, 0x0e, 0x0b, 0x0c, 0xa0, 0x13, 0x68, 0xde, 0xee, 0xac, 0x9c, 0xa7,
+    0x72, 0xbc, 0x03, 0xf9, 0xd6, 0xec, 0xa7, 0xdf, 0xd8, 0xfc, 0xa5, 0xd5, 0x07, 0xd3, 0x4b, 0xf6,
+    0x81, 0xbd, 0x76, 0xee, 0x51, 0xb8, 0x9f, 0xdf, 0x19, 0x85, 0x47, 0x86, 0x99, 0x51, 0x64, 0xc8,
+    0xf8, 0x90, 0x7d, 0x7c, 0xb8, 0x78, 0xee, 0x68, 0x7d, 0x2f, 0x72, 0x8a, 0xb7, 0x69, 0xf1, 0x44,
+    0x1e, 0xb2, 0xe9, 0xf3, 0x3d, 0x68, 0x83, 0x36, 0xe3, 0x98, 0x00, 0x20, 0xfc, 0x37, 0x56, 0x2f,
+    0x2a, 0xf8, 0x8e, 0xb1, 0x55, 0x5a, 0x2d, 0xd5, 0xa1, 0x2d, 0x2b, 0x16, 0xcf, 0x39, 0xcf, 0x48,
+    0x40, 0x11, 0x24, 0x47, 0x5f, 0x20, 0x95, 0x8f, 0xf5, 0xe6, 0x47, 0xef, 0x90, 0xad, 0xd8, 0x94,
+    0x55, 0xf4, 0x5e, 0x54, 0xba, 0xb3, 0xf5, 0x82, 0x24, 0x5f, 0x35, 0x67, 0x31, 0xef, 0x6a, 0x5b,
+    0x80, 0xf2, 0x4f, 0x60, 0x3f, 0x09, 0x6d, 0x56, 0x65, 0x1b, 0x55, 0x6e, 0xb6, 0xe9, 0xe3, 0x00,
+    0x8e, 0xde, 0x57, 0xde, 0xba, 0x68, 0xb5, 0xf8, 0x0d, 0xc4, 0x2a, 0x35, 0x1b, 0x06, 0xbc, 0xf7,
+    0x80, 0xe8, 0xec, 0xcd, 0x81, 0x44, 0xf2, 0x5c, 0x56, 0xfa, 0x09, 0x09, 0x9a, 0x74, 0xcf, 0x8e,
+    0x80, 0x26, 0x17, 0xc4, 0xd6, 0x41, 0x1a, 0x34, 0x9d, 0x81, 0x66, 0x32, 0xd0, 0x24, 0x06, 0x9a,
+    0xbf, 0x80, 0x31, 0x9a, 0x40, 0x30, 0x23, 0x18, 0xf4, 0x08, 0x06, 0x47, 0x42, 0x41, 0x94, 0xf6,
+    0x0c, 0xc5, 0xd9, 0x7d, 0xdc, 0x4e, 0xbd, 0x58, 0xee, 0xd4, 0xfb, 0x26, 0x40, 0x22, 0x96, 0x29,
+    0xb7, 0x00, 0xcb, 0x94, 0x5b, 0x93, 0x88, 0x65, 0xca, 0x2d, 0xc0, 0x32, 0xe5, 0x2a, 0x2c, 0x46,
+    0xa6, 0xdc, 0x02, 0x2c, 0x53, 0xae, 0xcf, 0x62, 0x65, 0xca, 0x2d, 0xc0, 0x32, 0xe5, 0x0a, 0x16,
+    0x20, 0x53, 0x6e, 0x01, 0x96, 0x29, 0x97, 0xb1, 0x80, 0x99, 0x72, 0x0b, 0xb0, 0x4c, 0xb9, 0x35,
+    0x89, 0x58, 0xa6, 0xdc, 0x02, 0x2c, 0x53, 0x6e, 0xcd, 0x99, 0x9c, 0x29, 0xd7, 0x79, 0x4c, 0x4e,
+    0x03, 0x10, 0x95, 0x49, 0xaf, 0x42, 0x54, 0xbb, 0x8b, 0xb2, 0x81, 0x2c, 0xcb, 0x1f, 0x09, 0xfd,
+    0xbb, 0xa6, 0x7f, 0x78, 0x7f, 0xaf, 0x97, 0x26, 0xb3, 0xe0, 0xee, 0x1f, 0x2f, 0x79, 0x7f, 0xbd,
+    0x89, 0xe4, 0x4f, 0xa8, 0x76, 0xf7, 0x12, 0x4b, 0xc3, 0xf3, 0x3b, 0x42, 0x08, 0x5b, 0x96, 0x05,
+    0x77, 0x25, 0xac, 0x46, 0x6b, 0x7b, 0x90, 0x73, 0x3f, 0xa7, 0xe2, 0xae, 0x57, 0x03, 0xaf, 0x63,
+    0x96, 0x20, 0xfc, 0xb7, 0xfd, 0x9e, 0x11, 0x25, 0x7f, 0x2e, 0xeb, 0x0f, 0x2c, 0xcf, 0x80, 0x48,
+    0xfd, 0xc2, 0x4a, 0xbd, 0xa3, 0x4f, 0x30, 0x54, 0x4e, 0x25, 0x24, 0xb1, 0x4a, 0x3e, 0xe4, 0x13,
+    0x7f, 0xad, 0x57, 0xe5, 0xf5, 0xa2, 0xc1, 0xbb, 0xf9, 0xc3, 0x2a, 0x42, 0xc8, 0x2a, 0x7e, 0xbb,
+    0x9b, 0xa7, 0x27, 0xe1, 0x67, 0x66, 0x35, 0x7b, 0xc7, 0x58, 0xe5, 0x34, 0xb3, 0xe3, 0xb9, 0x2e,
+    0x94, 0x6e, 0xf1, 0xc2, 0xf2, 0xc6, 0x22, 0x3e, 0x07, 0x4f, 0x2e, 0x6a, 0x2c, 0x2f, 0x8c, 0x7c,
+    0x7d, 0x76, 0x64, 0x97, 0x4d, 0xd1, 0x65, 0x4d, 0x75, 0x59, 0x53, 0xcf, 0xd2, 0xb3, 0x6a, 0xdd,
+    0x46, 0x84, 0xee, 0xb0, 0x11, 0xa1, 0x73, 0xaf, 0x4a, 0x8c, 0xde, 0xde, 0x0c, 0xb4, 0x8e, 0xde,
+    0x29, 0xf4, 0xf6, 0xd7, 0x54, 0xe7, 0x24, 0xab, 0xbd, 0x60, 0xee, 0x92, 0x35, 0x7b, 0xfd, 0xec,
+    0x53, 0x33, 0x1a, 0x15, 0x34, 0xe3, 0x1d, 0xf5, 0x9f, 0xcf, 0xf9, 0x40, 0xe3, 0x7d, 0x5a, 0xfb,
+    0xaa, 0x6b, 0xa8, 0xe6, 0x7b, 0xfa, 0x95, 0xee, 0x71, 0xfa, 0x9b, 0xee, 0x67, 0x6a, 0xd6, 0xbd,
+    0x4b, 0x14, 0xd8, 0xf3, 0x18, 0x97, 0xb1, 0xc9, 0x54, 0xf7, 0xd7, 0x52, 0xdd, 0x4b, 0xdb, 0xac,
+    0xfb, 0x66, 0x8b, 0x34, 0x8f, 0xac, 0x48, 0x3e, 0x29, 0x44, 0xb6, 0x2a, 0x47, 0x35, 0xd8, 0xe7,
+    0x6b, 0x3f, 0xd9, 0xc7, 0x30, 0xe7, 0xe7, 0x1b, 0x5a, 0x43, 0xf2, 0x4a, 0x9f, 0x83, 0x9f, 0xd6,
+    0x52, 0x78, 0x1a, 0x8a, 0x74, 0xaf, 0x79, 0xb3, 0xee, 0x55, 0x40, 0xdf, 0x28, 0x9e, 0x63, 0x0c,
+    0x03, 0x7f, 0x26, 0x33, 0x1c, 0x4f, 0xd4, 0xcd, 0xba, 0x1f, 0x24, 0x68, 0x59, 0x33, 0xe9, 0xaf,
+    0xe5, 0xf3, 0x68, 0x3e, 0x5d, 0x5b, 0x37, 0x65, 0x18, 0x7f, 0x7e, 0x42, 0x6f, 0xfc, 0x49, 0xef,
+    0xeb, 0x7d, 0x21, 0xe3, 0xef, 0x46, 0xd7, 0xb8, 0x65, 0xb7, 0x5e, 0x96, 0x6f, 0xcd, 0x7c, 0x6c,
+    0x45, 0xdd, 0x99, 0x98, 0x74, 0xb7, 0x43, 0xc9, 0xc0, 0xf6, 0xae, 0x59, 0x32, 0xe7, 0x7c, 0xbd,
+    0x02, 0x1a, 0x6e, 0x31, 0xa6, 0x2e, 0xab, 0xfa, 0xeb, 0x6d, 0x72, 0x4d, 0xa2, 0xae, 0xf3, 0x1e,
+    0xd7, 0x9b, 0x68, 0x74, 0x74, 0x9b, 0x4d, 0xf4, 0x6d, 0xbd, 0x89, 0x36, 0x9f, 0x89, 0x4d, 0xd4,
+    0x18, 0xbe, 0x82, 0x59, 0x5a, 0xb3, 0x3e, 0x37, 0x2b, 0xd2, 0x67, 0x64, 0xc9, 0xcd, 0xfa, 0x3c,
+    0x2c, 0x67, 0x95, 0x31, 0x3e, 0xe7, 0xef, 0xd0, 0x7f, 0xad, 0x0f, 0x8e, 0xea, 0xbc, 0xe2, 0x9b,
+    0xe5, 0x80, 0x5c, 0xa4, 0x0f, 0xc8, 0xcd, 0xfa, 0x80, 0x4c, 0xcf, 0xf8, 0x01, 0x99, 0x4d, 0x07,
+    0xf7, 0xe9, 0x93, 0xc0, 0x72, 0x7d, 0xea, 0xc7, 0x93, 0x03, 0xcb, 0x09, 0x5f, 0xf4, 0xbf, 0xb5,
+    0x16, 0xbb, 0x40, 0x6b, 0xc0, 0xab, 0x13, 0xd4, 0xc7, 0xb7, 0xd5, 0xd6, 0xbe, 0xd3, 0x1f, 0x8f,
+    0x49, 0xdd, 0x8a, 0x45, 0x33, 0x7b, 0xe9, 0x3a, 0xfd, 0xe6, 0xe5, 0x1b, 0x0f, 0x7f, 0xf6, 0x97,
+    0x39, 0x61, 0xa3, 0xcc, 0xa9, 0xaf, 0xc9, 0xc0, 0x99, 0x91, 0x1a, 0x90, 0x1a, 0xcc, 0x80, 0x0f,
+    0xf3, 0xef, 0x65, 0x89, 0x00, 0x8f, 0x91, 0xd7, 0x94, 0x5e, 0xd9, 0xfa, 0x88, 0xd7, 0x5a, 0xee,
+    0x62, 0x59, 0x17, 0x6f, 0xd6, 0x3b, 0x6c, 0xc5, 0x8c, 0xb4, 0x39, 0xcc, 0x88, 0xb0, 0x7c, 0x39,
+    0xeb, 0xa7, 0x77, 0xa5, 0x4f, 0x7b, 0x5b, 0xff, 0x8f, 0x9b, 0x59, 0xd2, 0xba, 0x39, 0xde, 0x57,
+    0xdf, 0x7f, 0x52, 0xa1, 0xbf, 0x46, 0x58, 0xae, 0x65, 0xde, 0xd1, 0x73, 0x03, 0x7f, 0x78, 0x63,
+    0xaa, 0x26, 0xe7, 0xa1, 0x6b, 0xe4, 0xff, 0xa7, 0x1a, 0x15, 0x10, 0xba, 0xf5, 0xe5, 0xad, 0x87,
+    0x36, 0x2e, 0x67, 0x3e, 0xb5, 0x7f, 0x03,
+};
+
+const baked_glyph_t BAKED_FONT_GLYPHS_2[BAKED_FONT_GLYPH_COUNT] = {
+    {32, 0, 45, 30, 4, 4, 30, 60},
+    {33, 10, 10, 30, 42, 4, 5, 35},
+    {34, 5, 5, 30, 55, 4, 15, 15},
+    {35, 0, 10, 30, 78, 4, 25, 25},
+    {36, 0, 5, 30, 111, 4, 25, 45},
+    {37, 0, 10, 30, 144, 4, 25, 35},
+    {38, 0, 10, 30, 177, 4, 27, 36},
+    {39, 10, 5, 30, 212, 4, 5, 15},
+    {40, 5, 4, 30, 225, 4, 16, 47},
+    {41, 4, 4, 30, 249, 4, 16, 47},
+    {42, 0, 10, 30, 273, 4, 25, 25},
+    {43, 0, 15, 30, 306, 4, 25, 25},
+    {44, 6, 33, 30, 339, 4, 12, 22},
+    {45, 5, 25, 30, 359, 4, 15, 5},
+    {46, 7, 33, 30, 382, 4, 11, 11},
+    {47, 0, 5, 30, 401, 4, 29, 50},
+    {48, 0, 10, 30, 438, 4, 25, 35},
+    {49, 0, 10, 30, 471, 4, 25, 35},
+    {50, 0, 10, 30, 504, 4, 25, 35},
+    {51, 0, 10, 30, 537, 4, 25, 35},
+    {52, 0, 10, 30, 570, 4, 25, 35},
+    {53, 0, 10, 30, 603, 4, 25, 35},
+    {54, 0, 10, 30, 636, 4, 25, 35},
+    {55, 0, 10, 30, 669, 4, 25, 35},
+    {56, 0, 10, 30, 702, 4, 25, 35},
+    {57, 0, 10, 30, 735, 4, 25, 35},
+    {58, 7, 18, 30, 768, 4, 11, 26},
+    {59, 6, 18, 30, 787, 4, 12, 37},
+    {60, 3, 9, 30, 807, 4, 24, 38},
+    {61, 0, 20, 30, 839, 4, 25, 15},
+    {62, 3, 8, 30, 872, 4, 24, 38},
+    {63, 0, 10, 30, 904, 4, 25, 35},
+    {64, 0, 10, 30, 937, 4, 25, 35},
+    {65, 0, 10, 30, 970, 4, 25, 35},
+    {66, 0, 10, 30, 4, 72, 25, 35},
+    {67, 0, 10, 30, 37, 72, 25, 35},
+    {68, 0, 10, 30, 70, 72, 25, 35},
+    {69, 0, 10, 30, 103, 72, 25, 35},
+    {70, 0, 10, 30, 136, 72, 25, 35},
+    {71, 0, 10, 30, 169, 72, 25, 35},
+    {72, 0, 10, 30, 202, 72, 25, 35},
+    {73, 0, 10, 30, 235, 72, 25, 35},
+    {74, 0, 10, 30, 268, 72, 25, 35},
+    {75, 0, 10, 30, 301, 72, 25, 35},
+    {76, 0, 10, 30, 334, 72, 25, 35},
+    {77, 0, 10, 30, 367, 72, 25, 35},
+    {78, 0, 10, 30, 400, 72, 25, 35},
+    {79, 0, 10, 30, 433, 72, 25, 35},
+    {80, 0, 10, 30, 466, 72, 25, 35},
+    {81, 0, 10, 30, 499, 72, 26, 41},
+    {82, 0, 10, 30, 533, 72, 25, 35},
+    {83, 0, 10, 30, 566, 72, 25, 35},
+    {84, 0, 10, 30, 599, 72, 25, 35},
+    {85, 0, 10, 30, 632, 72, 25, 35},
+    {86, 0, 10, 30, 665, 72, 25, 35},
+    {87, 0, 10, 30, 698, 72, 25, 35},
+    {88, 0, 10, 30, 731, 72, 25, 35},
+    {89, 0, 10, 30, 764, 72, 25, 35},
+    {90, 0, 10, 30, 797, 72, 25, 35},
+    {91, 10, 5, 30, 830, 72, 10, 45},
+    {92, 1, 4, 30, 848, 72, 29, 51},
+    {93, 5, 5, 30, 885, 72, 10, 45},
+    {94, 0, 8, 30, 903, 72, 27, 18},
+    {95, 0, 49, 30, 938, 72, 30, 6},
+    {96, 4, 5, 30, 976, 72, 12, 12},
+    {97, 0, 20, 30, 4, 140, 25, 25},
+    {98, 0, 10, 30, 37, 140, 25, 35},
+    {99, 0, 20, 30, 70, 140, 25, 25},
+    {100, 0, 10, 30, 103, 140, 25, 35},
+    {101, 0, 20, 30, 136, 140, 25, 25},
+    {102, 5, 10, 30, 169, 140, 20, 35},
+    {103, 0, 20, 30, 197, 140, 25, 35},
+    {104, 0, 10, 30, 230, 140, 25, 35},
+    {105, 5, 10, 30, 263, 140, 15, 35},
+    {106, 0, 10, 30, 286, 140, 15, 45},
+    {107, 0, 10, 30, 309, 140, 25, 35},
+    {108, 5, 10, 30, 342, 140, 15, 35},
+    {109, 0, 20, 30, 365, 140, 25, 25},
+    {110, 0, 20, 30, 398, 140, 25, 25},
+    {111, 0, 20, 30, 431, 140, 25, 25},
+    {112, 0, 20, 30, 464, 140, 25, 35},
+    {113, 0, 20, 30, 497, 140, 25, 35},
+    {114, 0, 20, 30, 530, 140, 25, 25},
+    {115, 0, 20, 30, 563, 140, 25, 25},
+    {116, 5, 10, 30, 596, 140, 20, 35},
+    {117, 0, 20, 30, 624, 140, 25, 25},
+    {118, 0, 20, 30, 657, 140, 25, 25},
+    {119, 0, 20, 30, 690, 140, 25, 25},
+    {120, 0, 20, 30, 723, 140, 25, 25},
+    {121, 0, 20, 30, 756, 140, 25, 35},
+    {122, 0, 20, 30, 789, 140, 25, 25},
+    {123, 5, 0, 30, 822, 140, 15, 55},
+    {124, 10, 5, 30, 845, 140, 5, 45},
+    {125, 5, 0, 30, 858, 140, 15, 55},
+    {126, 0, 20, 30, 881, 140, 25, 10},
+};
+
+#define BAKED_FONT_2 {60, 1024, 512, 70470, 6807, BAKED_FONT_PIXELS_2, BAKED_FONT_GLYPHS_2}
+
+const baked_font_t BAKED_FONTS[BAKED_FONT_LEVELS] = {BAKED_FONT_0, BAKED_FONT_1, BAKED_FONT_2};
+
 #endif //__FONT_H
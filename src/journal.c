@@ -0,0 +1,133 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "journal.h"
+
+#if !defined(_WIN32) && !defined(PLATFORM_WASM)
+    #define JOURNAL_HAS_MMAP
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#define JOURNAL_INITIAL_CAPACITY ((size_t)64 << 20)
+#define JOURNAL_ALIGNMENT 8 // every append starts aligned, so that structs can be read from the mapping directly.
+
+struct journal_t {
+    char *path;
+    int fd;
+    unsigned char *data; // mapping of the whole file
+    size_t capacity; // size of the file and the mapping
+    size_t end; // everything behind end is unused
+};
+
+#ifdef JOURNAL_HAS_MMAP
+
+// grow file and mapping, so that at least needed bytes fit.
+static bool journal_reserve(journal_t *journal, size_t needed){
+    if (needed <= journal->capacity) return true;
+    size_t capacity = journal->capacity > 0? journal->capacity : JOURNAL_INITIAL_CAPACITY;
+    while (capacity < needed) capacity *= 2;
+    if (ftruncate(journal->fd, capacity) != 0){
+        perror("[JOURNAL] ERROR: unable to grow journal file");
+        return false;
+    }
+    void *data = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, journal->fd, 0);
+    if (data == MAP_FAILED){
+        perror("[JOURNAL] ERROR: unable to map journal file");
+        return false;
+    }
+    if (journal->data != NULL) munmap(journal->data, journal->capacity);
+    journal->data = data;
+    journal->capacity = capacity;
+    return true;
+}
+
+journal_t *journal_open(const char *path){
+    journal_t *journal = calloc(1, sizeof(*journal));
+    journal->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (journal->fd < 0){
+        perror("[JOURNAL] ERROR: unable to create journal file");
+        free(journal);
+        return NULL;
+    }
+    journal->path = strdup(path);
+    if (!journal_reserve(journal, 1)){
+        journal_close(journal);
+        return NULL;
+    }
+    return journal;
+}
+
+void journal_close(journal_t *journal){
+    if (journal == NULL) return;
+    if (journal->data != NULL) munmap(journal->data, journal->capacity);
+    close(journal->fd);
+    unlink(journal->path);
+    free(journal->path);
+    free(journal);
+}
+
+#else // JOURNAL_HAS_MMAP
+
+static bool journal_reserve(journal_t *journal, size_t needed){
+    return needed <= journal->capacity;
+}
+
+journal_t *journal_open(const char *path){
+    (void)path;
+    printf("[JOURNAL] ERROR: the history journal is not supported on this platform\n");
+    return NULL;
+}
+
+void journal_close(journal_t *journal){
+    (void)journal;
+}
+
+#endif // JOURNAL_HAS_MMAP
+
+bool journal_append(journal_t *journal, const void *data, size_t size, size_t *offset){
+    size_t start = (journal->end + JOURNAL_ALIGNMENT - 1) & ~(size_t)(JOURNAL_ALIGNMENT - 1);
+    *offset = start;
+    if (size == 0) return true;
+    if (!journal_reserve(journal, start + size)) return false;
+    memcpy(journal->data + start, data, size);
+    journal->end = start + size;
+    return true;
+}
+
+const void *journal_read(journal_t *journal, size_t offset, size_t size){
+    if (offset > journal->end || size > journal->end - offset) return NULL;
+    return journal->data + offset;
+}
+
+void journal_truncate(journal_t *journal, size_t end){
+    if (end < journal->end) journal->end = end;
+}
+
+inline size_t journal_end(journal_t *journal){
+    return journal->end;
+}
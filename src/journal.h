@@ -0,0 +1,47 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __JOURNAL_H
+#define __JOURNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Append-only, memory-mapped scratch file.
+// Data is only ever added at the end, or dropped from the end by truncating, which makes it usable as an on-disk stack.
+// The file is removed when the journal is closed.
+
+typedef struct journal_t journal_t;
+
+// returns NULL if the file can not be created or mapped (or memory mapping is not supported on the platform).
+journal_t *journal_open(const char *path);
+void journal_close(journal_t *journal);
+
+// appends data and stores its offset, which is aligned to 8 bytes. Returns false if the file could not be grown.
+bool journal_append(journal_t *journal, const void *data, size_t size, size_t *offset);
+// returns a pointer into the mapping, which stays valid until the next append. NULL if the range is out of bounds.
+const void *journal_read(journal_t *journal, size_t offset, size_t size);
+// drop everything behind end.
+void journal_truncate(journal_t *journal, size_t end);
+size_t journal_end(journal_t *journal);
+
+#endif // __JOURNAL_H
@@ -0,0 +1,257 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef DISABLE_THREADS
+    #include <pthread.h>
+#endif
+
+#include "loader.h"
+#include "qoi.h"
+#include "rawfile.h"
+#include "startup.h"
+#include "trace.h"
+
+#define LOADER_CHUNK_SIZE (1 << 20) // bytes read between progress updates and cancellation checks
+
+struct loader_t {
+    char *path;
+    Image image;
+#ifndef DISABLE_THREADS
+    pthread_mutex_t lock;
+#endif
+    // guarded by lock
+    loader_status_t status;
+    long bytes_read;
+    long file_size;
+    bool cancelled; // the worker owns the loader from then on and frees it when done
+};
+
+static void loader_lock(loader_t *loader){
+#ifndef DISABLE_THREADS
+    pthread_mutex_lock(&loader->lock);
+#else
+    (void)loader;
+#endif
+}
+
+static void loader_unlock(loader_t *loader){
+#ifndef DISABLE_THREADS
+    pthread_mutex_unlock(&loader->lock);
+#else
+    (void)loader;
+#endif
+}
+
+static void loader_free(loader_t *loader){
+#ifndef DISABLE_THREADS
+    pthread_mutex_destroy(&loader->lock);
+#endif
+    free(loader->path);
+    free(loader);
+}
+
+// opens the file and publishes its size for the progress. Returns NULL on failure.
+static FILE *loader_open(loader_t *loader, long *size){
+    FILE *file = fopen(loader->path, "rb");
+    if (file == NULL) return NULL;
+    if (fseek(file, 0, SEEK_END) != 0 || (*size = ftell(file)) <= 0 || fseek(file, 0, SEEK_SET) != 0){
+        fclose(file);
+        return NULL;
+    }
+    loader_lock(loader);
+    loader->file_size = *size;
+    loader_unlock(loader);
+    return file;
+}
+
+// publishes the progress, returns true if the loader was cancelled.
+static bool loader_progress(loader_t *loader, long bytes_read){
+    loader_lock(loader);
+    loader->bytes_read = bytes_read;
+    bool cancelled = loader->cancelled;
+    loader_unlock(loader);
+    return cancelled;
+}
+
+// read the whole file in chunks, so that progress can be reported and cancelling doesn't wait for the disk.
+// returns NULL on failure or when cancelled.
+static unsigned char *loader_read(loader_t *loader, long *size){
+    FILE *file = loader_open(loader, size);
+    if (file == NULL) return NULL;
+    unsigned char *data = malloc(*size);
+    if (data == NULL){
+        fclose(file);
+        return NULL;
+    }
+
+    long offset = 0;
+    while (offset < *size){
+        size_t chunk = *size - offset < LOADER_CHUNK_SIZE? *size - offset : LOADER_CHUNK_SIZE;
+        if (fread(data + offset, 1, chunk, file) != chunk) break;
+        offset += chunk;
+        if (loader_progress(loader, offset)) break;
+    }
+    fclose(file);
+    if (offset < *size){
+        free(data);
+        return NULL;
+    }
+    return data;
+}
+
+// qoi is decoded while reading, straight into the pixels of the image, so the file is never held in memory as a whole.
+// returns an empty image on failure or when cancelled.
+static Image loader_readQoi(loader_t *loader){
+    long size = 0;
+    FILE *file = loader_open(loader, &size);
+    if (file == NULL) return (Image){0};
+    unsigned char *chunk = malloc(LOADER_CHUNK_SIZE);
+    qoi_reader_t reader;
+    qoi_readerInit(&reader);
+    long offset = 0;
+    size_t read;
+    while (chunk != NULL && (read = fread(chunk, 1, LOADER_CHUNK_SIZE, file)) > 0){
+        offset += read;
+        if (!qoi_readerFeed(&reader, chunk, read) || loader_progress(loader, offset)) break;
+    }
+    free(chunk);
+    fclose(file);
+    Image image = qoi_readerFinish(&reader);
+    if (offset < size){
+        UnloadImage(image);
+        return (Image){0};
+    }
+    return image;
+}
+
+static void *loader_run(void *arg){
+    loader_t *loader = arg;
+    uint64_t trace_start = trace_begin();
+    uint64_t startup_start = startup_begin();
+    Image image = {0};
+    if (IsFileExtension(loader->path, ".qoi")){
+        image = loader_readQoi(loader);
+    } else {
+        long size = 0;
+        unsigned char *data = loader_read(loader, &size);
+        if (data != NULL){
+            loader_lock(loader);
+            loader->status = LOADER_DECODING;
+            bool cancelled = loader->cancelled;
+            loader_unlock(loader);
+            int width, height;
+            if (IsFileExtension(loader->path, ".raw")){
+                // nothing to decode, the file data becomes the image.
+                if (!cancelled && rawfile_parseSize(loader->path, size, &width, &height)){
+                    image = (Image){.data=data, .width=width, .height=height, .mipmaps=1, .format=PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+                    data = NULL;
+                }
+            } else if (!cancelled){
+                // raylib picks the decoder from the file extension, same as LoadImage
+                image = LoadImageFromMemory(GetFileExtension(loader->path), data, size);
+            }
+            free(data);
+        }
+    }
+    trace_end("load image", trace_start);
+    startup_end("load image", startup_start);
+
+    loader_lock(loader);
+    bool cancelled = loader->cancelled;
+    loader->image = image;
+    loader->status = IsImageReady(image)? LOADER_DONE : LOADER_FAILED;
+    loader_unlock(loader);
+    if (cancelled){
+        UnloadImage(image);
+        loader_free(loader);
+    }
+    return NULL;
+}
+
+loader_t *loader_start(const char *path){
+    loader_t *loader = calloc(1, sizeof(*loader));
+    if (loader == NULL) return NULL;
+    loader->path = strdup(path);
+    loader->status = LOADER_READING;
+    if (loader->path == NULL){
+        free(loader);
+        return NULL;
+    }
+#ifndef DISABLE_THREADS
+    pthread_mutex_init(&loader->lock, NULL);
+    pthread_t worker;
+    if (pthread_create(&worker, NULL, loader_run, loader) != 0){
+        perror("loader: failed to start worker thread");
+        loader_free(loader);
+        return NULL;
+    }
+    pthread_detach(worker); // the worker might outlive the owner, see loader_cancel()
+#else
+    loader_run(loader);
+#endif
+    return loader;
+}
+
+loader_status_t loader_getStatus(loader_t *loader){
+    loader_lock(loader);
+    loader_status_t status = loader->status;
+    loader_unlock(loader);
+    return status;
+}
+
+bool loader_isFinished(loader_t *loader){
+    loader_status_t status = loader_getStatus(loader);
+    return status == LOADER_DONE || status == LOADER_FAILED;
+}
+
+float loader_getProgress(loader_t *loader){
+    loader_lock(loader);
+    float progress = loader->file_size > 0? (float)loader->bytes_read / loader->file_size : 0.0f;
+    loader_unlock(loader);
+    return progress;
+}
+
+inline const char *loader_getPath(const loader_t *loader){
+    return loader->path;
+}
+
+bool loader_finish(loader_t *loader, Image *image){
+    bool success = loader_getStatus(loader) == LOADER_DONE;
+    if (success) *image = loader->image;
+    loader_free(loader);
+    return success;
+}
+
+void loader_cancel(loader_t *loader){
+    if (loader == NULL) return;
+    loader_lock(loader);
+    bool finished = loader->status == LOADER_DONE || loader->status == LOADER_FAILED;
+    loader->cancelled = true;
+    loader_unlock(loader);
+    if (finished){
+        UnloadImage(loader->image);
+        loader_free(loader);
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+#ifndef __LOADER_H
+#define __LOADER_H
+
+#include <stdbool.h>
+
+#include "external/raylib/src/raylib.h"
+
+// Decodes an image file on a worker thread, so that the window stays responsive.
+// Built without threads (DISABLE_THREADS), the image is loaded inside of loader_start.
+
+typedef struct loader_t loader_t;
+
+typedef enum loader_status_t{
+    LOADER_READING,
+    LOADER_DECODING,
+    LOADER_DONE,
+    LOADER_FAILED,
+}loader_status_t;
+
+// returns NULL if the worker could not be started.
+loader_t *loader_start(const char *path);
+
+loader_status_t loader_getStatus(loader_t *loader);
+bool loader_isFinished(loader_t *loader); // status is LOADER_DONE or LOADER_FAILED
+// fraction of the file that has been read, 0 - 1.
+float loader_getProgress(loader_t *loader);
+const char *loader_getPath(const loader_t *loader);
+
+// frees a finished loader. Returns true and hands over the decoded image if loading succeeded.
+bool loader_finish(loader_t *loader, Image *image);
+// frees the loader without waiting for it. A decode that is already in progress runs to completion in the background and is discarded.
+void loader_cancel(loader_t *loader);
+
+#endif // __LOADER_H
@@ -20,16 +20,24 @@
  *  3. This notice may not be removed or altered from any source distribution.
  */
 
+#include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "external/raylib/src/raylib.h"
 #include "external/raylib/src/raymath.h"
 
+#include "batch.h"
 #include "canvas.h"
+#include "loader.h"
 #include "menu.h"
+#include "replay.h"
+#include "startup.h"
+#include "trace.h"
 #include "util.h"
+#include "view.h"
 
 Vector2 RectangleCenter(Rectangle rect){
     return (Vector2){rect.x + rect.width/2.0f, rect.y + rect.height/2.0f};
@@ -41,42 +49,166 @@ Vector2 Vector2FloorPositive(Vector2 vec){
 }
 
 
+// smallest zoom, the coarsest mip level is then drawn 1:1.
+#define MIN_SCALE (1.0f / (1 << CANVAS_MAX_MIP_LEVEL))
+
+// integer when zoomed in, so that every pixel of the texture is drawn as the same multiple. This is important for drawing the grid.
+// below 1x the scale is continuous and a mip level is drawn instead.
+static float effectiveScale(float floating_scale){
+    return floating_scale >= 1.0f? floorf(floating_scale) : floating_scale;
+}
+
+#define TARGET_FPS 60
+
+// spinner and progress of an image load, centered in bounds.
+static void drawLoading(loader_t *loader, Rectangle bounds, int font_size){
+    Vector2 center = {bounds.x + bounds.width/2, bounds.y + bounds.height/2};
+    float angle = fmodf(GetTime()*360.0f, 360.0f);
+    DrawRing(center, 0.6f*font_size, 0.8f*font_size, angle, angle + 270.0f, 32, WHITE);
+    const char *text = loader_getStatus(loader) == LOADER_READING? TextFormat("loading %d%%", (int)(100*loader_getProgress(loader))) : "decoding...";
+    DrawText(text, center.x - MeasureText(text, font_size)/2, center.y + font_size, font_size, WHITE);
+    const char *hint = "esc to cancel";
+    DrawText(hint, center.x - MeasureText(hint, font_size/2)/2, center.y + 2.5f*font_size, font_size/2, GRAY);
+}
+
+static void printUsage(const char *program){
+    printf("usage: %s [options] [image]\n", program);
+    printf("options:\n");
+    printf("  --history-budget <MiB>  memory limit of the undo history (default: %zu)\n", DEFAULT_HISTORY_BUDGET >> 20);
+    printf("  --journal <file>        move history exceeding the budget to a temporary file instead of dropping it\n");
+    printf("  --batch <script>        run the commands of script ('-' for stdin) on the image without opening a window\n");
+    printf("  --trace <file>          write the duration of frame phases and canvas operations to file on exit (chrome trace format)\n");
+    printf("  --record <file>         record the input of the session to file\n");
+    printf("  --replay <file>         play back a recorded session as fast as possible, with a fixed frame time, and exit\n");
+    printf("  --raw-in-place          write changes of a .raw image to the file as they happen, instead of on save\n");
+    printf("  --startup-times         print how long the startup phases took once the first frame is drawn\n");
+}
+
 int main(int argc, char **argv){
+    // parse command line
+    const char *image_path = NULL;
+    size_t history_budget = DEFAULT_HISTORY_BUDGET;
+    const char *journal_path = NULL;
+    const char *batch_path = NULL;
+    const char *trace_path = NULL;
+    const char *record_path = NULL;
+    const char *replay_path = NULL;
+    bool raw_in_place = false;
+    bool print_startup_times = false;
+    for (int i = 1; i < argc; i++){
+        if (strcmp(argv[i], "--history-budget") == 0 && i + 1 < argc){
+            char *endptr;
+            long value = strtol(argv[++i], &endptr, 10);
+            if (*endptr != 0 || value <= 0){
+                printf("Error: invalid history budget '%s'\n", argv[i]);
+                return 1;
+            }
+            history_budget = (size_t)value << 20;
+        } else if (strcmp(argv[i], "--journal") == 0 && i + 1 < argc){
+            journal_path = argv[++i];
+        } else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc){
+            batch_path = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc){
+            trace_path = argv[++i];
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc){
+            record_path = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc){
+            replay_path = argv[++i];
+        } else if (strcmp(argv[i], "--raw-in-place") == 0){
+            raw_in_place = true;
+        } else if (strcmp(argv[i], "--startup-times") == 0){
+            print_startup_times = true;
+        } else if (strncmp(argv[i], "--", 2) == 0 || image_path != NULL){
+            printUsage(argv[0]);
+            return 1;
+        } else {
+            image_path = argv[i];
+        }
+    }
+    if (record_path != NULL && replay_path != NULL){
+        printf("Error: --record and --replay can not be used together\n");
+        return 1;
+    }
+
+    if (print_startup_times) startup_enable();
     SetTraceLogLevel(LOG_WARNING); // Logs could also be redirected with a custom callback function.
+    if (trace_path != NULL && !trace_enable(trace_path)) return 1;
+
+    if (batch_path != NULL){
+        FILE *script = strcmp(batch_path, "-") == 0? stdin : fopen(batch_path, "r");
+        if (script == NULL){
+            printf("Error: failed to open batch script '%s'\n", batch_path);
+            return 1;
+        }
+        batch_config_t config = {.image_path = image_path, .history_budget = history_budget, .journal_path = journal_path};
+        int result = batch_run(script, script == stdin? "stdin" : batch_path, config);
+        if (script != stdin) fclose(script);
+        return result;
+    }
+
+    // image decoding and font decompression need no window, so they run on worker threads while it is created.
+    // raw images are mapped instead of read, which takes no time regardless of their size.
+    bool map_raw = image_path != NULL && IsFileExtension(image_path, ".raw");
+    loader_t *loader = image_path != NULL && !map_raw? loader_start(image_path) : NULL;
+    menu_fonts_t *menu_fonts = prepareMenuFonts();
 
     // draw loading screen
+    uint64_t startup_start = startup_begin();
     SetConfigFlags(FLAG_WINDOW_RESIZABLE);
     InitWindow(1000, 800, "Image maker for angry programmers");
     SetExitKey(KEY_NULL); // disable exit on KEY_ESCAPE to avoid accidental window closing.
-    SetTargetFPS(60);
+    SetTargetFPS(TARGET_FPS);
 
     BeginDrawing();
     char *loading_text = "loading...";
     int loadingFontSize = DEFAULT_FONT_SIZE;
     DrawText(loading_text, (GetScreenWidth()-MeasureText(loading_text, loadingFontSize))/2, GetScreenHeight()/2, loadingFontSize, WHITE);
     EndDrawing();
+    startup_end("create window", startup_start);
 
     // -- initialize application --
 
     Image start_image = {0};
     bool has_loaded_image = false;
     char filename[MAX_FILENAME_SIZE];
-
-    // load image from provided path
-    if (argc == 2){
-        start_image = LoadImage(argv[1]);
-        if (!IsImageReady(start_image)){
-            printf("Error: failed to load image from '%s'\n", argv[1]);
-            UnloadImage(start_image);
+    canvas_t *prep_canvas = NULL;
+
+    startup_start = startup_begin();
+    if (map_raw){
+        prep_canvas = canvas_newRaw(image_path, !raw_in_place);
+        has_loaded_image = prep_canvas != NULL;
+        // without memory mapping, the file is read like any other image.
+        if (!has_loaded_image) loader = loader_start(image_path);
+    }
+    // wait for the image, the window stays responsive while it decodes.
+    if (image_path != NULL && !has_loaded_image){
+        while (loader != NULL && !loader_isFinished(loader)){
+            if (WindowShouldClose() || IsKeyPressed(KEY_ESCAPE)){
+                loader_cancel(loader);
+                discardMenuFonts(menu_fonts);
+                CloseWindow();
+                return 0;
+            }
+            BeginDrawing();
+            ClearBackground(FAV_COLOR);
+            drawLoading(loader, (Rectangle){0, 0, GetScreenWidth(), GetScreenHeight()}, DEFAULT_FONT_SIZE);
+            EndDrawing();
+        }
+        if (loader == NULL || !loader_finish(loader, &start_image)){
+            printf("Error: failed to load image from '%s'\n", image_path);
+            discardMenuFonts(menu_fonts);
+            CloseWindow();
             return 1;
         }
         has_loaded_image = true;
-
-        if (strnlen(argv[1], MAX_FILENAME_SIZE) == MAX_FILENAME_SIZE){
+    }
+    startup_end("wait for image", startup_start);
+    if (image_path != NULL){
+        if (strnlen(image_path, MAX_FILENAME_SIZE) == MAX_FILENAME_SIZE){
             filename[MAX_FILENAME_SIZE-1] = 0; // brutal approach to make string fit.
             // TODO: more graceful solution, that doesn't rip out the postfix.
         }
-        sprintf(filename, "%s", argv[1]);
+        sprintf(filename, "%s", image_path);
         // only set window title, if an image has been opened
         setWindowTitleToPath(filename);
     }
@@ -87,10 +219,17 @@ int main(int argc, char **argv){
         sprintf(filename, "out.png");
         has_loaded_image = true;
     }
-    canvas_t *prep_canvas = canvas_new(start_image);
+    startup_start = startup_begin();
+    if (prep_canvas == NULL) prep_canvas = canvas_new(start_image);
+    canvas_setHistoryBudget(prep_canvas, history_budget);
+    // a failure exits below, through the same teardown as a failed replay
+    bool journalFailed = journal_path != NULL && !canvas_enableHistoryJournal(prep_canvas, journal_path);
+    if (journalFailed) printf("Error: failed to create history journal '%s'\n", journal_path);
     UnloadImage(start_image);
+    startup_end("create canvas", startup_start);
 
-    menu_state_t menu_state = initMenu(filename);
+    view_t view = view_load();
+    menu_state_t menu_state = initMenu(filename, menu_fonts);
     menu_state_t *ms = &menu_state;
 
     shared_state_t state = {
@@ -110,7 +249,7 @@ int main(int argc, char **argv){
 
     // this could possibly be encapsulated. Any change in floating scale requires scale to be set as well.
     float _floating_scale = 0; // used to affect scale. To enable small changes a float is needed.
-    int scale = 0; // floored floating scale that should be used everywhere.
+    float scale = 0; // effective scale that should be used everywhere, see effectiveScale().
 
     Rectangle drawingBounds = {0};
     Vector2 image_position = {0};
@@ -119,8 +258,52 @@ int main(int argc, char **argv){
     // because rgba can only store lossy hue values which leads to color-picker jitters when color approaches white or black.
     setFromRGBA(&s->active_color, DFT_COLOR); // important to initialize from rgba, because HSV does not supply alpha information.
 
+    // input recording and playback
+    replay_t *replay = NULL;
+    if (!journalFailed && record_path != NULL) replay = replay_startRecording(record_path);
+    if (!journalFailed && replay_path != NULL){
+        replay = replay_startPlayback(replay_path);
+        SetTargetFPS(0);
+    }
+    if (journalFailed || ((record_path != NULL || replay_path != NULL) && replay == NULL)){
+        canvas_free(s->canvas);
+        unloadMenu(ms);
+        view_unload(&view);
+        CloseWindow();
+        return 1;
+    }
+    bool isPlayback = replay != NULL && replay_isPlayback(replay);
+    double playback_start = GetTime(), previous_frame = playback_start, slowest_frame = 0;
+
+    // when nothing is going on, the loop blocks on input events and only redraws if something visible changed.
+    bool isWaitingForEvents = false;
+    bool forceRedraw = true;
+    bool wasHoveringMenu = false;
+    bool wasFocused = true;
+    Vector2 drawn_position = {0};
+    float drawn_scale = 0;
+    startup_start = startup_begin(); // until the first frame is on screen, which includes uploading the canvas
+
     while(!WindowShouldClose()){
-        if (IsWindowResized() || s->forceWindowResize){
+        if (replay != NULL && !replay_nextFrame(replay)) break;
+        float frame_time = isPlayback? REPLAY_FRAME_TIME : GetFrameTime();
+        if (isWaitingForEvents) frame_time = 1.0f/TARGET_FPS; // the last frame includes the time spent waiting for this input.
+        uint64_t frame_start = trace_begin();
+        uint64_t phase_start = frame_start;
+        // hand over an image that finished loading in the background
+        if (s->loader != NULL && loader_isFinished(s->loader)){
+            Image new_image;
+            if (loader_getStatus(s->loader) == LOADER_FAILED) printf("Error: failed to load image from '%s'\n", loader_getPath(s->loader));
+            if (loader_finish(s->loader, &new_image)){
+                canvas_setToImage(s->canvas, new_image);
+                UnloadImage(new_image);
+                s->forceImageResize = true;
+            }
+            s->loader = NULL;
+        }
+        updateSave(s, false);
+        bool isResized = IsWindowResized();
+        if (isResized || s->forceWindowResize){
             s->forceWindowResize = false;
             s->forceMenuReset = true;
             s->forceImageResize = true;
@@ -135,11 +318,11 @@ int main(int argc, char **argv){
         if (s->forceImageResize){
             s->forceImageResize = false;
             drawingBounds = (Rectangle){s->menu_rect.width, 0, GetScreenWidth() - s->menu_rect.width, GetScreenHeight()};
-            // TODO support images bigger than drawingBounds
             // Not sure if this code should stay here. On one hand it is convenient to be able to find the image easily. On the other hand it is jarring to resize and move the image.
             Vector2 canvas_size = canvas_getSize(s->canvas);
-            _floating_scale = MAX(1.0f, floor(MIN(drawingBounds.width / canvas_size.x, drawingBounds.height / canvas_size.y)));
-            scale = (int)_floating_scale;
+            float fit = MIN(drawingBounds.width / canvas_size.x, drawingBounds.height / canvas_size.y);
+            _floating_scale = fit >= 1.0f? floorf(fit) : MAX(fit, MIN_SCALE);
+            scale = effectiveScale(_floating_scale);
             image_position = (Vector2){drawingBounds.width - canvas_size.x*scale, drawingBounds.height - canvas_size.y*scale};
             image_position = Vector2Scale(image_position, 0.5);
             image_position = Vector2Add((Vector2){drawingBounds.x, drawingBounds.y}, image_position);
@@ -178,7 +361,8 @@ int main(int argc, char **argv){
                 // color fill
                 else if (s->cursor == CURSOR_COLOR_FILL && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)){
                     s->cursor = CURSOR_DEFAULT;
-                    canvas_colorFlood(s->canvas, pixel, s->active_color.rgba);
+                    if (s->fillAll) canvas_colorReplace(s->canvas, pixel, s->active_color.rgba, (int)s->fillTolerance);
+                    else canvas_colorFlood(s->canvas, pixel, s->active_color.rgba, (int)s->fillTolerance);
                 }
             }
             // shortcuts
@@ -188,17 +372,26 @@ int main(int argc, char **argv){
                 // TODO: investigate if ctrl-+ ctrl-- can be detected for all +/- keys on the keyboard for all +/- keys on the keyboard. with glfw (glfwGetKeyName)
                 int pressed_key = 0;
                 while((pressed_key = GetKeyPressed())){ // a key was pressed this frame (this gets the next key in the queue, but we don't use that.)
+                    forceRedraw = true;
                     switch(pressed_key){
                         case KEY_G: s->showGrid = !s->showGrid; break;
+                        case KEY_F3: s->showFrameStats = !s->showFrameStats; break;
                         case KEY_P: toggleTool(&s->cursor, CURSOR_PIPETTE); break;
                         case KEY_F: toggleTool(&s->cursor, CURSOR_COLOR_FILL); break;
                         case KEY_C: if(isCtrlDown) toggleTool(&s->cursor, CURSOR_PIPETTE); break; // still toggle, to conveniently escape the mode without reaching for KEY_ESCAPE.
-                        case KEY_S: if(isCtrlDown) canvas_saveAsImage(s->canvas, ms->filename); break;
+                        case KEY_S: if(isCtrlDown) startSave(s, ms->filename, isShiftDown? PNG_EFFORT_MAX : PNG_EFFORT_FAST); break; // shift for final exports
                         case KEY_R: if(isCtrlDown) if(canvas_redo(s->canvas)) s->forceImageResize = true; break;
                         case KEY_U: if(canvas_undo(s->canvas)) s->forceImageResize = true; break;
                         case KEY_Y: // fallthrough
                         case KEY_Z: if(isCtrlDown) isShiftDown? (canvas_redo(s->canvas)? s->forceImageResize = true:false) : (canvas_undo(s->canvas)? s->forceImageResize=true:false); break;
-                        case KEY_ESCAPE: s->cursor = CURSOR_DEFAULT; break;
+                        case KEY_ESCAPE:
+                            if (s->loader != NULL){
+                                loader_cancel(s->loader);
+                                s->loader = NULL;
+                            } else {
+                                s->cursor = CURSOR_DEFAULT;
+                            }
+                            break;
                         case KEY_HOME: s->forceWindowResize = true; break; // this causes the canvas to be centered again.
                         case KEY_KP_ADD: {ms->font_size += 1;} break;
                         case KEY_KP_SUBTRACT: {ms->font_size -= 1;} break;
@@ -211,7 +404,7 @@ int main(int argc, char **argv){
                 if(IsKeyDown(KEY_UP))    pan.y += 1;
                 if(IsKeyDown(KEY_DOWN))  pan.y -= 1;
                 const float key_pan_speed = MIN(GetScreenHeight(), GetScreenWidth()); // scale panning speed with window size.
-                image_position = Vector2Add(image_position, Vector2Scale(pan, GetFrameTime()*key_pan_speed));
+                image_position = Vector2Add(image_position, Vector2Scale(pan, frame_time*key_pan_speed));
             }
             // mouse panning
             // FIXME: image_bounds becomes outdated from here on
@@ -222,52 +415,124 @@ int main(int argc, char **argv){
             float mouse_scroll;
             if ((mouse_scroll = GetMouseWheelMove())){
                 const float scroll_speed = 1.2; // must be > 1
-                float new_scale = MAX(mouse_scroll>0.0f? _floating_scale*scroll_speed : _floating_scale/scroll_speed, 1.0f);
+                float new_scale = MAX(mouse_scroll>0.0f? _floating_scale*scroll_speed : _floating_scale/scroll_speed, MIN_SCALE);
+                if (fabsf(new_scale - roundf(new_scale)) < 0.001f) new_scale = roundf(new_scale); // don't let rounding errors skip 1x
 
                 // Zoom to mouse formula: new_pos = focus + (new_scale/old_scale) (focus - old_pos)
                 Vector2 focus = isHoveringMenu? RectangleCenter(drawingBounds) : GetMousePosition();
                 Vector2 focus_offset = Vector2Subtract(focus, image_position);
-                Vector2 scaled_summand = Vector2Scale(focus_offset, (float)((int)new_scale)/(float)((int)_floating_scale)); // poor man's floorf
+                Vector2 scaled_summand = Vector2Scale(focus_offset, effectiveScale(new_scale)/effectiveScale(_floating_scale));
                 image_position = Vector2Subtract(focus, scaled_summand);
 
                 _floating_scale = new_scale;
-                scale = (int)_floating_scale;
+                scale = effectiveScale(_floating_scale);
             }
             // after all moving functions are done:
             // ensure that part of the canvas is still in the draw area.
-            Vector2 image_size = Vector2Scale(canvas_getSize(s->canvas), (int)_floating_scale);
-            if (image_position.x + image_size.x < drawingBounds.x + scale) image_position.x = drawingBounds.x - image_size.x + scale;
-            if (image_position.y + image_size.y < drawingBounds.y + scale) image_position.y = drawingBounds.y - image_size.y + scale;
-            if (drawingBounds.x + drawingBounds.width  < image_position.x + scale) image_position.x = drawingBounds.x + drawingBounds.width - scale;
-            if (drawingBounds.y + drawingBounds.height < image_position.y + scale) image_position.y = drawingBounds.y + drawingBounds.height - scale;
+            Vector2 image_size = Vector2Scale(canvas_getSize(s->canvas), scale);
+            float margin = MAX(scale, 1.0f); // at least one screen pixel of the canvas stays visible
+            if (image_position.x + image_size.x < drawingBounds.x + margin) image_position.x = drawingBounds.x - image_size.x + margin;
+            if (image_position.y + image_size.y < drawingBounds.y + margin) image_position.y = drawingBounds.y - image_size.y + margin;
+            if (drawingBounds.x + drawingBounds.width  < image_position.x + margin) image_position.x = drawingBounds.x + drawingBounds.width - margin;
+            if (drawingBounds.y + drawingBounds.height < image_position.y + margin) image_position.y = drawingBounds.y + drawingBounds.height - margin;
         }
 
-        BeginDrawing();
-        ClearBackground(FAV_COLOR);
+        trace_end("input", phase_start);
 
-        // draw image
+        // only the part of the canvas inside of drawingBounds is uploaded and drawn.
         Vector2 floored_image_position = {(int)image_position.x, (int)image_position.y}; // image_position is not an integer value at this point, which can cause slight distortions when drawing. outright flooring it degrades zoom precision.
-        DrawTextureEx(canvas_nextFrame(s->canvas), floored_image_position, 0, scale, WHITE); // use int scale, so that every pixel of the texture is drawn as the same multiple. This is important for drawing the grid.
+        Rectangle visible = {
+            floorf((drawingBounds.x - floored_image_position.x) / scale), floorf((drawingBounds.y - floored_image_position.y) / scale),
+            drawingBounds.width / scale + 2, drawingBounds.height / scale + 2,
+        };
+        phase_start = trace_begin();
+        int level = view_mipLevel(scale);
+        canvas_frame_t frame = canvas_nextFrame(s->canvas, visible, level);
+        trace_end("canvas_nextFrame", phase_start);
+
+        // keep rendering continuously while input is held down, a text field is active (cursor blinking and key repeat) or a load or save is shown.
+        bool isBusy = isPlayback || s->loader != NULL || s->saver != NULL || GetTime() < s->save_status_until || ms->isEditingFileName || ms->isEditingHexField || ms->isEditingXField || ms->isEditingYField || ms->isDragging
+            || IsMouseButtonDown(MOUSE_BUTTON_LEFT) || IsMouseButtonDown(MOUSE_BUTTON_RIGHT) || IsMouseButtonDown(MOUSE_BUTTON_MIDDLE)
+            || IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_UP) || IsKeyDown(KEY_DOWN);
+        bool hadClick = IsMouseButtonReleased(MOUSE_BUTTON_LEFT) || IsMouseButtonReleased(MOUSE_BUTTON_RIGHT) || IsMouseButtonReleased(MOUSE_BUTTON_MIDDLE);
+        // raygui only updates hover highlights when the menu is drawn.
+        bool isHoveringMenu = CheckCollisionPointRec(GetMousePosition(), s->menu_rect) || CheckCollisionPointRec(GetMousePosition(), s->dragger);
+        bool isFocused = IsWindowFocused(); // regaining focus can mean that the window was covered.
+        bool needsRedraw = forceRedraw || isBusy || hadClick || isResized || GetMouseWheelMove() != 0.0f
+            || isHoveringMenu || wasHoveringMenu || isFocused != wasFocused
+            || canvas_getFrameStats(s->canvas).uploads > 0
+            || floored_image_position.x != drawn_position.x || floored_image_position.y != drawn_position.y || scale != drawn_scale;
+        wasHoveringMenu = isHoveringMenu;
+        wasFocused = isFocused;
+        if (isBusy) DisableEventWaiting();
+        else EnableEventWaiting();
+        isWaitingForEvents = !isBusy;
+        if (!needsRedraw){
+            // keep the previous frame on screen, this blocks until the next input event.
+            phase_start = trace_begin();
+            PollInputEvents();
+            trace_end("wait for input", phase_start);
+            trace_end("frame", frame_start);
+            continue;
+        }
+        forceRedraw = false;
+        drawn_position = floored_image_position;
+        drawn_scale = scale;
 
-        // draw grid
-        const Color GRID_COLOR = DARKGRAY;
-        if(s->showGrid && scale >= 3){
-            for (int i = 1; i < canvas_getSize(s->canvas).x; i++){
-                DrawLineEx((Vector2){floored_image_position.x + i*scale, floored_image_position.y}, (Vector2){floored_image_position.x + i*scale, floored_image_position.y + canvas_getSize(s->canvas).y*scale}, 1, GRID_COLOR);
-            }
-            for (int j = 1; j < canvas_getSize(s->canvas).y; j++){
-                DrawLineEx((Vector2){floored_image_position.x, floored_image_position.y + j*scale}, (Vector2){floored_image_position.x + canvas_getSize(s->canvas).x*scale, floored_image_position.y + j*scale}, 1, GRID_COLOR);
-            }
-            DrawRectangleLines(floored_image_position.x-1, floored_image_position.y-1, canvas_getSize(s->canvas).x*scale+2, canvas_getSize(s->canvas).y*scale+2, GRID_COLOR);
+        phase_start = trace_begin();
+        BeginDrawing();
+        ClearBackground(FAV_COLOR);
+
+        // draw image with grid. Both are drawn in one shader pass, so they are traced as one phase.
+        BeginScissorMode(drawingBounds.x, drawingBounds.y, drawingBounds.width, drawingBounds.height);
+        view_drawCanvas(&view, frame, level, canvas_getSize(s->canvas), floored_image_position, scale, s->showGrid && scale >= 3, DARKGRAY);
+        if (s->loader != NULL){
+            DrawRectangleRec(drawingBounds, Fade(FAV_COLOR, 0.6f));
+            drawLoading(s->loader, drawingBounds, ms->font_size);
         }
+        EndScissorMode();
+        trace_end("draw canvas", phase_start);
 
+        phase_start = trace_begin();
         drawMenu(s, ms);
+        trace_end("drawMenu", phase_start);
+
+        // texture upload counters, to check the cost of canvas modifications.
+        if (s->showFrameStats){
+            canvas_frame_stats_t stats = canvas_getFrameStats(s->canvas);
+            const char *stats_text = TextFormat("uploads: %zu  bytes: %zu", stats.uploads, stats.upload_bytes);
+            int stats_font_size = ms->font_size/2;
+            DrawText(stats_text, GetScreenWidth() - MeasureText(stats_text, stats_font_size) - stats_font_size, GetScreenHeight() - 2*stats_font_size, stats_font_size, WHITE);
+        }
 
+        // includes waiting for the target frame rate
+        phase_start = trace_begin();
         EndDrawing();
+        trace_end("EndDrawing", phase_start);
+        trace_end("frame", frame_start);
+        if (startup_start != 0){
+            startup_end("first frame", startup_start);
+            startup_print();
+            startup_start = 0;
+        }
+        if (isPlayback){
+            double now = GetTime();
+            slowest_frame = MAX(slowest_frame, now - previous_frame);
+            previous_frame = now;
+        }
+    }
+    if (isPlayback){
+        unsigned long frames = replay_getFrame(replay);
+        double total = GetTime() - playback_start;
+        printf("replayed %lu frames in %.2f s (%.2f ms per frame, slowest %.2f ms)\n", frames, total, frames > 0? total*1e3/frames : 0, slowest_frame*1e3);
     }
+    replay_close(replay);
+    loader_cancel(s->loader);
+    updateSave(s, true); // don't lose a save that is still being written
 
     canvas_free(s->canvas);
     unloadMenu(ms);
+    view_unload(&view);
 
     CloseWindow();
 }
@@ -20,7 +20,13 @@
  *  3. This notice may not be removed or altered from any source distribution.
  */
 
+#ifndef DISABLE_THREADS
+    #include <pthread.h>
+#endif
+
 #include "menu.h"
+#include "startup.h"
+#include "trace.h"
 
 #define RAYGUI_IMPLEMENTATION
 #include "external/raygui.h"
@@ -28,8 +34,9 @@
 #include "external/tinyfiledialogs/tinyfiledialogs.h"
 
 #ifndef DISABLE_CUSTOM_FONT
+    #include "external/raylib/src/external/sinfl.h" // compiled into rcore.c
     #include "font.h"
-    #define FONT_LEVELS 3
+    #define FONT_LEVELS BAKED_FONT_LEVELS
 #endif //DISABLE_CUSTOM_FONT
 
 
@@ -93,31 +100,137 @@ static void setMenuStyle() {
     GuiSetStyle(DEFAULT, BACKGROUND_COLOR, 0x181818FF);
 }
 
-static void loadMenuFont(menu_state_t *ms){
+#ifndef DISABLE_CUSTOM_FONT
+struct menu_fonts_t {
+    Image atlases[FONT_LEVELS]; // data is NULL if the atlas could not be decompressed
+    bool has_worker;
+#ifndef DISABLE_THREADS
+    pthread_t worker;
+#endif
+};
+
+// decompresses an atlas that was rasterized at build time (tools/bake_font.c), instead of rasterizing the ttf on every start.
+// needs no GL context, so it can run before the window exists.
+static Image decompressBakedAtlas(const baked_font_t *baked){
+    // sinflate instead of DecompressData, which reserves 64MB for every call.
+    unsigned char *alpha = RL_MALLOC(baked->pixel_count);
+    unsigned short *gray_alpha = RL_MALLOC((size_t)baked->atlas_width*baked->atlas_height*sizeof(*gray_alpha));
+    if (alpha == NULL || gray_alpha == NULL || sinflate(alpha, baked->pixel_count, baked->pixels, baked->compressed_size) != baked->pixel_count){
+        RL_FREE(alpha);
+        RL_FREE(gray_alpha);
+        return (Image){0};
+    }
+    // only the glyphs are stored, the rest of the atlas is transparent white.
+    unsigned char transparent_white[2] = {255, 0};
+    unsigned short background;
+    memcpy(&background, transparent_white, sizeof(background));
+    for (int i = 0; i < baked->atlas_width*baked->atlas_height; i++) gray_alpha[i] = background;
+    const unsigned char *in = alpha;
+    for (int i = 0; i < BAKED_FONT_GLYPH_COUNT; i++){
+        const baked_glyph_t *glyph = &baked->glyphs[i];
+        for (int y = glyph->y; y < glyph->y + glyph->height; y++){
+            unsigned char *out = (unsigned char*)(gray_alpha + y*baked->atlas_width + glyph->x);
+            for (int x = 0; x < glyph->width; x++) out[2*x + 1] = *in++;
+        }
+    }
+    RL_FREE(alpha);
+    return (Image){.data=gray_alpha, .width=baked->atlas_width, .height=baked->atlas_height, .mipmaps=1, .format=PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA};
+}
+
+static void *decompressMenuFonts(void *arg){
+    menu_fonts_t *prepared = arg;
+    uint64_t trace_start = trace_begin();
+    uint64_t startup_start = startup_begin();
+    for (int i = 0; i < FONT_LEVELS; i++) prepared->atlases[i] = decompressBakedAtlas(&BAKED_FONTS[i]);
+    trace_end("prepare fonts", trace_start);
+    startup_end("prepare fonts", startup_start);
+    return NULL;
+}
+
+static void waitForMenuFonts(menu_fonts_t *prepared){
+#ifndef DISABLE_THREADS
+    if (prepared->has_worker) pthread_join(prepared->worker, NULL);
+    prepared->has_worker = false;
+#else
+    (void)prepared;
+#endif
+}
+
+// uploads the atlas, which is the only part of the font that needs the GL context.
+static Font loadBakedFont(const baked_font_t *baked, Image atlas){
+    if (atlas.data == NULL) return GetFontDefault();
+    Font font = {
+        .baseSize = baked->size,
+        .glyphCount = BAKED_FONT_GLYPH_COUNT,
+        .glyphPadding = BAKED_FONT_GLYPH_PADDING,
+        .texture = LoadTextureFromImage(atlas),
+        .recs = RL_MALLOC(BAKED_FONT_GLYPH_COUNT*sizeof(*font.recs)),
+        .glyphs = RL_CALLOC(BAKED_FONT_GLYPH_COUNT, sizeof(*font.glyphs)),
+    };
+    // glyph images are left empty, they are only used by ImageDrawText.
+    for (int i = 0; i < BAKED_FONT_GLYPH_COUNT; i++){
+        const baked_glyph_t *glyph = &baked->glyphs[i];
+        font.recs[i] = (Rectangle){glyph->x, glyph->y, glyph->width, glyph->height};
+        font.glyphs[i] = (GlyphInfo){.value=glyph->value, .offsetX=glyph->offset_x, .offsetY=glyph->offset_y, .advanceX=glyph->advance_x};
+    }
+    return font;
+}
+#endif // DISABLE_CUSTOM_FONT
+
+menu_fonts_t *prepareMenuFonts(void){
+#ifndef DISABLE_CUSTOM_FONT
+    menu_fonts_t *prepared = RL_CALLOC(1, sizeof(*prepared));
+    if (prepared == NULL) return NULL;
+#ifndef DISABLE_THREADS
+    prepared->has_worker = pthread_create(&prepared->worker, NULL, decompressMenuFonts, prepared) == 0;
+    if (!prepared->has_worker) perror("menu: failed to start font worker thread");
+#endif
+    if (!prepared->has_worker) decompressMenuFonts(prepared);
+    return prepared;
+#else
+    return NULL;
+#endif // DISABLE_CUSTOM_FONT
+}
+
+void discardMenuFonts(menu_fonts_t *prepared){
+#ifndef DISABLE_CUSTOM_FONT
+    if (prepared == NULL) return;
+    waitForMenuFonts(prepared);
+    for (int i = 0; i < FONT_LEVELS; i++) UnloadImage(prepared->atlases[i]);
+    RL_FREE(prepared);
+#else
+    (void)prepared;
+#endif // DISABLE_CUSTOM_FONT
+}
+
+static void loadMenuFont(menu_state_t *ms, menu_fonts_t *prepared){
+    uint64_t start = trace_begin();
+    uint64_t startup_start = startup_begin();
     Font font = {0};
     // load custom font
 #ifndef DISABLE_CUSTOM_FONT
-    // The font is compressed and encoded into an array.
-    int ttf_font_data_size = 0;
-    unsigned char *ttf_font_data = DecompressData((unsigned char*)COMPRESSED_TTF_FONT, COMPRESSED_TTF_FONT_SIZE, &ttf_font_data_size);
-
     Font *fonts = RL_MALLOC(FONT_LEVELS * sizeof(*fonts)); // 0.5x, 1.0x and 2.0x font size
-
-    fonts[0] = LoadFontFromMemory(".ttf", ttf_font_data, ttf_font_data_size, 0.5*DEFAULT_FONT_SIZE, NULL, 0);
-    fonts[1] = LoadFontFromMemory(".ttf", ttf_font_data, ttf_font_data_size, 1.0*DEFAULT_FONT_SIZE, NULL, 0);
-    fonts[2] = LoadFontFromMemory(".ttf", ttf_font_data, ttf_font_data_size, 2.0*DEFAULT_FONT_SIZE, NULL, 0);
-    RL_FREE(ttf_font_data);
+    if (prepared != NULL) waitForMenuFonts(prepared);
+    for (int i = 0; i < FONT_LEVELS; i++){
+        Image atlas = prepared != NULL? prepared->atlases[i] : decompressBakedAtlas(&BAKED_FONTS[i]);
+        fonts[i] = loadBakedFont(&BAKED_FONTS[i], atlas);
+        if (prepared == NULL) UnloadImage(atlas);
+    }
+    discardMenuFonts(prepared);
     GuiSetStyle(DEFAULT, TEXT_SPACING, 0);
     font = fonts[1];
     ms->fonts = fonts;
 #else
+    (void)prepared;
     font = GetFontDefault();
 #endif // DISABLE_CUSTOM_FONT
     ms->font = font;
     ms->font_size = DEFAULT_FONT_SIZE;
+    trace_end(__func__, start);
+    startup_end("finish fonts", startup_start);
 }
 
-menu_state_t initMenu(char *image_name){
+menu_state_t initMenu(char *image_name, menu_fonts_t *prepared){
     menu_state_t menu_state = {
         .x_field            = RL_MALLOC(DIM_STRLEN),
         .y_field            = RL_MALLOC(DIM_STRLEN),
@@ -133,7 +246,7 @@ menu_state_t initMenu(char *image_name){
     sprintf(menu_state.filename_old, "%s", image_name);
 
     setMenuStyle();
-    loadMenuFont(&menu_state);
+    loadMenuFont(&menu_state, prepared);
 
     return menu_state;
 }
@@ -304,10 +417,22 @@ void drawMenu(shared_state_t *s, menu_state_t *ms){
         if(canvas_redo(s->canvas)) s->forceImageResize = true;
     }
 
+    // memory used by the undo history, without the image itself
+    const char *history_text = TextFormat("history: %.1f MiB", canvas_getHistorySize(s->canvas) / (float)(1 << 20));
+    if (canvas_getJournalSize(s->canvas) > 0){
+        history_text = TextFormat("history: %.1f + %.1f MiB", canvas_getHistorySize(s->canvas) / (float)(1 << 20), canvas_getJournalSize(s->canvas) / (float)(1 << 20));
+    }
+    DrawTextEx(ms->font, history_text, (Vector2){menu_padding, options_y + (item++)*(huebar_padding+ms->font_size)}, 0.6*ms->font_size, 1, GRAY);
+
     toolToggleButton("pipette", &s->cursor, CURSOR_PIPETTE, 27, options_y + (item++)*(huebar_padding+ms->font_size), menu_padding, menu_content_width, ms->font_size);
 
     toolToggleButton("fill", &s->cursor, CURSOR_COLOR_FILL, 29, options_y + (item++)*(huebar_padding+ms->font_size), menu_padding, menu_content_width, ms->font_size);
 
+    // fill options: replace all pixels of the color & tolerance
+    GuiCheckBox((Rectangle){menu_padding, options_y + item*(huebar_padding+ms->font_size), ms->font_size, ms->font_size}, "all", &s->fillAll);
+    Rectangle tolerance_box = {menu_padding + 0.5*menu_content_width, options_y + (item++)*(huebar_padding+ms->font_size), 0.5*menu_content_width - 1.5*ms->font_size, ms->font_size};
+    GuiSlider(tolerance_box, NULL, TextFormat("%d", (int)s->fillTolerance), &s->fillTolerance, 0, 255);
+
     item++;
     // grid checkbox
     GuiCheckBox((Rectangle){menu_padding, options_y + (item++)*(huebar_padding+ms->font_size), ms->font_size, ms->font_size}, "grid", &s->showGrid);
@@ -358,7 +483,12 @@ void drawMenu(shared_state_t *s, menu_state_t *ms){
     int lower_menu_y = MAX(min_lower_menu_y, desired_lower_menu_y);
 
     Rectangle load_rect = {menu_padding, lower_menu_y, menu_content_width, ms->font_size};
-    if(GuiButton(load_rect, "load")){
+    if (s->loader != NULL){
+        if (GuiButton(load_rect, "cancel loading")){
+            loader_cancel(s->loader);
+            s->loader = NULL;
+        }
+    } else if(GuiButton(load_rect, "load")){
         char * new_file = tinyfd_openFileDialog("load image", ms->filename, 0, NULL, NULL, false);
         if (new_file){
             if (FileExists(new_file)){
@@ -366,14 +496,9 @@ void drawMenu(shared_state_t *s, menu_state_t *ms){
                 // TODO: undo has unwanted implications when overwriting an existing different file.
                 // TODO: new canvas would be cleaner here.
                 // FIXME: add method to swap out the old canvas for a new one or reset it's state
-                Image new_image = LoadImage(new_file);
-                if (IsImageReady(new_image)){
-                    canvas_setToImage(s->canvas, new_image);
-                    s->forceImageResize = true;
-                } else {
-                    printf("Error: failed to load image from '%s'\n", new_file);
-                }
-                UnloadImage(new_image); // free image in both cases
+                // decoded in the background, the main loop hands the image to the canvas when it is ready.
+                s->loader = loader_start(new_file);
+                if (s->loader == NULL) printf("Error: failed to load image from '%s'\n", new_file);
             } else {
                 printf("Error: file '%s' does not exist!\n", new_file);
             }
@@ -409,9 +534,11 @@ void drawMenu(shared_state_t *s, menu_state_t *ms){
     // save button
     int save_button_y = lower_menu_y + 2*lower_menu_item_size;
     Rectangle save_rect = {menu_padding, save_button_y, menu_content_width, ms->font_size};
-    if (CheckCollisionPointRec(GetMousePosition(), save_rect)) DrawTextEx(ms->font, "ctrl+s", (Vector2){s->menu_rect.width, save_rect.y + (save_rect.height - ms->font_size)/2}, ms->font_size, 1, WHITE);
-    if(GuiButton(save_rect, "save")){
-        canvas_saveAsImage(s->canvas, ms->filename);
+    if (CheckCollisionPointRec(GetMousePosition(), save_rect)) DrawTextEx(ms->font, "ctrl+s (+shift: smallest png)", (Vector2){s->menu_rect.width, save_rect.y + (save_rect.height - ms->font_size)/2}, ms->font_size, 1, WHITE);
+    const char *save_text = s->saver != NULL? "saving..." : GetTime() < s->save_status_until? s->save_status : "save";
+    if(GuiButton(save_rect, save_text)){
+        bool isShiftDown = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
+        startSave(s, ms->filename, isShiftDown? PNG_EFFORT_MAX : PNG_EFFORT_FAST);
     }
 }
 
@@ -428,3 +555,31 @@ void unloadMenu(menu_state_t *ms){
         RL_FREE(ms->fonts);
     #endif //DISABLE_CUSTOM_FONT
 }
+
+void startSave(shared_state_t *s, const char *path, png_effort_t effort){
+    updateSave(s, true); // one save at a time, so that the newer snapshot ends up in the file
+    if (canvas_isMappedTo(s->canvas, path)){
+        // only the changed rows of the mapped file are written, which is quicker than taking a snapshot.
+        bool success = canvas_saveAsImage(s->canvas, path, effort);
+        s->save_status = success? "saved" : "save failed";
+        s->save_status_until = GetTime() + (success? 1.5 : 3.0);
+        return;
+    }
+    s->saver = saver_start(canvas_getContent(s->canvas), path, effort); // the copy is cheap compared to encoding
+    if (s->saver == NULL){
+        printf("Error: failed to save image to '%s'\n", path);
+        s->save_status = "save failed";
+        s->save_status_until = GetTime() + 3.0;
+    }
+}
+
+void updateSave(shared_state_t *s, bool wait){
+    if (s->saver == NULL || (!wait && !saver_isFinished(s->saver))) return;
+    char path[MAX_FILENAME_SIZE];
+    snprintf(path, sizeof(path), "%s", saver_getPath(s->saver));
+    bool success = saver_finish(s->saver);
+    s->saver = NULL;
+    if (!success) printf("Error: failed to save image to '%s'\n", path);
+    s->save_status = success? "saved" : "save failed";
+    s->save_status_until = GetTime() + (success? 1.5 : 3.0);
+}
@@ -27,6 +27,8 @@
 
 
 #include "canvas.h"
+#include "loader.h"
+#include "saver.h"
 #include "util.h"
 
 #define FAV_COLOR ((Color){0x18, 0x18, 0x18, 0xFF}) // sorry, but AA is a bit impractical
@@ -46,6 +48,10 @@
 typedef struct shared_state_t{
     color_t active_color;
     canvas_t *canvas;
+    loader_t *loader; // image that is being loaded in the background, NULL if there is none
+    saver_t *saver; // save that is running in the background, NULL if there is none
+    const char *save_status; // result of the last save, shown until save_status_until (GetTime)
+    double save_status_until;
     Rectangle menu_rect;
     enum CURSOR_MODE cursor;
     Rectangle dragger;
@@ -53,6 +59,9 @@ typedef struct shared_state_t{
     bool forceMenuReset;
     bool forceWindowResize;
     bool showGrid;
+    bool showFrameStats;
+    bool fillAll; // fill replaces all pixels of the color, instead of the connected area
+    float fillTolerance; // 0 - 255, allowed difference of each channel for the fill
     bool isUsingMouse;
 }shared_state_t;
 
@@ -72,10 +81,26 @@ typedef struct menu_state_t{
     bool isClick;
 }menu_state_t;
 
-menu_state_t initMenu(char *image_name);
+// font atlases decompressed ahead of initMenu, see prepareMenuFonts.
+typedef struct menu_fonts_t menu_fonts_t;
+
+// starts decompressing the menu fonts on a worker thread. This needs no window, so it can overlap with its creation.
+// returns NULL if there is nothing to prepare (DISABLE_CUSTOM_FONT) or on allocation failure.
+menu_fonts_t *prepareMenuFonts(void);
+// frees prepared fonts that are not going to be passed to initMenu.
+void discardMenuFonts(menu_fonts_t *prepared);
+
+// waits for and uploads the prepared fonts, which are freed. Without them (NULL), the fonts are prepared here.
+menu_state_t initMenu(char *image_name, menu_fonts_t *prepared);
 void drawMenu(shared_state_t *s, menu_state_t *ms);
 void unloadMenu(menu_state_t *ms);
 
+// saves a snapshot of the canvas in the background. Waits for a previous save that is still running.
+// effort only applies to png files: PNG_EFFORT_MAX for final exports, PNG_EFFORT_FAST otherwise.
+void startSave(shared_state_t *s, const char *path, png_effort_t effort);
+// collects the result of a finished save, wait blocks until a running save is done.
+void updateSave(shared_state_t *s, bool wait);
+
 // utils
 #define MIN(a, b) (a<b? (a) : (b))
 #define MAX(a, b) (a>b? (a) : (b))
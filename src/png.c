@@ -0,0 +1,276 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/external/sdefl.h" // compiled into rcore.c
+
+#include "png.h"
+#include "threadpool.h"
+#include "trace.h"
+
+#define PNG_BPP 4 // bytes per pixel of R8G8B8A8
+#define PNG_PART_SIZE (1 << 20) // approximate raw bytes per independently compressed part
+#define PNG_ADLER_MOD 65521
+
+enum {PNG_FILTER_NONE, PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVERAGE, PNG_FILTER_PAETH, PNG_FILTER_COUNT};
+
+typedef struct png_part_t {
+    unsigned char *chunk; // complete IDAT chunk, NULL on failure
+    size_t chunk_size;
+    uint32_t adler; // of the filtered rows
+    size_t raw_size;
+} png_part_t;
+
+typedef struct png_encoder_t {
+    const unsigned char *pixels;
+    int width, height;
+    size_t row_size; // without the filter byte
+    int rows_per_part;
+    int level; // sdefl level
+    int filter_count; // number of filters tried per row, starting from PNG_FILTER_NONE
+    uint32_t crc_table[256];
+    png_part_t *parts;
+} png_encoder_t;
+
+static void png_initCrc(uint32_t *table){
+    for (uint32_t n = 0; n < 256; n++){
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) c = c & 1? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        table[n] = c;
+    }
+}
+
+static uint32_t png_crc(const uint32_t *table, const unsigned char *data, size_t size){
+    uint32_t c = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) c = table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+    return c ^ 0xFFFFFFFFu;
+}
+
+static uint32_t png_adler(const unsigned char *data, size_t size){
+    uint32_t a = 1, b = 0;
+    while (size > 0){
+        size_t block = size < 5552? size : 5552; // largest block that can't overflow b
+        for (size_t i = 0; i < block; i++){
+            a += data[i];
+            b += a;
+        }
+        a %= PNG_ADLER_MOD;
+        b %= PNG_ADLER_MOD;
+        data += block;
+        size -= block;
+    }
+    return b << 16 | a;
+}
+
+// adler32 of the concatenation, given the adler32 of both parts and the size of the second one (see zlib's adler32_combine).
+static uint32_t png_adlerCombine(uint32_t first, uint32_t second, size_t second_size){
+    uint32_t rem = second_size % PNG_ADLER_MOD;
+    uint32_t a = first & 0xFFFF;
+    uint32_t b = (uint32_t)(((uint64_t)rem*a) % PNG_ADLER_MOD);
+    a += (second & 0xFFFF) + PNG_ADLER_MOD - 1;
+    b += (first >> 16) + (second >> 16) + PNG_ADLER_MOD - rem;
+    if (a >= PNG_ADLER_MOD) a -= PNG_ADLER_MOD;
+    if (a >= PNG_ADLER_MOD) a -= PNG_ADLER_MOD;
+    if (b >= 2*PNG_ADLER_MOD) b -= 2*PNG_ADLER_MOD;
+    if (b >= PNG_ADLER_MOD) b -= PNG_ADLER_MOD;
+    return b << 16 | a;
+}
+
+static void png_put32(unsigned char *out, uint32_t value){
+    out[0] = value >> 24;
+    out[1] = value >> 16;
+    out[2] = value >> 8;
+    out[3] = value;
+}
+
+// fills the length, type and crc of a chunk whose data is already at chunk + 8.
+static void png_finishChunk(const uint32_t *crc_table, unsigned char *chunk, const char *type, size_t data_size){
+    png_put32(chunk, data_size);
+    memcpy(chunk + 4, type, 4);
+    png_put32(chunk + 8 + data_size, png_crc(crc_table, chunk + 4, data_size + 4));
+}
+
+static unsigned char png_paeth(int a, int b, int c){
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc? b : c;
+}
+
+// the first pixel has no left neighbour, which the filters treat as 0.
+static void png_filterRow(int filter, unsigned char *out, const unsigned char *row, const unsigned char *prior, size_t size){
+    size_t i = 0;
+    switch (filter){
+        case PNG_FILTER_NONE:
+            memcpy(out, row, size);
+            break;
+        case PNG_FILTER_SUB:
+            for (; i < PNG_BPP; i++) out[i] = row[i];
+            for (; i < size; i++) out[i] = row[i] - row[i - PNG_BPP];
+            break;
+        case PNG_FILTER_UP:
+            for (; i < size; i++) out[i] = row[i] - prior[i];
+            break;
+        case PNG_FILTER_AVERAGE:
+            for (; i < PNG_BPP; i++) out[i] = row[i] - prior[i] / 2;
+            for (; i < size; i++) out[i] = row[i] - (row[i - PNG_BPP] + prior[i]) / 2;
+            break;
+        case PNG_FILTER_PAETH:
+            for (; i < PNG_BPP; i++) out[i] = row[i] - prior[i];
+            for (; i < size; i++) out[i] = row[i] - png_paeth(row[i - PNG_BPP], prior[i], prior[i - PNG_BPP]);
+            break;
+    }
+}
+
+// minimum sum of absolute differences, treating the filtered bytes as signed.
+static unsigned long png_filterCost(const unsigned char *filtered, size_t size){
+    unsigned long cost = 0;
+    for (size_t i = 0; i < size; i++) cost += filtered[i] < 128? filtered[i] : 256 - filtered[i];
+    return cost;
+}
+
+// filter and deflate the rows of one part into its own IDAT chunk.
+static void png_encodePart(void *data, int index){
+    png_encoder_t *encoder = data;
+    png_part_t *part = &encoder->parts[index];
+    int first_row = index*encoder->rows_per_part;
+    int rows = encoder->height - first_row < encoder->rows_per_part? encoder->height - first_row : encoder->rows_per_part;
+    size_t row_size = encoder->row_size;
+    part->raw_size = (size_t)rows*(row_size + 1);
+
+    unsigned char *raw = malloc(part->raw_size);
+    unsigned char *candidate = malloc(row_size);
+    unsigned char *zero_row = calloc(row_size, 1);
+    struct sdefl *deflate = calloc(1, sizeof(*deflate)); // sdefl expects zeroed frequencies
+    int bound = sdefl_bound(part->raw_size) + 5;
+    part->chunk = malloc(8 + bound + 4);
+    if (raw == NULL || candidate == NULL || zero_row == NULL || deflate == NULL || part->chunk == NULL){
+        free(part->chunk);
+        part->chunk = NULL;
+        goto cleanup;
+    }
+
+    for (int y = 0; y < rows; y++){
+        const unsigned char *row = encoder->pixels + (size_t)(first_row + y)*row_size;
+        const unsigned char *prior = first_row + y > 0? row - row_size : zero_row;
+        unsigned char *out = raw + (size_t)y*(row_size + 1);
+        unsigned long best_cost = 0;
+        for (int filter = 0; filter < encoder->filter_count; filter++){
+            png_filterRow(filter, candidate, row, prior, row_size);
+            unsigned long cost = png_filterCost(candidate, row_size);
+            if (filter == 0 || cost < best_cost){
+                best_cost = cost;
+                out[0] = filter;
+                memcpy(out + 1, candidate, row_size);
+            }
+            if (best_cost == 0) break; // no filter can do better
+        }
+    }
+    part->adler = png_adler(raw, part->raw_size);
+    bool last = first_row + rows == encoder->height;
+    int compressed = sdeflate_part(deflate, part->chunk + 8, raw, part->raw_size, encoder->level, last);
+    part->chunk_size = 8 + compressed + 4;
+    png_finishChunk(encoder->crc_table, part->chunk, "IDAT", compressed);
+
+cleanup:
+    free(deflate);
+    free(zero_row);
+    free(candidate);
+    free(raw);
+}
+
+unsigned char *png_encode(Image image, png_effort_t effort, int threads, size_t *size){
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || image.data == NULL || image.width <= 0 || image.height <= 0) return NULL;
+    uint64_t start = trace_begin();
+
+    png_encoder_t encoder = {
+        .pixels = image.data,
+        .width = image.width,
+        .height = image.height,
+        .row_size = (size_t)image.width*PNG_BPP,
+        // level 1 skips inserting matched bytes into the hash chains, which costs more size than the time it saves.
+        // SDEFL_LVL_MAX follows hash chains of up to 8192 entries, which made gradients 6x slower than level 7, with 256.
+        .level = effort == PNG_EFFORT_MAX? SDEFL_LVL_MAX - 1 : 2,
+        // sub and up catch most of the gain, average and paeth mostly help photos.
+        .filter_count = effort == PNG_EFFORT_MAX? PNG_FILTER_COUNT : PNG_FILTER_UP + 1,
+    };
+    png_initCrc(encoder.crc_table);
+    encoder.rows_per_part = PNG_PART_SIZE / (encoder.row_size + 1);
+    if (encoder.rows_per_part < 1) encoder.rows_per_part = 1;
+    int part_count = (image.height + encoder.rows_per_part - 1) / encoder.rows_per_part;
+    encoder.parts = calloc(part_count, sizeof(*encoder.parts));
+    if (encoder.parts == NULL) return NULL;
+
+    threadpool_t *pool = part_count > 1? threadpool_new(threads) : NULL;
+    threadpool_run(pool, png_encodePart, &encoder, part_count);
+    threadpool_free(pool);
+
+    static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    unsigned char header[12 + 13], stream_header[12 + 2], stream_trailer[12 + 4], end[12];
+    png_put32(header + 8, image.width);
+    png_put32(header + 12, image.height);
+    header[16] = 8; // bit depth
+    header[17] = 6; // RGBA
+    header[18] = header[19] = header[20] = 0; // deflate, adaptive filters, no interlacing
+    png_finishChunk(encoder.crc_table, header, "IHDR", 13);
+    // zlib header: deflate with 32k window, check bits make it a multiple of 31
+    stream_header[8] = 0x78;
+    stream_header[9] = effort == PNG_EFFORT_MAX? 0xDA : 0x01;
+    png_finishChunk(encoder.crc_table, stream_header, "IDAT", 2);
+    png_finishChunk(encoder.crc_table, end, "IEND", 0);
+
+    size_t total = sizeof(signature) + sizeof(header) + sizeof(stream_header) + sizeof(stream_trailer) + sizeof(end);
+    uint32_t adler = 1;
+    bool failed = false;
+    for (int i = 0; i < part_count; i++){
+        png_part_t *part = &encoder.parts[i];
+        if (part->chunk == NULL){
+            failed = true;
+            continue;
+        }
+        total += part->chunk_size;
+        adler = i == 0? part->adler : png_adlerCombine(adler, part->adler, part->raw_size);
+    }
+    png_put32(stream_trailer + 8, adler);
+    png_finishChunk(encoder.crc_table, stream_trailer, "IDAT", 4);
+
+    unsigned char *file = failed? NULL : malloc(total);
+    if (file != NULL){
+        unsigned char *out = file;
+        memcpy(out, signature, sizeof(signature)); out += sizeof(signature);
+        memcpy(out, header, sizeof(header)); out += sizeof(header);
+        memcpy(out, stream_header, sizeof(stream_header)); out += sizeof(stream_header);
+        for (int i = 0; i < part_count; i++){
+            memcpy(out, encoder.parts[i].chunk, encoder.parts[i].chunk_size);
+            out += encoder.parts[i].chunk_size;
+        }
+        memcpy(out, stream_trailer, sizeof(stream_trailer)); out += sizeof(stream_trailer);
+        memcpy(out, end, sizeof(end));
+        *size = total;
+    }
+    for (int i = 0; i < part_count; i++) free(encoder.parts[i].chunk);
+    free(encoder.parts);
+    trace_end(__func__, start);
+    return file;
+}
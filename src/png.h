@@ -0,0 +1,41 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+#ifndef __PNG_H
+#define __PNG_H
+
+#include <stddef.h>
+
+#include "external/raylib/src/raylib.h"
+
+// PNG encoder that filters and deflates independent parts of the image in parallel, in the style of pigz.
+// Every row gets the filter with the smallest sum of absolute differences, like libpng's heuristic.
+
+typedef enum png_effort_t {
+    PNG_EFFORT_FAST, // quick saves, where time matters more than size
+    PNG_EFFORT_MAX, // final exports
+} png_effort_t;
+
+// returns a complete png file in a malloc'ed buffer, or NULL on failure. Only R8G8B8A8 images are supported.
+// threads <= 0 uses one thread per core.
+unsigned char *png_encode(Image image, png_effort_t effort, int threads, size_t *size);
+
+#endif // __PNG_H
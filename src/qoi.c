@@ -0,0 +1,374 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "qoi.h"
+
+// SSE2 is part of every x86_64 cpu, so unlike the fill kernels it needs no check at runtime.
+#if defined(__SSE2__)
+    #define QOI_HAS_SSE2
+    #include <emmintrin.h>
+#endif
+
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF  0x40
+#define QOI_OP_LUMA  0x80
+#define QOI_OP_RUN   0xc0
+#define QOI_OP_RGB   0xfe
+#define QOI_OP_RGBA  0xff
+#define QOI_MASK_2   0xc0
+
+#define QOI_HEADER_SIZE 14
+#define QOI_MAX_RUN 62
+#define QOI_MAX_CHUNK 5 // QOI_OP_RGBA
+#define QOI_PIXELS_MAX 400000000 // same limit as the reference implementation, keeps the pixel memory far from overflowing
+#define QOI_STREAM_PIXELS (1 << 16) // pixels encoded between writes of qoi_saveFile
+#define QOI_READ_SIZE (1 << 20) // bytes read at once by qoi_loadFile
+static const unsigned char QOI_PADDING[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+
+#define QOI_HASH(c) (((c).r*3 + (c).g*5 + (c).b*7 + (c).a*11) % 64)
+
+static void write_u32(unsigned char *bytes, unsigned int value){
+    bytes[0] = value >> 24;
+    bytes[1] = value >> 16;
+    bytes[2] = value >> 8;
+    bytes[3] = value;
+}
+
+static unsigned int read_u32(const unsigned char *bytes){
+    return (unsigned int)bytes[0] << 24 | (unsigned int)bytes[1] << 16 | (unsigned int)bytes[2] << 8 | bytes[3];
+}
+
+static inline uint32_t color_bits(Color color){
+    uint32_t bits;
+    memcpy(&bits, &color, sizeof(bits));
+    return bits;
+}
+
+static void qoi_streamInit(qoi_stream_t *stream){
+    *stream = (qoi_stream_t){.px = {0, 0, 0, 255}};
+}
+
+static void qoi_writeHeader(unsigned char *bytes, int width, int height){
+    memcpy(bytes, "qoif", 4);
+    write_u32(bytes + 4, width);
+    write_u32(bytes + 8, height);
+    bytes[12] = 4; // channels
+    bytes[13] = 0; // sRGB with linear alpha
+}
+
+// the channel count only tells what the image was made from, the chunks are the same either way.
+static bool qoi_readHeader(const unsigned char *bytes, int *width, int *height){
+    if (memcmp(bytes, "qoif", 4) != 0) return false;
+    unsigned int w = read_u32(bytes + 4), h = read_u32(bytes + 8);
+    if (w == 0 || h == 0 || h > QOI_PIXELS_MAX / w) return false;
+    *width = w;
+    *height = h;
+    return true;
+}
+
+// number of pixels from the start that equal color.
+static size_t qoi_runLength(const Color *pixels, size_t count, Color color){
+    const uint32_t *bits = (const uint32_t*)pixels;
+    uint32_t target = color_bits(color);
+    size_t n = 0;
+#ifdef QOI_HAS_SSE2
+    const __m128i t = _mm_set1_epi32(target);
+    for (; n + 4 <= count; n += 4){
+        __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(bits + n)), t);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(equal));
+        if (mask != 0xF) return n + __builtin_ctz(~mask);
+    }
+#endif
+    while (n < count && bits[n] == target) n++;
+    return n;
+}
+
+static void qoi_fill(Color *pixels, size_t count, Color color){
+    uint32_t *bits = (uint32_t*)pixels;
+    uint32_t value = color_bits(color);
+    size_t n = 0;
+#ifdef QOI_HAS_SSE2
+    const __m128i v = _mm_set1_epi32(value);
+    for (; n + 4 <= count; n += 4) _mm_storeu_si128((__m128i*)(bits + n), v);
+#endif
+    for (; n < count; n++) bits[n] = value;
+}
+
+// encodes count pixels into bytes, which must hold QOI_MAX_CHUNK*count + 1 bytes.
+// a run at the end is kept in the stream, so that it can continue in the next pixels, unless last is set.
+// returns the number of written bytes.
+static size_t qoi_encodeChunks(qoi_stream_t *stream, const Color *pixels, size_t count, bool last, unsigned char *bytes){
+    size_t p = 0;
+    Color prev = stream->px;
+    size_t run = stream->run;
+    size_t i = 0;
+    while (i < count){
+        Color px = pixels[i];
+        if (color_bits(px) == color_bits(prev)){
+            // pixel art has long runs, skip them a vector at a time.
+            size_t same = qoi_runLength(pixels + i, count - i, prev);
+            run += same;
+            i += same;
+            for (; run >= QOI_MAX_RUN; run -= QOI_MAX_RUN) bytes[p++] = QOI_OP_RUN | (QOI_MAX_RUN - 1);
+            continue;
+        }
+        if (run > 0){
+            bytes[p++] = QOI_OP_RUN | (run - 1);
+            run = 0;
+        }
+        int hash = QOI_HASH(px);
+        if (color_bits(stream->index[hash]) == color_bits(px)){
+            bytes[p++] = QOI_OP_INDEX | hash;
+        } else {
+            stream->index[hash] = px;
+            if (px.a == prev.a){
+                signed char vr = px.r - prev.r;
+                signed char vg = px.g - prev.g;
+                signed char vb = px.b - prev.b;
+                signed char vg_r = vr - vg;
+                signed char vg_b = vb - vg;
+                if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2){
+                    bytes[p++] = QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2);
+                } else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8){
+                    bytes[p++] = QOI_OP_LUMA | (vg + 32);
+                    bytes[p++] = (vg_r + 8) << 4 | (vg_b + 8);
+                } else {
+                    bytes[p++] = QOI_OP_RGB;
+                    bytes[p++] = px.r;
+                    bytes[p++] = px.g;
+                    bytes[p++] = px.b;
+                }
+            } else {
+                bytes[p++] = QOI_OP_RGBA;
+                bytes[p++] = px.r;
+                bytes[p++] = px.g;
+                bytes[p++] = px.b;
+                bytes[p++] = px.a;
+            }
+        }
+        prev = px;
+        i++;
+    }
+    if (last && run > 0){
+        bytes[p++] = QOI_OP_RUN | (run - 1);
+        run = 0;
+    }
+    stream->px = prev;
+    stream->run = run;
+    return p;
+}
+
+static size_t qoi_chunkSize(unsigned char b1){
+    if (b1 == QOI_OP_RGBA) return 5;
+    if (b1 == QOI_OP_RGB) return 4;
+    return (b1 & QOI_MASK_2) == QOI_OP_LUMA? 2 : 1;
+}
+
+// decodes up to count pixels, stopping early at a chunk that is cut off by the end of bytes.
+// returns the number of decoded pixels and adds the consumed bytes to used.
+static size_t qoi_decodeChunks(qoi_stream_t *stream, const unsigned char *bytes, size_t size, size_t *used, Color *pixels, size_t count){
+    size_t p = 0;
+    size_t i = 0;
+    Color px = stream->px;
+    while (i < count){
+        if (stream->run > 0){
+            size_t n = (size_t)stream->run < count - i? (size_t)stream->run : count - i;
+            qoi_fill(pixels + i, n, px);
+            stream->run -= n;
+            i += n;
+            continue;
+        }
+        if (p >= size || size - p < qoi_chunkSize(bytes[p])) break;
+        int b1 = bytes[p++];
+        if (b1 == QOI_OP_RGB){
+            px.r = bytes[p++];
+            px.g = bytes[p++];
+            px.b = bytes[p++];
+        } else if (b1 == QOI_OP_RGBA){
+            px.r = bytes[p++];
+            px.g = bytes[p++];
+            px.b = bytes[p++];
+            px.a = bytes[p++];
+        } else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX){
+            px = stream->index[b1];
+        } else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF){
+            px.r += ((b1 >> 4) & 0x03) - 2;
+            px.g += ((b1 >> 2) & 0x03) - 2;
+            px.b += ( b1       & 0x03) - 2;
+        } else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA){
+            int b2 = bytes[p++];
+            int vg = (b1 & 0x3f) - 32;
+            px.r += vg - 8 + ((b2 >> 4) & 0x0f);
+            px.g += vg;
+            px.b += vg - 8 +  (b2       & 0x0f);
+        } else if ((b1 & QOI_MASK_2) == QOI_OP_RUN){
+            stream->run = (b1 & 0x3f) + 1; // filled at the top of the loop
+        }
+        stream->index[QOI_HASH(px)] = px;
+        if (stream->run == 0) pixels[i++] = px;
+    }
+    stream->px = px;
+    *used += p;
+    return i;
+}
+
+unsigned char *qoi_encodePixels(const Color *pixels, int width, int height, size_t *size){
+    if (width <= 0 || height <= 0) return NULL;
+    size_t pixel_count = (size_t)width*height;
+    unsigned char *bytes = malloc(QOI_HEADER_SIZE + pixel_count*QOI_MAX_CHUNK + 1 + sizeof(QOI_PADDING)); // worst case: every pixel as QOI_OP_RGBA
+    if (bytes == NULL) return NULL;
+
+    qoi_writeHeader(bytes, width, height);
+    qoi_stream_t stream;
+    qoi_streamInit(&stream);
+    size_t p = QOI_HEADER_SIZE;
+    p += qoi_encodeChunks(&stream, pixels, pixel_count, true, bytes + p);
+    memcpy(bytes + p, QOI_PADDING, sizeof(QOI_PADDING));
+    p += sizeof(QOI_PADDING);
+
+    *size = p;
+    return realloc(bytes, p); // shrink to the actual size
+}
+
+bool qoi_decodePixels(const unsigned char *data, size_t size, Color *pixels, int width, int height){
+    int file_width, file_height;
+    if (size < QOI_HEADER_SIZE + sizeof(QOI_PADDING) || !qoi_readHeader(data, &file_width, &file_height)) return false;
+    if (file_width != width || file_height != height) return false;
+
+    size_t pixel_count = (size_t)width*height;
+    size_t used = QOI_HEADER_SIZE;
+    qoi_stream_t stream;
+    qoi_streamInit(&stream);
+    return qoi_decodeChunks(&stream, data + used, size - used, &used, pixels, pixel_count) == pixel_count;
+}
+
+bool qoi_saveFile(const Color *pixels, int width, int height, const char *path){
+    if (width <= 0 || height <= 0) return false;
+    unsigned char *bytes = malloc(QOI_STREAM_PIXELS*QOI_MAX_CHUNK + 1);
+    FILE *file = bytes != NULL? fopen(path, "wb") : NULL;
+    if (file == NULL){
+        free(bytes);
+        return false;
+    }
+    qoi_writeHeader(bytes, width, height);
+    bool success = fwrite(bytes, 1, QOI_HEADER_SIZE, file) == QOI_HEADER_SIZE;
+
+    qoi_stream_t stream;
+    qoi_streamInit(&stream);
+    size_t pixel_count = (size_t)width*height;
+    for (size_t i = 0; success && i < pixel_count; i += QOI_STREAM_PIXELS){
+        size_t count = pixel_count - i < QOI_STREAM_PIXELS? pixel_count - i : QOI_STREAM_PIXELS;
+        size_t size = qoi_encodeChunks(&stream, pixels + i, count, i + count == pixel_count, bytes);
+        success = fwrite(bytes, 1, size, file) == size;
+    }
+    success = success && fwrite(QOI_PADDING, 1, sizeof(QOI_PADDING), file) == sizeof(QOI_PADDING);
+    if (fclose(file) != 0) success = false;
+    free(bytes);
+    return success;
+}
+
+Image qoi_loadFile(const char *path){
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return (Image){0};
+    unsigned char *bytes = malloc(QOI_READ_SIZE);
+    qoi_reader_t reader;
+    qoi_readerInit(&reader);
+    size_t size;
+    while (bytes != NULL && (size = fread(bytes, 1, QOI_READ_SIZE, file)) > 0){
+        if (!qoi_readerFeed(&reader, bytes, size)) break;
+    }
+    free(bytes);
+    fclose(file);
+    return qoi_readerFinish(&reader);
+}
+
+// -- reader
+
+static size_t qoi_readerPixelCount(const qoi_reader_t *reader){
+    return (size_t)reader->image.width*reader->image.height;
+}
+
+static bool qoi_readerIsComplete(const qoi_reader_t *reader){
+    return reader->image.data != NULL && reader->decoded == qoi_readerPixelCount(reader);
+}
+
+// consumes the header and the complete chunks at the start of bytes, returns the number of consumed bytes.
+static size_t qoi_readerDecode(qoi_reader_t *reader, const unsigned char *bytes, size_t size){
+    size_t used = 0;
+    if (reader->image.data == NULL){
+        if (size < QOI_HEADER_SIZE) return 0;
+        int width, height;
+        Color *pixels = NULL;
+        if (!qoi_readHeader(bytes, &width, &height) || (pixels = malloc((size_t)width*height*sizeof(*pixels))) == NULL){
+            reader->failed = true;
+            return 0;
+        }
+        reader->image = (Image){.data=pixels, .width=width, .height=height, .mipmaps=1, .format=PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        used = QOI_HEADER_SIZE;
+    }
+    Color *pixels = reader->image.data;
+    reader->decoded += qoi_decodeChunks(&reader->stream, bytes + used, size - used, &used, pixels + reader->decoded, qoi_readerPixelCount(reader) - reader->decoded);
+    return used;
+}
+
+void qoi_readerInit(qoi_reader_t *reader){
+    *reader = (qoi_reader_t){0};
+    qoi_streamInit(&reader->stream);
+}
+
+bool qoi_readerFeed(qoi_reader_t *reader, const unsigned char *data, size_t size){
+    // complete a chunk that was cut off, it is only a few bytes long.
+    while (reader->carry_size > 0 && size > 0 && !reader->failed && !qoi_readerIsComplete(reader)){
+        reader->carry[reader->carry_size++] = *data++;
+        size--;
+        size_t used = qoi_readerDecode(reader, reader->carry, reader->carry_size);
+        reader->carry_size -= used;
+        memmove(reader->carry, reader->carry + used, reader->carry_size);
+    }
+    if (reader->failed) return false;
+    if (qoi_readerIsComplete(reader)) return true; // the rest is padding
+    if (reader->carry_size > 0) return true; // data ran out while completing the chunk
+
+    size_t used = qoi_readerDecode(reader, data, size);
+    if (reader->failed) return false;
+    if (!qoi_readerIsComplete(reader)){
+        // less than a header or a chunk is left
+        reader->carry_size = size - used;
+        memcpy(reader->carry, data + used, reader->carry_size);
+    }
+    return true;
+}
+
+Image qoi_readerFinish(qoi_reader_t *reader){
+    Image image = reader->image;
+    if (reader->failed || !qoi_readerIsComplete(reader)){
+        free(image.data);
+        image = (Image){0};
+    }
+    qoi_readerInit(reader);
+    return image;
+}
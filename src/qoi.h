@@ -0,0 +1,70 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+#ifndef __QOI_H
+#define __QOI_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "external/raylib/src/raylib.h"
+
+// Streaming QOI codec (https://qoiformat.org) for image files.
+// raylib's qoi_encode and qoi_decode need the whole file and the whole image in memory at once.
+// Here files are encoded and decoded in slices, with the codec state kept in qoi_stream_t between them,
+// so that a large image never exists twice in memory. Runs are found by comparing several pixels at once.
+
+// in-memory versions of the same codec, e.g. to compare it with raylib's.
+// returns a complete qoi file in a malloc'ed buffer, or NULL on failure.
+unsigned char *qoi_encodePixels(const Color *pixels, int width, int height, size_t *size);
+// pixels must hold width*height colors. Fails if the data does not describe an image of exactly that size.
+bool qoi_decodePixels(const unsigned char *data, size_t size, Color *pixels, int width, int height);
+
+// writes the pixels to path while encoding them, without building the whole file in memory first.
+bool qoi_saveFile(const Color *pixels, int width, int height, const char *path);
+// returns an empty image on failure.
+Image qoi_loadFile(const char *path);
+
+// state between chunks, which may be cut off anywhere.
+typedef struct qoi_stream_t {
+    Color index[64];
+    Color px; // previous pixel
+    int run; // remaining pixels of the current run
+} qoi_stream_t;
+
+// decodes a file that arrives in parts, straight into the pixels of the resulting image.
+// all fields are readonly
+typedef struct qoi_reader_t {
+    qoi_stream_t stream;
+    Image image; // allocated once the header has been read
+    size_t decoded; // pixels
+    unsigned char carry[14]; // start of the header or of a chunk, that was cut off at the end of the previous part
+    size_t carry_size;
+    bool failed;
+} qoi_reader_t;
+
+void qoi_readerInit(qoi_reader_t *reader);
+// decode the next part of the file. Returns false once the data turned out to be invalid.
+bool qoi_readerFeed(qoi_reader_t *reader, const unsigned char *data, size_t size);
+// resets the reader and returns the decoded image, or an empty image if the file was incomplete or invalid.
+Image qoi_readerFinish(qoi_reader_t *reader);
+
+#endif // __QOI_H
@@ -0,0 +1,209 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rawfile.h"
+
+#if !defined(_WIN32) && !defined(PLATFORM_WASM)
+    #define RAWFILE_HAS_MMAP
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#define RAWFILE_BPP 4 // bytes per pixel of R8G8B8A8
+
+// changed pixels [x0, x1) of a row, empty if x1 <= x0.
+typedef struct span_t {
+    int x0, x1;
+} span_t;
+
+struct rawfile_t {
+    char *path;
+    int fd;
+    Image image; // data is the mapping
+    size_t size; // of the file and the mapping
+    bool copy_on_write;
+    span_t *modified; // one per row, since the last save
+    int first_modified, last_modified; // range of rows with modifications, first > last if there are none
+};
+
+bool rawfile_parseSize(const char *path, size_t file_size, int *width, int *height){
+    if (file_size == 0 || file_size % RAWFILE_BPP != 0) return false;
+    size_t pixels = file_size / RAWFILE_BPP;
+    // not GetFileNameWithoutExt, which returns a static buffer and this may run on the loader thread.
+    const char *suffix = strrchr(path, '_');
+    int w, h;
+    char end;
+    if (suffix != NULL && strpbrk(suffix, "/\\") == NULL && sscanf(suffix + 1, "%dx%d%c", &w, &h, &end) == 3 && end == '.'
+            && w > 0 && h > 0 && (size_t)w*h == pixels){
+        *width = w;
+        *height = h;
+        return true;
+    }
+    size_t side = sqrt((double)pixels);
+    while (side*side < pixels) side++; // rounding errors of sqrt
+    if (side*side != pixels || side > INT_MAX) return false;
+    *width = *height = side;
+    return true;
+}
+
+void rawfile_markModified(rawfile_t *raw, int x0, int y0, int x1, int y1){
+    x0 = x0 < 0? 0 : x0;
+    y0 = y0 < 0? 0 : y0;
+    x1 = x1 > raw->image.width? raw->image.width : x1;
+    y1 = y1 > raw->image.height? raw->image.height : y1;
+    if (x1 <= x0) return;
+    for (int y = y0; y < y1; y++){
+        span_t *span = &raw->modified[y];
+        if (span->x1 <= span->x0){
+            *span = (span_t){x0, x1};
+        } else {
+            if (x0 < span->x0) span->x0 = x0;
+            if (x1 > span->x1) span->x1 = x1;
+        }
+    }
+    if (y0 < raw->first_modified) raw->first_modified = y0;
+    if (y1 - 1 > raw->last_modified) raw->last_modified = y1 - 1;
+}
+
+inline Image rawfile_getImage(const rawfile_t *raw){
+    return raw->image;
+}
+
+inline const char *rawfile_getPath(const rawfile_t *raw){
+    return raw->path;
+}
+
+#ifdef RAWFILE_HAS_MMAP
+
+static void rawfile_clearModified(rawfile_t *raw){
+    for (int y = raw->first_modified; y <= raw->last_modified; y++) raw->modified[y] = (span_t){0};
+    raw->first_modified = raw->image.height;
+    raw->last_modified = -1;
+}
+
+rawfile_t *rawfile_open(const char *path, bool copy_on_write){
+    // a private mapping can be made of a read-only file, but saving it needs write access.
+    int fd = open(path, O_RDWR);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0){
+        perror("[RAWFILE] ERROR: unable to open raw file");
+        if (fd >= 0) close(fd);
+        return NULL;
+    }
+    int width, height;
+    if (!rawfile_parseSize(path, info.st_size, &width, &height)){
+        printf("[RAWFILE] ERROR: unable to tell the image size of '%s', name it like 'image_<width>x<height>.raw'\n", path);
+        close(fd);
+        return NULL;
+    }
+    void *data = mmap(NULL, info.st_size, PROT_READ | PROT_WRITE, copy_on_write? MAP_PRIVATE : MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED){
+        perror("[RAWFILE] ERROR: unable to map raw file");
+        close(fd);
+        return NULL;
+    }
+    rawfile_t *raw = calloc(1, sizeof(*raw));
+    span_t *modified = calloc(height, sizeof(*modified));
+    char *path_copy = strdup(path);
+    if (raw == NULL || modified == NULL || path_copy == NULL){
+        munmap(data, info.st_size);
+        close(fd);
+        free(raw);
+        free(modified);
+        free(path_copy);
+        return NULL;
+    }
+    *raw = (rawfile_t){
+        .path = path_copy,
+        .fd = fd,
+        .image = {.data=data, .width=width, .height=height, .mipmaps=1, .format=PIXELFORMAT_UNCOMPRESSED_R8G8B8A8},
+        .size = info.st_size,
+        .copy_on_write = copy_on_write,
+        .modified = modified,
+        .first_modified = height,
+        .last_modified = -1,
+    };
+    return raw;
+}
+
+void rawfile_close(rawfile_t *raw){
+    if (raw == NULL) return;
+    munmap(raw->image.data, raw->size);
+    close(raw->fd);
+    free(raw->modified);
+    free(raw->path);
+    free(raw);
+}
+
+bool rawfile_save(rawfile_t *raw){
+    size_t stride = (size_t)raw->image.width*RAWFILE_BPP;
+    const unsigned char *data = raw->image.data;
+    bool success = true;
+    if (raw->copy_on_write){
+        for (int y = raw->first_modified; y <= raw->last_modified && success; y++){
+            span_t span = raw->modified[y];
+            if (span.x1 <= span.x0) continue;
+            size_t offset = y*stride + (size_t)span.x0*RAWFILE_BPP, size = (size_t)(span.x1 - span.x0)*RAWFILE_BPP;
+            success = pwrite(raw->fd, data + offset, size, offset) == (ssize_t)size;
+        }
+    } else if (raw->first_modified <= raw->last_modified){
+        // the changes are in the file already, they only have to reach the disk.
+        size_t page = sysconf(_SC_PAGESIZE);
+        size_t start = raw->first_modified*stride + (size_t)raw->modified[raw->first_modified].x0*RAWFILE_BPP;
+        size_t end = raw->last_modified*stride + (size_t)raw->modified[raw->last_modified].x1*RAWFILE_BPP;
+        start -= start % page;
+        success = msync((unsigned char*)raw->image.data + start, end - start, MS_SYNC) == 0;
+    }
+    if (!success){
+        perror("[RAWFILE] ERROR: unable to save raw file");
+        return false;
+    }
+    rawfile_clearModified(raw);
+    return true;
+}
+
+#else // RAWFILE_HAS_MMAP
+
+rawfile_t *rawfile_open(const char *path, bool copy_on_write){
+    (void)path;
+    (void)copy_on_write;
+    return NULL;
+}
+
+void rawfile_close(rawfile_t *raw){
+    (void)raw;
+}
+
+bool rawfile_save(rawfile_t *raw){
+    (void)raw;
+    return false;
+}
+
+#endif // RAWFILE_HAS_MMAP
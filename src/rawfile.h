@@ -0,0 +1,55 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __RAWFILE_H
+#define __RAWFILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "external/raylib/src/raylib.h"
+
+// Memory-mapped .raw (R8G8B8A8, no header) image file, whose pixels can be edited in place.
+// The image size is taken from a "_<width>x<height>" suffix of the file name, e.g. "frame_1920x1080.raw".
+// Without one, the image is assumed to be square.
+
+typedef struct rawfile_t rawfile_t;
+
+// finds the size of a raw image from its path and file size. Returns false if neither fits.
+bool rawfile_parseSize(const char *path, size_t file_size, int *width, int *height);
+
+// copy_on_write maps the file privately: changes stay in memory until rawfile_save writes them.
+// otherwise changes go straight to the file, and rawfile_save only waits until they reached the disk.
+// returns NULL if the file can not be mapped (or memory mapping is not supported on the platform).
+rawfile_t *rawfile_open(const char *path, bool copy_on_write);
+void rawfile_close(rawfile_t *raw);
+
+// the pixels live in the mapping. They stay valid until rawfile_close, do not unload the image.
+Image rawfile_getImage(const rawfile_t *raw);
+const char *rawfile_getPath(const rawfile_t *raw);
+
+// remember the changed pixels [x0, x1) x [y0, y1) for the next save.
+void rawfile_markModified(rawfile_t *raw, int x0, int y0, int x1, int y1);
+// writes only the changed parts of the rows since the last save.
+bool rawfile_save(rawfile_t *raw);
+
+#endif // __RAWFILE_H
@@ -0,0 +1,308 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/raylib.h"
+
+#include "replay.h"
+
+// file layout, all numbers little endian:
+//   header: "IMFR", u8 version, u16 window width, u16 window height
+//   events: u8 type, frames since the previous event as LEB128, then the payload of the type.
+//   the last event is REPLAY_END, at the frame after the last recorded frame.
+#define REPLAY_MAGIC "IMFR"
+#define REPLAY_VERSION 2
+
+#define REPLAY_KEYS 512 // MAX_KEYBOARD_KEYS of raylib
+#define REPLAY_KEY_QUEUE 16 // MAX_KEY_PRESSED_QUEUE of raylib
+#define REPLAY_WHEEL_SCALE 256 // wheel moves are stored in 1/256 steps
+#define REPLAY_BUTTONS (MOUSE_BUTTON_BACK + 1)
+
+typedef enum REPLAY_EVENT {
+    REPLAY_END,
+    REPLAY_KEY_DOWN,    // u16 key
+    REPLAY_KEY_UP,      // u16 key
+    REPLAY_BUTTON_DOWN, // u8 button
+    REPLAY_BUTTON_UP,   // u8 button
+    REPLAY_MOUSE_MOVE,  // i16 x, i16 y
+    REPLAY_WHEEL,       // i16 x move, i16 y move, in 1/REPLAY_WHEEL_SCALE steps
+    REPLAY_WINDOW_SIZE, // u16 width, u16 height
+} REPLAY_EVENT;
+
+typedef struct replay_event_t {
+    REPLAY_EVENT type;
+    unsigned long frame;
+    int a, b;
+} replay_event_t;
+
+struct replay_t {
+    FILE *file;
+    bool playback;
+    unsigned long frame;
+    unsigned long event_frame; // frame of the last written or read event
+    // recording: input state of the previous frame
+    bool keys[REPLAY_KEYS];
+    bool buttons[REPLAY_BUTTONS];
+    int mouse_x, mouse_y;
+    int width, height;
+    // playback: the next event, read ahead
+    replay_event_t next;
+};
+
+// -- encoding
+
+static void writeU8(FILE *file, int value){
+    fputc(value & 0xff, file);
+}
+
+static void writeU16(FILE *file, int value){
+    writeU8(file, value);
+    writeU8(file, value >> 8);
+}
+
+static void writeVarint(FILE *file, unsigned long value){
+    do {
+        writeU8(file, (value & 0x7f) | (value >= 0x80? 0x80 : 0));
+        value >>= 7;
+    } while (value > 0);
+}
+
+static void replay_write(replay_t *replay, REPLAY_EVENT type, int a, int b){
+    writeU8(replay->file, type);
+    writeVarint(replay->file, replay->frame - replay->event_frame);
+    replay->event_frame = replay->frame;
+    switch (type){
+        case REPLAY_KEY_DOWN: // fallthrough
+        case REPLAY_KEY_UP: writeU16(replay->file, a); break;
+        case REPLAY_BUTTON_DOWN: // fallthrough
+        case REPLAY_BUTTON_UP: writeU8(replay->file, a); break;
+        case REPLAY_WHEEL: // fallthrough
+        case REPLAY_MOUSE_MOVE: // fallthrough
+        case REPLAY_WINDOW_SIZE: writeU16(replay->file, a); writeU16(replay->file, b); break;
+        case REPLAY_END: break;
+    }
+}
+
+// -- decoding, a truncated file reads as zeros and ends with an invalid event.
+
+static int readU8(FILE *file){
+    int value = fgetc(file);
+    return value == EOF? 0 : value;
+}
+
+static int readU16(FILE *file){
+    int low = readU8(file);
+    return low | readU8(file) << 8;
+}
+
+static int readI16(FILE *file){
+    return (int16_t)readU16(file);
+}
+
+static unsigned long readVarint(FILE *file){
+    unsigned long value = 0;
+    for (int shift = 0; shift < 32; shift += 7){
+        int byte = readU8(file);
+        value |= (unsigned long)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) break;
+    }
+    return value;
+}
+
+// returns false at the end of the recording or on a broken file.
+static bool replay_read(replay_t *replay){
+    int type = fgetc(replay->file);
+    if (type == EOF || type > REPLAY_WINDOW_SIZE){
+        printf("Error: replay file ends without an end marker\n");
+        replay->next = (replay_event_t){.type=REPLAY_END, .frame=replay->frame};
+        return false;
+    }
+    replay_event_t event = {.type=type, .frame=replay->event_frame + readVarint(replay->file)};
+    switch (event.type){
+        case REPLAY_KEY_DOWN: // fallthrough
+        case REPLAY_KEY_UP: event.a = readU16(replay->file); break;
+        case REPLAY_BUTTON_DOWN: // fallthrough
+        case REPLAY_BUTTON_UP: event.a = readU8(replay->file); break;
+        case REPLAY_WHEEL: // fallthrough
+        case REPLAY_MOUSE_MOVE: event.a = readI16(replay->file); event.b = readI16(replay->file); break;
+        case REPLAY_WINDOW_SIZE: event.a = readU16(replay->file); event.b = readU16(replay->file); break;
+        case REPLAY_END: break;
+    }
+    bool invalid_key = (event.type == REPLAY_KEY_DOWN || event.type == REPLAY_KEY_UP) && event.a >= REPLAY_KEYS;
+    bool invalid_button = (event.type == REPLAY_BUTTON_DOWN || event.type == REPLAY_BUTTON_UP) && event.a >= REPLAY_BUTTONS;
+    if (invalid_key || invalid_button){
+        printf("Error: invalid event in replay file\n");
+        event = (replay_event_t){.type=REPLAY_END, .frame=replay->frame};
+    }
+    replay->event_frame = event.frame;
+    replay->next = event;
+    return event.type != REPLAY_END;
+}
+
+// feed the event into raylib, as if it was polled from the window.
+static void replay_play(replay_event_t event){
+    switch (event.type){
+        case REPLAY_KEY_DOWN: PlayAutomationEvent((AutomationEvent){.type=INPUT_KEY_DOWN, .params={event.a}}); break;
+        case REPLAY_KEY_UP: PlayAutomationEvent((AutomationEvent){.type=INPUT_KEY_UP, .params={event.a}}); break;
+        case REPLAY_BUTTON_DOWN: PlayAutomationEvent((AutomationEvent){.type=INPUT_MOUSE_BUTTON_DOWN, .params={event.a}}); break;
+        case REPLAY_BUTTON_UP: PlayAutomationEvent((AutomationEvent){.type=INPUT_MOUSE_BUTTON_UP, .params={event.a}}); break;
+        case REPLAY_MOUSE_MOVE: PlayAutomationEvent((AutomationEvent){.type=INPUT_MOUSE_POSITION, .params={event.a, event.b}}); break;
+        case REPLAY_WHEEL: PlayAutomationEvent((AutomationEvent){.type=INPUT_MOUSE_WHEEL_MOTION, .params={event.a, event.b, REPLAY_WHEEL_SCALE}}); break;
+        case REPLAY_WINDOW_SIZE: SetWindowSize(event.a, event.b); break;
+        case REPLAY_END: break;
+    }
+}
+
+// -- public functions
+
+replay_t *replay_startRecording(const char *path){
+    replay_t *replay = calloc(1, sizeof(*replay));
+    if (replay == NULL) return NULL;
+    replay->file = fopen(path, "wb");
+    if (replay->file == NULL){
+        perror("Error while opening replay file");
+        free(replay);
+        return NULL;
+    }
+    replay->width = GetScreenWidth();
+    replay->height = GetScreenHeight();
+    replay->mouse_x = -1;
+    replay->mouse_y = -1;
+    fwrite(REPLAY_MAGIC, 1, 4, replay->file);
+    writeU8(replay->file, REPLAY_VERSION);
+    writeU16(replay->file, replay->width);
+    writeU16(replay->file, replay->height);
+    return replay;
+}
+
+replay_t *replay_startPlayback(const char *path){
+    replay_t *replay = calloc(1, sizeof(*replay));
+    if (replay == NULL) return NULL;
+    replay->playback = true;
+    replay->file = fopen(path, "rb");
+    if (replay->file == NULL){
+        perror("Error while opening replay file");
+        free(replay);
+        return NULL;
+    }
+    char magic[4] = {0};
+    if (fread(magic, 1, 4, replay->file) != 4 || memcmp(magic, REPLAY_MAGIC, 4) != 0 || readU8(replay->file) != REPLAY_VERSION){
+        printf("Error: '%s' is not a replay file of this version\n", path);
+        replay_close(replay);
+        return NULL;
+    }
+    replay->width = readU16(replay->file);
+    replay->height = readU16(replay->file);
+    SetWindowSize(replay->width, replay->height);
+    replay_read(replay);
+    return replay;
+}
+
+void replay_close(replay_t *replay){
+    if (replay == NULL) return;
+    if (!replay->playback){
+        replay_write(replay, REPLAY_END, 0, 0);
+        if (ferror(replay->file)) perror("Error while writing replay file");
+    }
+    fclose(replay->file);
+    free(replay);
+}
+
+inline bool replay_isPlayback(const replay_t *replay){
+    return replay->playback;
+}
+
+inline unsigned long replay_getFrame(const replay_t *replay){
+    return replay->frame;
+}
+
+// writes a key event and plays it right away, so the main loop sees the same key state and queue as during playback.
+static void replay_recordKey(replay_t *replay, REPLAY_EVENT type, int key){
+    replay_write(replay, type, key, 0);
+    replay_play((replay_event_t){.type=type, .a=key});
+    replay->keys[key] = type == REPLAY_KEY_DOWN;
+}
+
+static int replay_wheelFixed(float move){
+    float fixed = roundf(move*REPLAY_WHEEL_SCALE);
+    return fixed < INT16_MIN? INT16_MIN : fixed > INT16_MAX? INT16_MAX : (int)fixed;
+}
+
+static void replay_record(replay_t *replay){
+    // presses are taken from raylib's key queue, so that a key pressed and released between two frames is not lost.
+    // the queue is drained here and filled again by replaying the recorded edges.
+    bool down[REPLAY_KEYS];
+    for (int key = 1; key < REPLAY_KEYS; key++) down[key] = IsKeyDown(key);
+    int pressed[REPLAY_KEY_QUEUE];
+    int pressed_count = 0;
+    for (int key; pressed_count < REPLAY_KEY_QUEUE && (key = GetKeyPressed()) != 0;) pressed[pressed_count++] = key;
+    for (int i = 0; i < pressed_count; i++){
+        int key = pressed[i];
+        if (key >= REPLAY_KEYS) continue;
+        if (replay->keys[key]) replay_recordKey(replay, REPLAY_KEY_UP, key); // released and pressed again since the last frame
+        replay_recordKey(replay, REPLAY_KEY_DOWN, key);
+    }
+    // releases, including those of keys pressed and released within this frame, and keys missing from the queue
+    for (int key = 1; key < REPLAY_KEYS; key++){
+        if (down[key] != replay->keys[key]) replay_recordKey(replay, down[key]? REPLAY_KEY_DOWN : REPLAY_KEY_UP, key);
+    }
+    for (int button = 0; button < REPLAY_BUTTONS; button++){
+        bool down = IsMouseButtonDown(button);
+        if (down != replay->buttons[button]) replay_write(replay, down? REPLAY_BUTTON_DOWN : REPLAY_BUTTON_UP, button, 0);
+        replay->buttons[button] = down;
+    }
+    Vector2 mouse = GetMousePosition();
+    if ((int)mouse.x != replay->mouse_x || (int)mouse.y != replay->mouse_y){
+        replay->mouse_x = mouse.x;
+        replay->mouse_y = mouse.y;
+        replay_write(replay, REPLAY_MOUSE_MOVE, replay->mouse_x, replay->mouse_y);
+    }
+    Vector2 wheel = GetMouseWheelMoveV();
+    int wheel_x = replay_wheelFixed(wheel.x);
+    int wheel_y = replay_wheelFixed(wheel.y);
+    if (wheel_x != 0 || wheel_y != 0) replay_write(replay, REPLAY_WHEEL, wheel_x, wheel_y);
+    if (GetScreenWidth() != replay->width || GetScreenHeight() != replay->height){
+        replay->width = GetScreenWidth();
+        replay->height = GetScreenHeight();
+        replay_write(replay, REPLAY_WINDOW_SIZE, replay->width, replay->height);
+    }
+}
+
+bool replay_nextFrame(replay_t *replay){
+    if (!replay->playback){
+        replay_record(replay);
+        replay->frame++;
+        return true;
+    }
+    while (replay->next.type != REPLAY_END && replay->next.frame <= replay->frame){
+        replay_play(replay->next);
+        replay_read(replay);
+    }
+    if (replay->next.type == REPLAY_END && replay->next.frame <= replay->frame) return false;
+    replay->frame++;
+    return true;
+}
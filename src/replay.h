@@ -0,0 +1,53 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __REPLAY_H
+#define __REPLAY_H
+
+#include <stdbool.h>
+
+// Records the input of every frame to a compact binary file, and plays it back through raylib's input state,
+// so the main loop and the menu see the same events again.
+// Recorded are key and mouse button changes, mouse movement, wheel moves and window resizes.
+// Key presses are taken from raylib's key queue, so short presses between two frames are kept. Text typed into the menu fields is not reproduced.
+// During playback the real mouse and keyboard should not be used.
+
+// frame time used in place of GetFrameTime() during playback, so that time dependent movement is reproducible.
+#define REPLAY_FRAME_TIME (1.0f/60.0f)
+
+typedef struct replay_t replay_t;
+
+// the window has to be open. Returns NULL on failure.
+replay_t *replay_startRecording(const char *path);
+// resizes the window to the recorded size. Returns NULL on failure.
+replay_t *replay_startPlayback(const char *path);
+// finishes the recording and frees the replay.
+void replay_close(replay_t *replay);
+
+bool replay_isPlayback(const replay_t *replay);
+// call once per frame, before any input is read. Records the input of this frame or plays back the recorded events.
+// returns false once the playback reached the end of the recording.
+bool replay_nextFrame(replay_t *replay);
+// number of frames recorded or played back so far
+unsigned long replay_getFrame(const replay_t *replay);
+
+#endif // __REPLAY_H
@@ -0,0 +1,95 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef DISABLE_THREADS
+    #include <pthread.h>
+#endif
+
+#include "saver.h"
+#include "trace.h"
+#include "util.h"
+
+struct saver_t {
+    char *path;
+    Image snapshot;
+    png_effort_t effort;
+    bool success;
+    atomic_bool finished; // success is valid once this is set
+#ifndef DISABLE_THREADS
+    pthread_t worker;
+#endif
+};
+
+static void *saver_run(void *arg){
+    saver_t *saver = arg;
+    uint64_t trace_start = trace_begin();
+    saver->success = exportImageSafely(saver->snapshot, saver->path, saver->effort);
+    trace_end("save image", trace_start);
+    UnloadImage(saver->snapshot);
+    atomic_store(&saver->finished, true);
+    return NULL;
+}
+
+saver_t *saver_start(Image snapshot, const char *path, png_effort_t effort){
+    saver_t *saver = calloc(1, sizeof(*saver));
+    if (saver == NULL || (saver->path = strdup(path)) == NULL){
+        free(saver);
+        UnloadImage(snapshot);
+        return NULL;
+    }
+    saver->snapshot = snapshot;
+    saver->effort = effort;
+#ifndef DISABLE_THREADS
+    if (pthread_create(&saver->worker, NULL, saver_run, saver) != 0){
+        perror("saver: failed to start worker thread");
+        UnloadImage(snapshot);
+        free(saver->path);
+        free(saver);
+        return NULL;
+    }
+#else
+    saver_run(saver);
+#endif
+    return saver;
+}
+
+bool saver_isFinished(saver_t *saver){
+    return atomic_load(&saver->finished);
+}
+
+inline const char *saver_getPath(const saver_t *saver){
+    return saver->path;
+}
+
+bool saver_finish(saver_t *saver){
+#ifndef DISABLE_THREADS
+    pthread_join(saver->worker, NULL);
+#endif
+    bool success = saver->success;
+    free(saver->path);
+    free(saver);
+    return success;
+}
@@ -0,0 +1,46 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+#ifndef __SAVER_H
+#define __SAVER_H
+
+#include <stdbool.h>
+
+#include "external/raylib/src/raylib.h"
+
+#include "png.h"
+
+// Encodes and writes an image on a worker thread, so that painting can continue during a save.
+// Built without threads (DISABLE_THREADS), the image is saved inside of saver_start.
+
+typedef struct saver_t saver_t;
+
+// takes ownership of snapshot, which must not change while saving (see canvas_getContent).
+// returns NULL if the worker could not be started, the snapshot is freed in that case.
+saver_t *saver_start(Image snapshot, const char *path, png_effort_t effort);
+
+bool saver_isFinished(saver_t *saver);
+const char *saver_getPath(const saver_t *saver);
+
+// waits until the image is written and frees the saver. Returns true if the save succeeded.
+bool saver_finish(saver_t *saver);
+
+#endif // __SAVER_H
@@ -0,0 +1,96 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "startup.h"
+#include "trace.h"
+
+typedef struct startup_phase_t {
+    const char *name;
+    uint64_t start, end;
+    atomic_bool written;
+} startup_phase_t;
+
+static struct {
+    atomic_bool enabled;
+    _Atomic int count;
+    uint64_t origin;
+    startup_phase_t phases[STARTUP_MAX_PHASES];
+} startup;
+
+void startup_enable(void){
+    startup.origin = trace_now();
+    atomic_store(&startup.enabled, true);
+}
+
+uint64_t startup_begin(void){
+    return atomic_load_explicit(&startup.enabled, memory_order_relaxed)? trace_now() : 0;
+}
+
+void startup_end(const char *name, uint64_t start){
+    if (start == 0 || !atomic_load_explicit(&startup.enabled, memory_order_relaxed)) return;
+    uint64_t end = trace_now();
+    int index = atomic_fetch_add(&startup.count, 1);
+    if (index >= STARTUP_MAX_PHASES) return;
+    startup_phase_t *phase = &startup.phases[index];
+    phase->name = name;
+    phase->start = start;
+    phase->end = end;
+    atomic_store_explicit(&phase->written, true, memory_order_release);
+}
+
+static int startup_compare(const void *a, const void *b){
+    const startup_phase_t *phase_a = a, *phase_b = b;
+    return (phase_a->start > phase_b->start) - (phase_a->start < phase_b->start);
+}
+
+void startup_print(void){
+    if (!atomic_exchange(&startup.enabled, false)) return;
+    int count = atomic_load(&startup.count);
+    if (count > STARTUP_MAX_PHASES) count = STARTUP_MAX_PHASES;
+    // copied, so that a late worker can't change a phase while it is printed.
+    startup_phase_t phases[STARTUP_MAX_PHASES];
+    int written = 0;
+    for (int i = 0; i < count; i++){
+        startup_phase_t *phase = &startup.phases[i];
+        if (!atomic_load_explicit(&phase->written, memory_order_acquire)) continue;
+        phases[written].name = phase->name;
+        phases[written].start = phase->start;
+        phases[written].end = phase->end;
+        written++;
+    }
+    qsort(phases, written, sizeof(*phases), startup_compare);
+
+    uint64_t last = startup.origin;
+    printf("startup times (ms):\n");
+    printf("  %-20s %9s %9s %9s\n", "phase", "start", "end", "duration");
+    for (int i = 0; i < written; i++){
+        printf("  %-20s %9.2f %9.2f %9.2f\n", phases[i].name,
+            (phases[i].start - startup.origin) / 1e6, (phases[i].end - startup.origin) / 1e6, (phases[i].end - phases[i].start) / 1e6);
+        if (phases[i].end > last) last = phases[i].end;
+    }
+    printf("  %-20s %29.2f\n", "total", (last - startup.origin) / 1e6);
+}
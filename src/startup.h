@@ -0,0 +1,49 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __STARTUP_H
+#define __STARTUP_H
+
+#include <stdint.h>
+
+// Breakdown of the time until the first frame, printed with --startup-times.
+// Image decoding and font preparation run on worker threads while the window is created,
+// so each phase keeps its own start and end instead of only a duration.
+//
+//     uint64_t start = startup_begin();
+//     ...
+//     startup_end("phase", start);
+
+#define STARTUP_MAX_PHASES 16
+
+// start recording. Times are relative to this call.
+void startup_enable(void);
+
+// timestamp in nanoseconds, or 0 while recording is disabled.
+uint64_t startup_begin(void);
+// record a phase from start until now. name must stay valid until startup_print.
+void startup_end(const char *name, uint64_t start);
+
+// prints the phases in the order they started and stops recording. Phases that are still running are left out.
+void startup_print(void);
+
+#endif // __STARTUP_H
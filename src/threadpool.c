@@ -0,0 +1,168 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "threadpool.h"
+
+#ifndef DISABLE_THREADS
+    #include <pthread.h>
+    #ifdef _WIN32
+        #include <windows.h>
+    #else
+        #include <unistd.h>
+    #endif
+#endif
+
+struct threadpool_t {
+    int size; // including the thread calling threadpool_run
+#ifndef DISABLE_THREADS
+    pthread_t *workers;
+    int worker_count;
+    pthread_mutex_t lock;
+    pthread_cond_t wake; // a new batch was started, or the pool is shut down
+    pthread_cond_t done; // all jobs of the batch finished
+    // current batch, guarded by lock
+    threadpool_job_t job;
+    void *data;
+    int count; // number of jobs
+    int next; // next job to hand out
+    int finished;
+    unsigned long batch; // incremented for every batch, so that workers notice new work
+    bool quit;
+#endif
+};
+
+#ifndef DISABLE_THREADS
+
+static int threadpool_coreCount(void){
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0? cores : 1;
+#endif
+}
+
+// take jobs of the current batch until none are left. Called with the lock held.
+static void threadpool_work(threadpool_t *pool){
+    while (pool->next < pool->count){
+        int index = pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+        pool->job(pool->data, index);
+        pthread_mutex_lock(&pool->lock);
+        if (++pool->finished == pool->count) pthread_cond_signal(&pool->done);
+    }
+}
+
+static void *threadpool_worker(void *arg){
+    threadpool_t *pool = arg;
+    unsigned long seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for(;;){
+        while (!pool->quit && pool->batch == seen) pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->quit) break;
+        seen = pool->batch;
+        threadpool_work(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+threadpool_t *threadpool_new(int threads){
+    threadpool_t *pool = calloc(1, sizeof(*pool));
+    if (threads <= 0) threads = threadpool_coreCount();
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->workers = calloc(threads, sizeof(*pool->workers));
+    // the calling thread is the first one.
+    for (int i = 1; i < threads; i++){
+        if (pthread_create(&pool->workers[pool->worker_count], NULL, threadpool_worker, pool) != 0){
+            perror("[THREADS] WARNING: unable to start worker thread");
+            break;
+        }
+        pool->worker_count++;
+    }
+    pool->size = pool->worker_count + 1;
+    return pool;
+}
+
+void threadpool_free(threadpool_t *pool){
+    if (pool == NULL) return;
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->worker_count; i++) pthread_join(pool->workers[i], NULL);
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
+
+void threadpool_run(threadpool_t *pool, threadpool_job_t job, void *data, int count){
+    if (pool == NULL || pool->size == 1 || count == 1){
+        for (int i = 0; i < count; i++) job(data, i);
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    pool->data = data;
+    pool->count = count;
+    pool->next = 0;
+    pool->finished = 0;
+    pool->batch++;
+    pthread_cond_broadcast(&pool->wake);
+    threadpool_work(pool);
+    while (pool->finished < pool->count) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+#else
+
+threadpool_t *threadpool_new(int threads){
+    (void)threads;
+    threadpool_t *pool = calloc(1, sizeof(*pool));
+    pool->size = 1;
+    return pool;
+}
+
+void threadpool_free(threadpool_t *pool){
+    free(pool);
+}
+
+void threadpool_run(threadpool_t *pool, threadpool_job_t job, void *data, int count){
+    (void)pool;
+    for (int i = 0; i < count; i++) job(data, i);
+}
+
+#endif // DISABLE_THREADS
+
+int threadpool_size(const threadpool_t *pool){
+    return pool != NULL? pool->size : 1;
+}
@@ -0,0 +1,43 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __THREADPOOL_H
+#define __THREADPOOL_H
+
+// Fixed set of worker threads for splitting a computation into independent jobs.
+// Built without threads (DISABLE_THREADS), all jobs run on the calling thread.
+
+typedef struct threadpool_t threadpool_t;
+
+typedef void (*threadpool_job_t)(void *data, int index);
+
+// threads <= 0 uses one thread per core.
+threadpool_t *threadpool_new(int threads);
+void threadpool_free(threadpool_t *pool);
+
+// number of threads working on a batch, including the calling thread. 1 for a NULL pool.
+int threadpool_size(const threadpool_t *pool);
+// call job(data, index) for every index in [0, count) and wait until all are done.
+// the calling thread takes part in the work. A NULL pool runs all jobs on the calling thread.
+void threadpool_run(threadpool_t *pool, threadpool_job_t job, void *data, int count);
+
+#endif // __THREADPOOL_H
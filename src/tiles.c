@@ -0,0 +1,274 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "external/raylib/src/external/qoi.h" // implemented in raylib
+
+#include "tiles.h"
+
+static size_t tile_rawSize(const tile_t *tile){
+    return (size_t)tile->width*tile->height*sizeof(*tile->pixels);
+}
+
+// qoi encoding with raylib's codec, in a buffer of exactly the encoded size.
+static unsigned char *tile_pack(const tile_t *tile, size_t *size){
+    qoi_desc desc = {.width=tile->width, .height=tile->height, .channels=4, .colorspace=QOI_SRGB};
+    int length = 0;
+    unsigned char *packed = qoi_encode(tile->pixels, &desc, &length);
+    if (packed == NULL) return NULL;
+    *size = length;
+    unsigned char *shrunk = realloc(packed, length); // qoi_encode allocates for the worst case
+    return shrunk != NULL? shrunk : packed;
+}
+
+size_t tile_getMemory(const tile_t *tile){
+    return sizeof(*tile) + (tile->pixels != NULL? tile_rawSize(tile) : tile->packed_size);
+}
+
+static tile_t *tile_new(tile_pool_t *pool, int width, int height){
+    tile_t *tile = calloc(1, sizeof(*tile));
+    tile->refs = 1;
+    tile->width = width;
+    tile->height = height;
+    tile->pixels = malloc(tile_rawSize(tile));
+    pool->tiles++;
+    pool->bytes += tile_getMemory(tile);
+    return tile;
+}
+
+tile_t *tile_ref(tile_t *tile){
+    if (tile != NULL) tile->refs++;
+    return tile;
+}
+
+void tile_unref(tile_pool_t *pool, tile_t *tile){
+    if (tile == NULL || --tile->refs > 0) return;
+    pool->tiles--;
+    pool->bytes -= tile_getMemory(tile);
+    free(tile->pixels);
+    free(tile->packed);
+    free(tile);
+}
+
+void tile_compress(tile_pool_t *pool, tile_t *tile){
+    if (tile->pixels == NULL) return;
+    size_t packed_size = 0;
+    unsigned char *packed = tile_pack(tile, &packed_size);
+    if (packed == NULL || packed_size >= tile_rawSize(tile)){
+        free(packed); // not worth it
+        return;
+    }
+    pool->bytes -= tile_getMemory(tile);
+    free(tile->pixels);
+    tile->pixels = NULL;
+    tile->packed = packed;
+    tile->packed_size = packed_size;
+    pool->bytes += tile_getMemory(tile);
+}
+
+const unsigned char *tile_getPacked(const tile_t *tile, size_t *size, bool *owned){
+    *owned = tile->packed == NULL;
+    if (!*owned){
+        *size = tile->packed_size;
+        return tile->packed;
+    }
+    return tile_pack(tile, size);
+}
+
+tile_t *tile_fromPacked(tile_pool_t *pool, int width, int height, const unsigned char *packed, size_t size){
+    tile_t *tile = calloc(1, sizeof(*tile));
+    tile->refs = 1;
+    tile->width = width;
+    tile->height = height;
+    tile->packed = malloc(size);
+    memcpy(tile->packed, packed, size);
+    tile->packed_size = size;
+    pool->tiles++;
+    pool->bytes += tile_getMemory(tile);
+    return tile;
+}
+
+bool tile_decompress(tile_pool_t *pool, tile_t *tile){
+    if (tile->pixels != NULL) return true;
+    qoi_desc desc = {0};
+    Color *pixels = qoi_decode(tile->packed, tile->packed_size, &desc, 4); // NULL if out of memory or corrupted
+    if (pixels == NULL || desc.width != (unsigned int)tile->width || desc.height != (unsigned int)tile->height){
+        printf("[TILES] ERROR: unable to decompress tile\n");
+        free(pixels);
+        return false;
+    }
+    pool->bytes -= tile_getMemory(tile);
+    free(tile->packed);
+    tile->packed = NULL;
+    tile->packed_size = 0;
+    tile->pixels = pixels;
+    pool->bytes += tile_getMemory(tile);
+    return true;
+}
+
+// compare or copy the pixels covered by a tile, with top left corner at (x, y) in the image.
+static bool tile_equalsImage(const tile_t *tile, Image image, int x, int y){
+    const Color *pixels = (const Color*)image.data;
+    for (int row = 0; row < tile->height; row++){
+        if (memcmp(tile->pixels + row*tile->width, pixels + (size_t)(y + row)*image.width + x, tile->width*sizeof(Color)) != 0) return false;
+    }
+    return true;
+}
+
+static void tile_readImage(tile_t *tile, Image image, int x, int y){
+    const Color *pixels = (const Color*)image.data;
+    tile->journal_seq = 0; // the copy in the journal is outdated
+    for (int row = 0; row < tile->height; row++){
+        memcpy(tile->pixels + row*tile->width, pixels + (size_t)(y + row)*image.width + x, tile->width*sizeof(Color));
+    }
+}
+
+tilemap_t tilemap_new(int width, int height){
+    tilemap_t map = {
+        .width = width,
+        .height = height,
+        .columns = (width + TILE_SIZE - 1) / TILE_SIZE,
+        .rows = (height + TILE_SIZE - 1) / TILE_SIZE,
+    };
+    map.tiles = calloc((size_t)map.columns*map.rows, sizeof(*map.tiles));
+    return map;
+}
+
+inline size_t tilemap_count(const tilemap_t *map){
+    return (size_t)map->columns*map->rows;
+}
+
+bool tilemap_decompress(tile_pool_t *pool, const tilemap_t *map){
+    for (size_t i = 0; i < tilemap_count(map); i++){
+        if (map->tiles[i] != NULL && !tile_decompress(pool, map->tiles[i])) return false;
+    }
+    return true;
+}
+
+size_t tilemap_memory(const tilemap_t *map){
+    size_t bytes = 0;
+    for (size_t i = 0; i < tilemap_count(map); i++){
+        if (map->tiles[i] != NULL) bytes += tile_getMemory(map->tiles[i]);
+    }
+    return bytes;
+}
+
+tile_t *tilemap_tileAt(const tilemap_t *map, int column, int row){
+    if (column < 0 || row < 0 || column >= map->columns || row >= map->rows) return NULL;
+    return map->tiles[(size_t)row*map->columns + column];
+}
+
+Rectangle tilemap_tileRect(const tilemap_t *map, size_t idx){
+    int x = (idx % map->columns) * TILE_SIZE;
+    int y = (idx / map->columns) * TILE_SIZE;
+    int width = x + TILE_SIZE > map->width? map->width - x : TILE_SIZE;
+    int height = y + TILE_SIZE > map->height? map->height - y : TILE_SIZE;
+    return (Rectangle){map->x + x, map->y + y, width, height};
+}
+
+inline bool tilemap_sameSize(const tilemap_t *a, const tilemap_t *b){
+    return a->width == b->width && a->height == b->height;
+}
+
+tilemap_t tilemap_fromImage(tile_pool_t *pool, Image image, const tilemap_t *base){
+    tilemap_t map = tilemap_new(image.width, image.height);
+    for (int row = 0; row < map.rows; row++){
+        for (int column = 0; column < map.columns; column++){
+            size_t idx = (size_t)row*map.columns + column;
+            Rectangle rect = tilemap_tileRect(&map, idx);
+            // tiles at the same position can be shared, even if the image size changed.
+            tile_t *candidate = base != NULL? tilemap_tileAt(base, column, row) : NULL;
+            if (candidate != NULL && candidate->width == rect.width && candidate->height == rect.height
+                && tile_equalsImage(candidate, image, rect.x, rect.y)){
+                map.tiles[idx] = tile_ref(candidate);
+            } else {
+                map.tiles[idx] = tile_new(pool, rect.width, rect.height);
+                tile_readImage(map.tiles[idx], image, rect.x, rect.y);
+            }
+        }
+    }
+    return map;
+}
+
+tilemap_t tilemap_copy(const tilemap_t *map){
+    tilemap_t copy = tilemap_new(map->width, map->height);
+    copy.x = map->x;
+    copy.y = map->y;
+    for (size_t i = 0; i < tilemap_count(map); i++){
+        copy.tiles[i] = tile_ref(map->tiles[i]);
+    }
+    return copy;
+}
+
+tilemap_t tilemap_region(const tilemap_t *map, int column, int row, int columns, int rows){
+    int x = column*TILE_SIZE, y = row*TILE_SIZE;
+    int width = (column + columns)*TILE_SIZE > map->width? map->width - x : columns*TILE_SIZE;
+    int height = (row + rows)*TILE_SIZE > map->height? map->height - y : rows*TILE_SIZE;
+    tilemap_t region = tilemap_new(width, height);
+    region.x = map->x + x;
+    region.y = map->y + y;
+    for (int r = 0; r < rows; r++){
+        for (int c = 0; c < columns; c++){
+            region.tiles[(size_t)r*columns + c] = tile_ref(tilemap_tileAt(map, column + c, row + r));
+        }
+    }
+    return region;
+}
+
+void tilemap_free(tile_pool_t *pool, tilemap_t *map){
+    if (map->tiles == NULL) return;
+    for (size_t i = 0; i < tilemap_count(map); i++){
+        tile_unref(pool, map->tiles[i]);
+    }
+    free(map->tiles);
+    *map = (tilemap_t){0};
+}
+
+void tilemap_updateTile(tile_pool_t *pool, tilemap_t *map, size_t idx, Image image){
+    Rectangle rect = tilemap_tileRect(map, idx);
+    tile_t *tile = map->tiles[idx];
+    if (tile == NULL){
+        map->tiles[idx] = tile = tile_new(pool, rect.width, rect.height);
+    } else if (tile_equalsImage(tile, image, rect.x, rect.y)) return;
+    if (tile->refs > 1){
+        // copy on write: the old version is still in use, e.g. by the undo history.
+        tile_unref(pool, tile);
+        tile_compress(pool, tile);
+        tile = tile_new(pool, rect.width, rect.height);
+        map->tiles[idx] = tile;
+    }
+    tile_readImage(tile, image, rect.x, rect.y);
+}
+
+bool tilemap_drawTile(tile_pool_t *pool, const tilemap_t *map, size_t idx, Image *image){
+    Rectangle rect = tilemap_tileRect(map, idx);
+    tile_t *tile = map->tiles[idx];
+    if (!tile_decompress(pool, tile)) return false;
+    Color *pixels = (Color*)image->data;
+    for (int row = 0; row < tile->height; row++){
+        memcpy(pixels + (size_t)(rect.y + row)*image->width + (int)rect.x, tile->pixels + row*tile->width, tile->width*sizeof(Color));
+    }
+    return true;
+}
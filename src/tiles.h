@@ -0,0 +1,103 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __TILES_H
+#define __TILES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "external/raylib/src/raylib.h"
+
+// Pixel storage split into fixed size, reference counted tiles.
+// Tiles are immutable while they are shared, so that snapshots of an image (e.g. for undo) only cost memory for the tiles that actually differ.
+// Tiles that are only kept for the history can be compressed and are decompressed again once they are needed.
+
+#define TILE_SIZE 64
+
+typedef struct tile_t {
+    unsigned int refs;
+    int width, height; // tiles on the right and bottom edge can be smaller than TILE_SIZE
+    Color *pixels; // NULL while compressed
+    unsigned char *packed; // qoi encoded pixels (raylib's codec), NULL while uncompressed
+    size_t packed_size;
+    // location of a copy in the history journal. Only valid while the journal still holds a tile with the same sequence number at that offset.
+    size_t journal_offset;
+    unsigned long long journal_seq;
+} tile_t;
+
+// memory accounting for all tiles created with the pool.
+typedef struct tile_pool_t {
+    size_t tiles;
+    size_t bytes;
+} tile_pool_t;
+
+typedef struct tilemap_t {
+    int x, y;           // position in the image, only non-zero for regions (multiples of TILE_SIZE)
+    int width, height;  // in pixels
+    int columns, rows;  // in tiles
+    tile_t **tiles;
+} tilemap_t;
+
+tile_t *tile_ref(tile_t *tile);
+// bytes of the tile in its current form, as accounted in the pool
+size_t tile_getMemory(const tile_t *tile);
+void tile_unref(tile_pool_t *pool, tile_t *tile);
+void tile_compress(tile_pool_t *pool, tile_t *tile);
+// returns false if there is no memory or the packed data is corrupted. The tile stays compressed then.
+bool tile_decompress(tile_pool_t *pool, tile_t *tile);
+// qoi encoded pixels of the tile. If *owned is set, the returned buffer has to be freed by the caller.
+const unsigned char *tile_getPacked(const tile_t *tile, size_t *size, bool *owned);
+// creates a compressed tile from a copy of packed.
+tile_t *tile_fromPacked(tile_pool_t *pool, int width, int height, const unsigned char *packed, size_t size);
+
+// all tiles are NULL and have to be set by the caller.
+tilemap_t tilemap_new(int width, int height);
+// image must be PIXELFORMAT_UNCOMPRESSED_R8G8B8A8.
+// tiles of base (may be NULL) that are equal to the corresponding part of the image are shared instead of copied.
+// tiles of base have to be uncompressed.
+tilemap_t tilemap_fromImage(tile_pool_t *pool, Image image, const tilemap_t *base);
+// shares all tiles of map.
+tilemap_t tilemap_copy(const tilemap_t *map);
+// shares the tiles of a rectangular part of map, given in tiles.
+tilemap_t tilemap_region(const tilemap_t *map, int column, int row, int columns, int rows);
+void tilemap_free(tile_pool_t *pool, tilemap_t *map);
+
+size_t tilemap_count(const tilemap_t *map);
+// decompresses all tiles of the map, false if one of them can't be.
+bool tilemap_decompress(tile_pool_t *pool, const tilemap_t *map);
+// pool bytes of all tiles of the map
+size_t tilemap_memory(const tilemap_t *map);
+// NULL if the position is outside of the map
+tile_t *tilemap_tileAt(const tilemap_t *map, int column, int row);
+// position of the tile in the image
+Rectangle tilemap_tileRect(const tilemap_t *map, size_t idx);
+bool tilemap_sameSize(const tilemap_t *a, const tilemap_t *b);
+
+// copy-on-write update of a single tile from the image. Only copies, if the content changed.
+// The replaced version of the tile is compressed, if it is still in use. A missing (NULL) tile is created.
+void tilemap_updateTile(tile_pool_t *pool, tilemap_t *map, size_t idx, Image image);
+// write a single tile into the image, which has to be the same size as the map. Decompresses the tile.
+// returns false and leaves the image untouched, if the tile can't be decompressed.
+bool tilemap_drawTile(tile_pool_t *pool, const tilemap_t *map, size_t idx, Image *image);
+
+#endif // __TILES_H
@@ -0,0 +1,125 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+#include "trace.h"
+
+typedef struct trace_event_t {
+    const char *name;
+    uint64_t start, duration; // in nanoseconds
+    uint32_t thread;
+    _Atomic uint64_t sequence; // index + 1 of the event once it is completely written
+} trace_event_t;
+
+static struct {
+    atomic_bool enabled;
+    trace_event_t *events; // ring of TRACE_CAPACITY events
+    _Atomic uint64_t count; // all recorded events, the ring holds the last TRACE_CAPACITY of them
+    _Atomic uint32_t threads;
+    uint64_t origin;
+    FILE *file;
+} tracer;
+
+static _Thread_local uint32_t trace_thread; // 0 until the thread records its first event
+
+uint64_t trace_now(void){
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / frequency.QuadPart);
+#else
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t)time.tv_sec*1000000000 + time.tv_nsec;
+#endif
+}
+
+// called at exit. Threads still recording at this point may be missing from the output.
+static void trace_write(void){
+    atomic_store(&tracer.enabled, false);
+    uint64_t count = atomic_load(&tracer.count);
+    uint64_t first = count > TRACE_CAPACITY? count - TRACE_CAPACITY : 0;
+
+    fprintf(tracer.file, "{\"traceEvents\":[\n");
+    fprintf(tracer.file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"imfap\"}}");
+    for (uint64_t i = first; i < count; i++){
+        trace_event_t *event = &tracer.events[i & (TRACE_CAPACITY - 1)];
+        if (atomic_load_explicit(&event->sequence, memory_order_acquire) != i + 1) continue; // overwritten or unfinished
+        fprintf(tracer.file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", event->name, event->thread,
+            (event->start - tracer.origin) / 1e3, event->duration / 1e3);
+    }
+    fprintf(tracer.file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    if (fclose(tracer.file) != 0) perror("Error while writing trace");
+    if (first > 0) printf("trace: only the last %d of %llu events were kept\n", TRACE_CAPACITY, (unsigned long long)count);
+    free(tracer.events);
+}
+
+bool trace_enable(const char *path){
+    if (atomic_load(&tracer.enabled)) return true;
+    tracer.events = calloc(TRACE_CAPACITY, sizeof(*tracer.events));
+    if (tracer.events == NULL){
+        perror("Error while allocating trace buffer");
+        return false;
+    }
+    tracer.file = fopen(path, "w");
+    if (tracer.file == NULL){
+        perror("Error while opening trace file");
+        free(tracer.events);
+        return false;
+    }
+    tracer.origin = trace_now();
+    atexit(trace_write);
+    atomic_store(&tracer.enabled, true);
+    return true;
+}
+
+inline bool trace_isEnabled(void){
+    return atomic_load_explicit(&tracer.enabled, memory_order_relaxed);
+}
+
+uint64_t trace_begin(void){
+    return trace_isEnabled()? trace_now() : 0;
+}
+
+void trace_end(const char *name, uint64_t start){
+    if (start == 0 || !trace_isEnabled()) return;
+    uint64_t end = trace_now();
+    if (trace_thread == 0) trace_thread = atomic_fetch_add(&tracer.threads, 1) + 1;
+
+    uint64_t index = atomic_fetch_add_explicit(&tracer.count, 1, memory_order_relaxed);
+    trace_event_t *event = &tracer.events[index & (TRACE_CAPACITY - 1)];
+    atomic_store_explicit(&event->sequence, 0, memory_order_relaxed);
+    event->name = name;
+    event->start = start;
+    event->duration = end - start;
+    event->thread = trace_thread;
+    atomic_store_explicit(&event->sequence, index + 1, memory_order_release);
+}
@@ -0,0 +1,52 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Opt-in timing of program phases, exported as Chrome trace events (chrome://tracing, ui.perfetto.dev).
+// Events go to a lock-free ring buffer, that keeps the most recent TRACE_CAPACITY events.
+// While tracing is disabled, trace_begin and trace_end only check a flag.
+//
+//     uint64_t start = trace_begin();
+//     ...
+//     trace_end("phase", start);
+
+#ifndef TRACE_CAPACITY
+#define TRACE_CAPACITY (1 << 18) // must be a power of two
+#endif // TRACE_CAPACITY
+
+// start recording. The events are written to path when the program exits.
+bool trace_enable(const char *path);
+bool trace_isEnabled(void);
+
+// monotonic timestamp in nanoseconds, also while tracing is disabled.
+uint64_t trace_now(void);
+// timestamp in nanoseconds, or 0 while tracing is disabled.
+uint64_t trace_begin(void);
+// record an event from start until now. name must stay valid until the program exits (string literals, __func__).
+void trace_end(const char *name, uint64_t start);
+
+#endif // __TRACE_H
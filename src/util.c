@@ -20,8 +20,12 @@
  *  3. This notice may not be removed or altered from any source distribution.
  */
 
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include "qoi.h"
 #include "util.h"
 
 
@@ -51,3 +55,35 @@ void setWindowTitleToPath(const char *image_path){
     sprintf(title, "%s - Image maker for angry programmers", image_path);
     SetWindowTitle(title);
 }
+
+bool exportImageSafely(Image image, const char *path, png_effort_t effort){
+    // keep the extension, raylib picks the format from it.
+    const char *extension = GetFileExtension(path);
+    if (extension == NULL) extension = "";
+    size_t temp_size = strlen(path) + strlen(".tmp") + strlen(extension) + 1;
+    char *temp_path = malloc(temp_size);
+    if (temp_path == NULL) return false;
+    snprintf(temp_path, temp_size, "%s.tmp%s", path, extension);
+
+    bool success;
+    if (IsFileExtension(path, ".png") && image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8){
+        size_t size = 0;
+        unsigned char *data = png_encode(image, effort, 0, &size);
+        success = data != NULL && size <= INT_MAX && SaveFileData(temp_path, data, size);
+        free(data);
+    } else if (IsFileExtension(path, ".qoi") && image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8){
+        success = qoi_saveFile(image.data, image.width, image.height, temp_path);
+    } else {
+        success = ExportImage(image, temp_path);
+    }
+#ifdef _WIN32
+    if (success) remove(path); // rename doesn't replace existing files on windows
+#endif
+    if (success && rename(temp_path, path) != 0){
+        perror("Error: failed to replace the saved image");
+        success = false;
+    }
+    if (!success) remove(temp_path);
+    free(temp_path);
+    return success;
+}
@@ -23,8 +23,12 @@
 #ifndef __UTIL_H
 #define __UTIL_H
 
+#include <stdbool.h>
+
 #include "external/raylib/src/raylib.h"
 
+#include "png.h"
+
 // fields are READONLY
 typedef struct color_t{
     Color rgba;  // READONLY
@@ -45,4 +49,9 @@ void toggleTool(enum CURSOR_MODE *cursor, enum CURSOR_MODE tool);
 
 void setWindowTitleToPath(const char *image_path);
 
+// writes to a temporary file next to path first and renames it when complete, so that path never holds a partial image.
+// png files of R8G8B8A8 images use the parallel encoder with the given effort and qoi files are streamed to disk,
+// everything else goes through ExportImage.
+bool exportImageSafely(Image image, const char *path, png_effort_t effort);
+
 #endif // __UTIL_H
@@ -0,0 +1,171 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#include <math.h>
+#include <stddef.h>
+
+#include "external/raylib/src/raylib.h"
+#include "external/raylib/src/rlgl.h"
+
+#include "view.h"
+
+// headers of the supported glsl versions, which make the shader body compatible with all of them.
+static const char *GLSL_330 =
+    "#version 330\n"
+    "#define IN in\n"
+    "#define TEXTURE texture\n"
+    "out vec4 finalColor;\n";
+static const char *GLSL_300_ES =
+    "#version 300 es\n"
+    "precision highp float;\n"
+    "#define IN in\n"
+    "#define TEXTURE texture\n"
+    "out vec4 finalColor;\n";
+static const char *GLSL_120 =
+    "#version 120\n"
+    "#define IN varying\n"
+    "#define TEXTURE texture2D\n"
+    "#define finalColor gl_FragColor\n";
+static const char *GLSL_100 =
+    "#version 100\n"
+    "#ifdef GL_FRAGMENT_PRECISION_HIGH\n"
+    "precision highp float;\n"
+    "#else\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "#define IN varying\n"
+    "#define TEXTURE texture2D\n"
+    "#define finalColor gl_FragColor\n";
+
+// runs on the quad of each canvas texture, drawn by raylib's default vertex shader.
+// the grid line of an image pixel is the first screen pixel of its column or row, except for the first column and row of the canvas.
+static const char *FRAGMENT_SHADER =
+    "IN vec2 fragTexCoord;\n"
+    "IN vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec2 textureSize;\n" // in image pixels
+    "uniform vec2 offset;\n" // position of the texture in the canvas, in image pixels
+    "uniform float scale;\n" // screen pixels per image pixel
+    "uniform float showGrid;\n"
+    "uniform vec4 gridColor;\n"
+    "const float CHECKER_SIZE = 8.0;\n" // in screen pixels
+    "void main(){\n"
+    "    vec2 screen = floor((offset + fragTexCoord*textureSize)*scale);\n" // screen pixel relative to the top left corner of the canvas
+    "    vec4 texel = TEXTURE(texture0, fragTexCoord);\n"
+    "    vec2 cell = floor(screen/CHECKER_SIZE);\n"
+    "    vec3 checker = mod(cell.x + cell.y, 2.0) < 0.5? vec3(0.8) : vec3(0.6);\n"
+    "    vec3 color = mix(checker, texel.rgb, texel.a);\n"
+    "    vec2 line = step(mod(screen, scale), vec2(0.5))*step(vec2(0.5), screen);\n"
+    "    if (showGrid > 0.5 && max(line.x, line.y) > 0.5) color = mix(color, gridColor.rgb, gridColor.a);\n"
+    "    finalColor = vec4(color, 1.0)*fragColor;\n"
+    "}\n";
+
+static const char *glslHeader(void){
+    switch (rlGetVersion()){
+        case RL_OPENGL_33: // fallthrough
+        case RL_OPENGL_43: return GLSL_330;
+        case RL_OPENGL_ES_30: return GLSL_300_ES;
+        case RL_OPENGL_21: return GLSL_120;
+        case RL_OPENGL_ES_20: return GLSL_100;
+        default: return NULL; // OpenGL 1.1 has no shaders
+    }
+}
+
+view_t view_load(void){
+    view_t view = {0};
+    const char *header = glslHeader();
+    if (header == NULL) return view;
+    view.shader = LoadShaderFromMemory(NULL, TextFormat("%s%s", header, FRAGMENT_SHADER));
+    // raylib falls back to the default shader if compilation fails
+    view.has_shader = IsShaderReady(view.shader) && view.shader.id != rlGetShaderIdDefault();
+    if (!view.has_shader){
+        TraceLog(LOG_WARNING, "VIEW: canvas shader could not be loaded, drawing the grid with lines");
+        return view;
+    }
+    view.texture_size_loc = GetShaderLocation(view.shader, "textureSize");
+    view.offset_loc = GetShaderLocation(view.shader, "offset");
+    view.scale_loc = GetShaderLocation(view.shader, "scale");
+    view.show_grid_loc = GetShaderLocation(view.shader, "showGrid");
+    view.grid_color_loc = GetShaderLocation(view.shader, "gridColor");
+    return view;
+}
+
+void view_unload(view_t *view){
+    if (view->has_shader) UnloadShader(view->shader);
+    *view = (view_t){0};
+}
+
+// fallback: one line per visible column and row.
+static void drawGridLines(Vector2 canvas_size, Vector2 position, float scale, Color grid_color){
+    int first_column = position.x < 0? -position.x / scale : 0;
+    int first_row = position.y < 0? -position.y / scale : 0;
+    int last_column = (GetScreenWidth() - position.x) / scale, last_row = (GetScreenHeight() - position.y) / scale;
+    for (int i = first_column > 1? first_column : 1; i < canvas_size.x && i <= last_column; i++){
+        DrawLineEx((Vector2){position.x + i*scale, position.y}, (Vector2){position.x + i*scale, position.y + canvas_size.y*scale}, 1, grid_color);
+    }
+    for (int j = first_row > 1? first_row : 1; j < canvas_size.y && j <= last_row; j++){
+        DrawLineEx((Vector2){position.x, position.y + j*scale}, (Vector2){position.x + canvas_size.x*scale, position.y + j*scale}, 1, grid_color);
+    }
+}
+
+int view_mipLevel(float scale){
+    int level = 0;
+    while (scale <= 0.5f && level < CANVAS_MAX_MIP_LEVEL){
+        scale *= 2;
+        level++;
+    }
+    return level;
+}
+
+// the edges are rounded, so that neighbouring textures never leave a gap at fractional scales.
+static void drawTexture(const canvas_texture_t *part, Vector2 position, float scale){
+    float x0 = roundf(position.x + part->rect.x*scale), y0 = roundf(position.y + part->rect.y*scale);
+    float x1 = roundf(position.x + (part->rect.x + part->rect.width)*scale), y1 = roundf(position.y + (part->rect.y + part->rect.height)*scale);
+    Rectangle source = {0, 0, part->texture.width, part->texture.height};
+    DrawTexturePro(part->texture, source, (Rectangle){x0, y0, x1 - x0, y1 - y0}, (Vector2){0}, 0, WHITE);
+}
+
+void view_drawCanvas(view_t *view, canvas_frame_t frame, int level, Vector2 canvas_size, Vector2 position, float scale, bool show_grid, Color grid_color){
+    float level_scale = scale * (1 << level); // screen pixels per pixel of the level
+    if (!view->has_shader){
+        for (int i = 0; i < frame.count; i++) drawTexture(&frame.textures[i], position, level_scale);
+        if (show_grid) drawGridLines(canvas_size, position, scale, grid_color);
+    } else {
+        float show_grid_value = show_grid;
+        Vector4 grid_color_value = ColorNormalize(grid_color);
+        SetShaderValue(view->shader, view->scale_loc, &level_scale, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(view->shader, view->show_grid_loc, &show_grid_value, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(view->shader, view->grid_color_loc, &grid_color_value, SHADER_UNIFORM_VEC4);
+        BeginShaderMode(view->shader);
+        for (int i = 0; i < frame.count; i++){
+            const canvas_texture_t *part = &frame.textures[i];
+            Vector2 texture_size = {part->rect.width, part->rect.height}, offset = {part->rect.x, part->rect.y};
+            SetShaderValue(view->shader, view->texture_size_loc, &texture_size, SHADER_UNIFORM_VEC2);
+            SetShaderValue(view->shader, view->offset_loc, &offset, SHADER_UNIFORM_VEC2);
+            drawTexture(part, position, level_scale);
+            rlDrawRenderBatchActive(); // the uniforms of the next texture must not apply to this one
+        }
+        EndShaderMode();
+    }
+    // the border lies outside of the canvas quad
+    if (show_grid) DrawRectangleLines(position.x - 1, position.y - 1, canvas_size.x*scale + 2, canvas_size.y*scale + 2, grid_color);
+}
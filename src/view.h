@@ -0,0 +1,52 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+
+#ifndef __VIEW_H
+#define __VIEW_H
+
+#include <stdbool.h>
+
+#include "external/raylib/src/raylib.h"
+
+#include "canvas.h"
+
+// Draws the canvas texture with a checkerboard behind transparent pixels and an optional pixel grid.
+// Both are done by a fragment shader in a single draw call, independent of the image size.
+// Without shader support the grid falls back to drawing the visible lines one by one, without checkerboard.
+
+typedef struct view_t {
+    Shader shader;
+    bool has_shader;
+    int texture_size_loc, offset_loc, scale_loc, show_grid_loc, grid_color_loc;
+} view_t;
+
+// the window has to be open.
+view_t view_load(void);
+void view_unload(view_t *view);
+
+// mip level of the canvas to draw at scale. Levels are drawn at a scale between 0.5 and 1, or larger for level 0.
+int view_mipLevel(float scale);
+// draws the textures of mip level of a canvas of canvas_size pixels at position, every canvas pixel as a square of scale screen pixels.
+// the grid requires an integer scale.
+void view_drawCanvas(view_t *view, canvas_frame_t frame, int level, Vector2 canvas_size, Vector2 position, float scale, bool show_grid, Color grid_color);
+
+#endif // __VIEW_H
@@ -0,0 +1,123 @@
+/*
+ *  zlib license:
+ *
+ *  Copyright (c) 2024 Lieven Petersen
+ *
+ *  This software is provided 'as-is', without any express or implied
+ *  warranty. In no event will the authors be held liable for any damages
+ *  arising from the use of this software.
+ *
+ *  Permission is granted to anyone to use this software for any purpose,
+ *  including commercial applications, and to alter it and redistribute it
+ *  freely, subject to the following restrictions:
+ *
+ *  1. The origin of this software must not be misrepresented; you must not
+ *  claim that you wrote the original software. If you use this software
+ *  in a product, an acknowledgment in the product documentation would be
+ *  appreciated but is not required.
+ *  2. Altered source versions must be plainly marked as such, and must not be
+ *  misrepresented as being the original software.
+ *  3. This notice may not be removed or altered from any source distribution.
+ */
+// generates src/font.h (make font): the menu font rasterized at 0.5x, 1x and 2x of size, as glyph atlases and glyph metrics.
+// the atlases are laid out like raylib's LoadFontFromMemory does it, but only the pixels of the glyphs are stored,
+// the atlas is mostly empty space. Startup then only inflates these pixels, instead of running stb_truetype.
+// usage: tools/bake_font <font.ttf> <size>, the header is printed to stdout.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "external/raylib/src/raylib.h"
+
+#define GLYPH_COUNT 95 // ASCII 32 - 126, raylib's default
+#define GLYPH_PADDING 4 // FONT_TTF_DEFAULT_CHARS_PADDING of rtext.c
+static const float LEVEL_SCALES[] = {0.5f, 1.0f, 2.0f};
+#define LEVEL_COUNT (int)(sizeof(LEVEL_SCALES)/sizeof(*LEVEL_SCALES))
+
+static void printBytes(const unsigned char *data, int size){
+    for (int i = 0; i < size; i++){
+        printf("%s0x%02x,%s", i % 16 == 0? "    " : "", data[i], i % 16 == 15 || i == size - 1? "\n" : " ");
+    }
+}
+
+// returns false if the font could not be rasterized.
+static bool printLevel(const unsigned char *ttf, int ttf_size, int level, int size){
+    GlyphInfo *glyphs = LoadFontData(ttf, ttf_size, size, NULL, GLYPH_COUNT, FONT_DEFAULT);
+    if (glyphs == NULL) return false;
+    Rectangle *recs = NULL;
+    Image atlas = GenImageFontAtlas(glyphs, &recs, GLYPH_COUNT, size, GLYPH_PADDING, 0);
+
+    // the gray channel of the atlas is always white, only the alpha channel of the glyph rectangles is kept.
+    int pixel_count = 0;
+    for (int i = 0; i < GLYPH_COUNT; i++) pixel_count += (int)recs[i].width*(int)recs[i].height;
+    unsigned char *alpha = malloc(pixel_count);
+    unsigned char *out = alpha;
+    for (int i = 0; i < GLYPH_COUNT; i++){
+        for (int y = recs[i].y; y < recs[i].y + recs[i].height; y++){
+            for (int x = recs[i].x; x < recs[i].x + recs[i].width; x++) *out++ = ((unsigned char*)atlas.data)[2*(y*atlas.width + x) + 1];
+        }
+    }
+    int compressed_size = 0;
+    unsigned char *compressed = CompressData(alpha, pixel_count, &compressed_size);
+
+    printf("// %dpx, alpha values of the glyph rectangles one after another, compressed with the DEFLATE algorithm.\n", size);
+    printf("const unsigned char BAKED_FONT_PIXELS_%d[] = {\n", level);
+    printBytes(compressed, compressed_size);
+    printf("};\n\n");
+    printf("const baked_glyph_t BAKED_FONT_GLYPHS_%d[BAKED_FONT_GLYPH_COUNT] = {\n", level);
+    for (int i = 0; i < GLYPH_COUNT; i++){
+        printf("    {%d, %d, %d, %d, %d, %d, %d, %d},\n", glyphs[i].value, glyphs[i].offsetX, glyphs[i].offsetY, glyphs[i].advanceX,
+            (int)recs[i].x, (int)recs[i].y, (int)recs[i].width, (int)recs[i].height);
+    }
+    printf("};\n\n");
+    printf("#define BAKED_FONT_%d {%d, %d, %d, %d, %d, BAKED_FONT_PIXELS_%d, BAKED_FONT_GLYPHS_%d}\n\n",
+        level, size, atlas.width, atlas.height, pixel_count, compressed_size, level, level);
+
+    MemFree(compressed);
+    free(alpha);
+    UnloadImage(atlas);
+    MemFree(recs);
+    UnloadFontData(glyphs, GLYPH_COUNT);
+    return true;
+}
+
+int main(int argc, char **argv){
+    int size = argc == 3? atoi(argv[2]) : 0;
+    if (size <= 0){
+        fprintf(stderr, "usage: %s <font.ttf> <size>\n", argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+    int ttf_size = 0;
+    unsigned char *ttf = LoadFileData(argv[1], &ttf_size);
+    if (ttf == NULL) return 1;
+
+    printf("#ifndef __FONT_H\n#define __FONT_H\n\n");
+    printf("// Generated by tools/bake_font.c from %s at size %d, do not edit. Run 'make font' to update.\n", GetFileName(argv[1]), size);
+    printf("// Pre-rasterized glyph atlases of the menu font, one per font level.\n\n");
+    printf("#define BAKED_FONT_LEVELS %d\n", LEVEL_COUNT);
+    printf("#define BAKED_FONT_GLYPH_COUNT %d\n", GLYPH_COUNT);
+    printf("#define BAKED_FONT_GLYPH_PADDING %d\n\n", GLYPH_PADDING);
+    printf("typedef struct baked_glyph_t {\n");
+    printf("    short value, offset_x, offset_y, advance_x;\n");
+    printf("    short x, y, width, height; // in the atlas\n");
+    printf("} baked_glyph_t;\n\n");
+    printf("typedef struct baked_font_t {\n");
+    printf("    int size;\n");
+    printf("    int atlas_width, atlas_height;\n");
+    printf("    int pixel_count, compressed_size;\n");
+    printf("    const unsigned char *pixels; // alpha channel of the glyphs, the color is white\n");
+    printf("    const baked_glyph_t *glyphs;\n");
+    printf("} baked_font_t;\n\n");
+    for (int level = 0; level < LEVEL_COUNT; level++){
+        if (!printLevel(ttf, ttf_size, level, LEVEL_SCALES[level]*size)){
+            fprintf(stderr, "failed to rasterize '%s'\n", argv[1]);
+            return 1;
+        }
+    }
+    printf("const baked_font_t BAKED_FONTS[BAKED_FONT_LEVELS] = {");
+    for (int level = 0; level < LEVEL_COUNT; level++) printf("%sBAKED_FONT_%d", level > 0? ", " : "", level);
+    printf("};\n\n#endif //__FONT_H\n");
+    UnloadFileData(ttf);
+    return 0;
+}